@@ -24,6 +24,8 @@
 #if defined(USE_DEBUGGER)
 
 #include "circularBuffer.h"
+#include "shadowStore.h"
+#include "simd.h"
 
 namespace Debugger {
 
@@ -46,6 +48,12 @@ public:
 	 */
 	static void reset();
 
+	/*!
+	 * shutdown function sends the leak report to the console
+	 * call it before destroying the context
+	 */
+	static void shutdown();
+
 	/** set state : break on error */
 	static inline void setBreakOnError(const bool& state)
 	{
@@ -83,6 +91,345 @@ public:
 		_console_cb = cb;
 	}
 
+	/** warn (break on warning) when a frame uploads more than
+	 * "bytes" through glBufferData/glTexImage2D/... (0 == disabled) */
+	static inline void setUploadSpikeThreshold(const uint64_t& bytes)
+	{
+		_upload_spike_threshold = bytes;
+	}
+
+	/** bytes uploaded during the last complete frame */
+	static inline uint64_t getUploadBytesLastFrame()
+	{
+		return _upload_last_frame;
+	}
+
+	/** bytes uploaded since gl::init() */
+	static inline uint64_t getUploadBytesTotal()
+	{
+		return _upload_total;
+	}
+
+	/** upload report : bytes per entry point and per call site */
+	static const String getUploadReport();
+
+	/** bytes copied from client arrays (vertices and indices without
+	 * buffer object) during the last complete frame, not counted in
+	 * the uploaded bytes */
+	static inline uint64_t getClientArrayBytesLastFrame()
+	{
+		return _client_last_frame;
+	}
+
+	/** bytes copied from client arrays since gl::init() */
+	static inline uint64_t getClientArrayBytesTotal()
+	{
+		return _client_total;
+	}
+
+	/** hash every upload payload to find identical re-uploads
+	 * (disabled by default) */
+	static void setRedundantUploadCheck(bool enable);
+
+	/** bytes uploaded twice during the last complete frame */
+	static inline uint64_t getRedundantBytesLastFrame()
+	{
+		return _redundant_total.lastFrameBytes;
+	}
+
+	/** identical re-uploads per call site */
+	static const String getRedundantUploadReport();
+
+	/** bytes written through mapped buffers during the last complete
+	 * frame (flushed ranges, the whole range without explicit flush) */
+	static inline uint64_t getMappedBytesLastFrame()
+	{
+		return _uploads[UPLOAD_MAP_BUFFER].lastFrameBytes;
+	}
+
+	/** buffer mappings per call site : access flags, time blocked in the
+	 * map call, synchronized maps of buffers still drawn, flushed bytes
+	 * against mapped bytes */
+	static const String getMapReport(uint top = 20);
+
+	/** how a buffer is actually used (see getBufferUsagePattern) */
+	enum BufferPattern_e {
+		BUFFER_PATTERN_UNKNOWN = 0,		// never written
+		BUFFER_PATTERN_STATIC,			// written once, hint is fine
+		BUFFER_PATTERN_STATIC_STREAMED,	// STATIC_DRAW but rewritten often
+		BUFFER_PATTERN_DYNAMIC_UNUSED,	// STREAM/DYNAMIC_DRAW written once
+		BUFFER_PATTERN_STREAMED,		// rewritten often, no sync seen
+		BUFFER_PATTERN_ORPHANED,		// rewritten after orphaning
+		BUFFER_PATTERN_IMPLICIT_SYNC,	// sub-updates while in use by a draw
+		BUFFER_PATTERN_SIZE
+	};
+
+	/** measured usage of a buffer (BUFFER_PATTERN_XXX) */
+	static uint getBufferUsagePattern(uint id);
+
+	/** usage pattern and recommendation per buffer */
+	static const String getBufferUsageReport();
+
+	/** objects deleted within "frames" frames of their creation are
+	 * reported as churn (default 4) */
+	static void setChurnThreshold(uint frames);
+
+	/** objects created during the last complete frame */
+	static inline uint getObjectsCreatedLastFrame()
+	{
+		return _objects_last_frame;
+	}
+
+	/** short lived objects per creation call site (pooling targets) */
+	static const String getObjectChurnReport();
+
+	/** live objects and their memory per creation call site */
+	static const String getLiveObjectReport();
+
+	/** objects created since "sinceFrame" and never deleted, with their
+	 * ids per creation call site */
+	static const String getLeakReport(uint sinceFrame = 0);
+
+	/** kinds of the tracked gl objects */
+	enum Object_e {
+		OBJECT_BUFFER = 0,
+		OBJECT_TEXTURE,
+		OBJECT_RENDERBUFFER,
+		OBJECT_FRAMEBUFFER,
+		OBJECT_PROGRAM,
+		OBJECT_SHADER,
+		OBJECT_SIZE
+	};
+
+	/** creation frame and call site of an object (false if unknown) */
+	static bool getObjectOrigin(uint kind, uint id, uint& frame,
+		String& site);
+
+	/** glUniformXXX calls that did not change the value during the last
+	 * complete frame */
+	static inline uint64_t getRedundantUniformsLastFrame()
+	{
+		return _uniform_redundant.lastFrameCalls;
+	}
+
+	/** uniform calls and redundant ones per call site */
+	static const String getUniformReport();
+
+	/** answer glGetUniformLocation from the locations read at link time
+	 * (enabled by default) */
+	static inline void setUniformLocationCache(const bool& state)
+	{
+		_uniform_location_cache = state;
+	}
+
+	/** glGetUniformLocation call sites, the ones called inside the frame
+	 * loop first */
+	static const String getUniformLocationReport();
+
+	/** nanoseconds spent compiling/linking shaders (and in the first
+	 * draw of new programs) during the last complete frame */
+	static inline uint64_t getShaderTimeLastFrame()
+	{
+		return _shader_time_last_frame;
+	}
+
+	/** shader preparation cost : startup, per frame, slowest programs
+	 * and sources compiled more than once */
+	static const String getShaderReport();
+
+	/** wrapped calls slower than "ns" nanoseconds capture the call
+	 * history before them (0 == disabled, default 8ms) */
+	static inline void setStallThreshold(const uint64_t& ns)
+	{
+		_stall_threshold = ns;
+	}
+
+	/** number of stalls captured since init */
+	static inline uint getStallCount()
+	{
+		return _stall_count;
+	}
+
+	/** slowest entry points : baseline, max, outliers and sync calls */
+	static const String getCallTimingReport(uint top = 20);
+
+	/** last stalls with the calls before them */
+	static const String getStallReport();
+
+	/** glLinkProgram loads/stores program binaries in "directory"
+	 * (GL_OES_get_program_binary, empty == disabled) */
+	static inline void setProgramBinaryCache(const String& directory)
+	{
+		_program_binary_dir = directory;
+	}
+
+	/** glLinkProgram calls answered from the program binary cache */
+	static inline uint getProgramBinaryHits()
+	{
+		return _program_binary_hits;
+	}
+
+	/** gpu profiling level, each one includes the previous ones */
+	enum GpuProfiling_e {
+		GPU_PROFILING_OFF = 0,
+		GPU_PROFILING_FRAME,	// gl::reset() to gl::reset()
+		GPU_PROFILING_GROUP,	// glPushGroupMarkerEXT/glPushDebugGroupKHR
+		GPU_PROFILING_DRAW		// each glDrawArrays/glDrawElements
+	};
+
+	/** time frames, debug groups or draws on the gpu with
+	 * GL_EXT_disjoint_timer_query (disabled by default), the results are
+	 * read a few frames later without waiting for the gpu */
+	static void setGpuProfiling(uint level);
+
+	/** gpu nanoseconds of the last frame read back (0 if none) */
+	static inline uint64_t getGpuTimeLastFrame()
+	{
+		return _gpu_last_frame_time;
+	}
+
+	/** gpu nanoseconds of a recent frame (false if not read back yet,
+	 * dropped by a disjoint event or too old) */
+	static bool getGpuFrameTime(uint frame, uint64_t& ns);
+
+	/** gpu time per frame, debug group and draw call site */
+	static const String getGpuReport(uint top = 20);
+
+	/** install the debugger GL_KHR_debug callback (synchronous output),
+	 * the driver messages go to the call history and the application
+	 * callback still receives them. "skipGetError" : if the driver
+	 * reports the errors as messages, glGetError is only called after
+	 * a failing call (to clear the error flag) */
+	static void setDebugOutput(bool enable, bool skipGetError = true);
+
+	/** driver messages received since init (rate limited ones too) */
+	static inline uint getDebugMessageCount()
+	{
+		return _debug_message_count;
+	}
+
+	/** driver messages per id : count, last call site and text */
+	static const String getDebugMessageReport(uint top = 20);
+
+	/** zone tree of the last complete frame : debug groups
+	 * (glPushGroupMarkerEXT/glPushDebugGroupKHR) with their time, calls,
+	 * draws, state changes and uploads, event markers as leaves */
+	static const String getZoneReport();
+
+	/** zone self times since init as folded stacks ("frame;a;b ns" per
+	 * line), the input of flamegraph.pl and similar tools */
+	static const String getFoldedStacks();
+
+	/** draw calls of the last complete frame that could be removed by
+	 * merging, instancing or base vertex draws */
+	static inline uint getDrawsSavableLastFrame()
+	{
+		return _batch_saved_last_frame;
+	}
+
+	/** runs of consecutive draws with the same program, textures,
+	 * blend/depth state and vertex layout in the last complete frame */
+	static const String getBatchingReport(uint top = 20);
+
+	/** state dimensions of the state sort cost model */
+	enum StateDimension_e {
+		STATE_FRAMEBUFFER = 0,
+		STATE_PROGRAM,
+		STATE_TEXTURES,
+		STATE_RENDER,		// blend/depth/raster state
+		STATE_SIZE
+	};
+
+	/** relative cost of a change of "dimension" (defaults : framebuffer
+	 * 100, program 10, textures 4, render state 2) */
+	static inline void setStateChangeCost(uint dimension, uint cost)
+	{
+		if (dimension < STATE_SIZE)
+			_state_costs[dimension] = cost;
+	}
+
+	/** framebuffers : attachments, render size and completeness */
+	static const String getFramebufferReport();
+
+	/** size and bytes per pixel of the default framebuffer for the render
+	 * pass estimates (default : the biggest glViewport on it, 4 bytes
+	 * color, 3 bytes depth, 1 byte stencil) */
+	static void setDefaultFramebuffer(GLsizei width, GLsizei height,
+		uint colorBytes = 4, uint depthBytes = 3, uint stencilBytes = 1);
+
+	/** estimated tile memory traffic (loads + stores) of the last
+	 * complete frame */
+	static inline uint64_t getPassBytesLastFrame()
+	{
+		return _pass_bytes_last_frame;
+	}
+
+	/** render passes of the last complete frame (split at framebuffer
+	 * binds, tiling regions and swaps) : load/store of each attachment,
+	 * bytes moved and the needless loads/stores */
+	static const String getRenderPassReport();
+
+	/** damaged part of the surface declared at the last swap with damage
+	 * (eglSwapBuffersWithDamage, eglSwapBuffersRegionNOK), 1 if none */
+	static inline double getDamageLastSwap()
+	{
+		if (_damage_frames.empty())
+			return 1.0;
+
+		const DamageFrame_t& entry = _damage_frames.back();
+		return static_cast<double>(entry.damage) / entry.surface;
+	}
+
+	/** partial updates : declared damage against the area rendered on
+	 * the default framebuffer (viewport and scissor of the draws and
+	 * clears), eglSetDamageRegionKHR and buffer age checks */
+	static const String getDamageReport();
+
+	/** state changes of the last complete frame against the same draws
+	 * sorted by cost : opaque draws sorted per framebuffer, blended draws
+	 * kept in order after them */
+	static const String getStateSortReport();
+
+	/** estimated resident memory : textures + buffers + renderbuffers */
+	static uint64_t getMemoryTotal();
+
+	/** memory growth during the last complete frame (can be negative) */
+	static int64_t getMemoryDeltaLastFrame();
+
+	/** memory report : totals, last frame delta and the "top" biggest
+	 * objects */
+	static const String getMemoryReport(uint top = 10);
+
+	/** keep a copy of the buffer and texture uploads (disabled by
+	 * default), "budget" caps the memory used by the copies : the least
+	 * recently used contents are dropped first */
+	static void setShadowing(bool enable,
+		uint64_t budget = 64 * 1024 * 1024);
+
+	static inline bool isShadowing()
+	{
+		return _shadowing;
+	}
+
+	/** read the shadow copy of a buffer (false if unknown or dropped) */
+	static bool readShadowBuffer(uint id, uint64_t offset, void* dst,
+		uint64_t size);
+
+	/** read the shadow copy of a 2d texture level, rows are tightly
+	 * packed (false if unknown or dropped) */
+	static bool readShadowTexture(uint id, GLenum target, GLint level,
+		void* dst, uint64_t size);
+
+	/** keep the actual content of a shadowed buffer, pages are shared
+	 * until the buffer is written again. return 0 if unknown */
+	static uint snapshotShadowBuffer(uint id);
+	static bool readShadowSnapshot(uint snapshot, uint64_t offset,
+		void* dst, uint64_t size);
+	static void releaseShadowSnapshot(uint snapshot);
+
+	/** shadow store usage */
+	static const String getShadowReport();
+
 protected:
 	// enum
 	enum NewEntity_e {
@@ -185,10 +532,31 @@ protected:
 		// todo: other stuff to check
 	}; typedef Vector<Shader_t> Shader_v;
 
+	enum Texture_id {
+		TEXTURE_2D = 0,
+		TEXTURE_CUBE_MAP,
+		TEXTURE_3D,
+		TEXTURE_TARGET_SIZE,
+		TEXTURE_UNITS = 32,		// GL_TEXTURE0 .. GL_TEXTURE31
+		TEXTURE_LEVELS = 16,	// 32768x32768
+		TEXTURE_FACES = 6
+	};
+
 	struct Texture_t {
-		Texture_t() : id(0), valid(0),flags(NEW_TEXTURE) {}
+		Texture_t() : id(0), valid(0),flags(NEW_TEXTURE),
+			target(TEXTURE_TARGET_SIZE), internalformat(0), type(0),
+			width(0), height(0), depth(0), memory(0)
+		{
+			memset(levelSize, 0, sizeof(levelSize));
+		}
 		Texture_t(const Texture_t& b) : id(b.id), valid(b.valid),
-			flags(b.flags){}
+			flags(b.flags), target(b.target),
+			internalformat(b.internalformat), type(b.type),
+			width(b.width), height(b.height), depth(b.depth),
+			memory(b.memory)
+		{
+			memcpy(levelSize, b.levelSize, sizeof(levelSize));
+		}
 
 		bool operator==(const Texture_t& rhs) const {
 			return memcmp((void*)this, (void*)&rhs, sizeof(*this)) == 0;
@@ -203,8 +571,155 @@ protected:
 		uint id;
 		uchar valid;
 		uint flags;
+		uint target;			// local target (TEXTURE_2D, ...)
+		GLenum internalformat;	// level 0
+		GLenum type;			// level 0
+		GLsizei width;			// level 0
+		GLsizei height;			// level 0
+		GLsizei depth;			// level 0
+		uint64_t levelSize[TEXTURE_FACES][TEXTURE_LEVELS];
+		uint64_t memory;		// sum of levelSize
 		// todo: other stuff to check
 	}; typedef Vector<Texture_t> Texture_v;
+
+	struct Renderbuffer_t {
+		Renderbuffer_t() : id(0), internalformat(0), width(0), height(0),
+			samples(0), memory(0) {}
+
+		uint id;
+		GLenum internalformat;
+		GLsizei width;
+		GLsizei height;
+		GLsizei samples;
+		uint64_t memory;
+	}; typedef Vector<Renderbuffer_t> Renderbuffer_v;
+
+	enum Attachment_id {
+		ATTACHMENT_COLOR0 = 0,
+		ATTACHMENT_DEPTH,
+		ATTACHMENT_STENCIL,
+		ATTACHMENT_SIZE
+	};
+
+	/** image attached to a framebuffer */
+	struct Attachment_t {
+		Attachment_t() : kind(GL_NONE), id(0), level(0), textarget(0) {}
+
+		GLenum kind;		// GL_NONE, GL_TEXTURE or GL_RENDERBUFFER
+		uint id;
+		GLint level;
+		GLenum textarget;	// GL_TEXTURE_2D or a cube map face
+	};
+
+	struct Framebuffer_t {
+		Framebuffer_t() : id(0), dirty(true), status(0), statusKey(0),
+			width(0), height(0) {}
+
+		uint id;
+		Attachment_t attachments[ATTACHMENT_SIZE];
+		bool dirty;			// attachments changed since "status"
+		GLenum status;		// completeness of "statusKey" (0 : unknown)
+		uint32_t statusKey;	// attachment configuration of "status"
+		GLsizei width;		// render size (smallest attachment)
+		GLsizei height;
+	}; typedef Vector<Framebuffer_t> Framebuffer_v;
+
+	/** an attachment in a render pass */
+	struct PassAttachment_t {
+		PassAttachment_t() : image(0), bytes(0), keep(false),
+			cleared(false), lateClear(false), drawn(false),
+			invalidated(false), discarded(false), load(false),
+			store(false), needlessLoad(false), needlessStore(false),
+			pendingStore(false) {}
+
+		uint64_t image;		// kind << 32 | id (0 : no attachment)
+		uint64_t bytes;		// size of the image in memory
+		bool keep;			// texture or presented : the store is useful
+		bool cleared;		// full glClear before the first draw
+		bool lateClear;		// full glClear after a draw
+		bool drawn;			// draws or partial clears
+		bool invalidated;	// discarded before any write
+		bool discarded;		// discarded after the last write
+		bool load;			// copied to tile memory at the start
+		bool store;			// copied back to memory at the end
+		bool needlessLoad;
+		bool needlessStore;
+		bool pendingStore;	// settled by the first use in the next frame
+	};
+
+	/** draws and clears on the same framebuffer */
+	struct RenderPass_t {
+		RenderPass_t() : framebuffer(0), width(0), height(0), draws(0),
+			clears(0), packedStencil(false), tiling(false),
+			tilingEnd(false), startMask(0), endMask(0), bytes(0),
+			needless(0) {}
+
+		uint framebuffer;
+		GLsizei width;
+		GLsizei height;
+		uint draws;
+		uint clears;
+		bool packedStencil;		// stencil is the depth image
+		bool tiling;			// opened by glStartTilingQCOM
+		bool tilingEnd;			// closed by glEndTilingQCOM
+		GLbitfield startMask;	// preserve masks
+		GLbitfield endMask;
+		PassAttachment_t attachments[ATTACHMENT_SIZE];
+		uint64_t bytes;			// loads + stores
+		uint64_t needless;		// needless loads + stores
+	}; typedef Vector<RenderPass_t> RenderPass_v;
+
+	/** window coordinates (origin bottom left, like egl damage rects) */
+	struct Rect_t {
+		Rect_t() : x(0), y(0), width(0), height(0) {}
+		Rect_t(GLint x_, GLint y_, GLsizei width_, GLsizei height_) :
+			x(x_), y(y_), width(width_), height(height_) {}
+
+		bool operator==(const Rect_t& rhs) const {
+			return x == rhs.x && y == rhs.y && width == rhs.width &&
+				height == rhs.height;
+		};
+
+		/** bounding box of both */
+		inline void merge(const Rect_t& rhs)
+		{
+			const GLint x1 = std::max(x + width, rhs.x + rhs.width);
+			const GLint y1 = std::max(y + height, rhs.y + rhs.height);
+			x = std::min(x, rhs.x);
+			y = std::min(y, rhs.y);
+			width = x1 - x;
+			height = y1 - y;
+		}
+
+		GLint x;
+		GLint y;
+		GLsizei width;
+		GLsizei height;
+	}; typedef Vector<Rect_t> Rect_v;
+
+	enum Damage_e {
+		DAMAGE_RECTS = 64,			// rendered rects kept per frame
+		DAMAGE_AGES = 8,			// oldest buffer age checked
+		DAMAGE_FRAMES = 32,			// swaps in the report
+		DAMAGE_MAX_SIZE = 32768,	// "whole surface" before clipping
+		DAMAGE_STALE = 1,			// buffer age : pixels not rendered again
+		DAMAGE_OUTSIDE_REGION = 2,	// rendered outside eglSetDamageRegion
+		DAMAGE_UNDECLARED = 4		// rendered outside the swap damage
+	};
+
+	/** a swap with damage, areas in pixels */
+	struct DamageFrame_t {
+		DamageFrame_t() : frame(0), age(-1), surface(0), damage(0),
+			rendered(0), undeclared(0), flags(0) {}
+
+		uint frame;
+		EGLint age;				// buffer age (-1 : unknown)
+		uint64_t surface;
+		uint64_t damage;		// declared
+		uint64_t rendered;		// viewport/scissor of the draws
+		uint64_t undeclared;	// rendered outside the damage
+		uint flags;				// DAMAGE_STALE, ...
+	}; typedef Vector<DamageFrame_t> DamageFrame_v;
 	
 	enum Buffer_id {
 		INVALID_BUFFER_TARGET = 0,
@@ -222,11 +737,11 @@ protected:
 	struct Buffer_t {
 		Buffer_t() : target(INVALID_BUFFER_TARGET),id(INVALID_BOUND),
 			valid(0), size(0),flags(NEW_BUFFER),data(nullptr),mapped(0),
-			mapPointer(nullptr), mapOffset(0),mapLength(0) {}
+			mapPointer(nullptr), mapOffset(0),mapLength(0), drawFrame(0) {}
 		Buffer_t(const Buffer_t& b) : id(b.id), valid(b.valid),
 			size(b.size), flags(b.flags), data(b.data), mapped(b.mapped),
 			mapPointer(b.mapPointer), mapOffset(b.mapOffset),
-			mapLength(b.mapLength) { }
+			mapLength(b.mapLength), drawFrame(b.drawFrame) { }
 
 		inline void clear() 
 		{
@@ -240,6 +755,7 @@ protected:
 			mapPointer = nullptr;
 			mapOffset = 0;
 			mapLength = 0;
+			drawFrame = 0;
 		}
 
 		bool operator==(const Buffer_t& rhs) const {
@@ -262,9 +778,635 @@ protected:
 		void* mapPointer;
 		int64_t mapOffset;
 		int64_t mapLength;
+		uint drawFrame;		// last frame + 1 a draw read it (0 : never)
 		// todo: other stuff to check
 	}; typedef Vector<Buffer_t> Buffer_v;
 
+	/** a mapped buffer (glMapBufferOES/glMapBufferRangeEXT) */
+	struct Mapping_t {
+		Mapping_t() : file(nullptr), line(-1), access(0), offset(0),
+			length(0) {}
+
+		const char* file;		// map call site
+		int line;
+		GLbitfield access;		// GL_MAP_XXX_BIT_EXT
+		int64_t offset;
+		int64_t length;
+		/** glFlushMappedBufferRangeEXT ranges (offset, length) */
+		Vector<std::pair<int64_t,int64_t> > flushed;
+	}; typedef Map<uint,Mapping_t> Mapping_m;
+
+	/** mappings of a call site since init */
+	struct MapSite_t {
+		MapSite_t() : maps(0), access(0), time(0), peakTime(0), syncs(0),
+			mapped(0), flushed(0), reflushed(0), unflushed(0),
+			failures(0) {}
+
+		uint64_t maps;
+		GLbitfield access;		// flags of the last map
+		uint64_t time;			// blocked in the map calls (ns)
+		uint64_t peakTime;
+		uint64_t syncs;			// synchronized maps of buffers in use
+		uint64_t mapped;		// bytes
+		uint64_t flushed;		// bytes (explicit flush)
+		uint64_t reflushed;		// bytes flushed more than once
+		uint64_t unflushed;		// bytes mapped and never flushed
+		uint64_t failures;		// glUnmapBufferOES returned GL_FALSE
+	}; typedef Map<hash_t,MapSite_t> MapSite_m;
+
+	/** where a glXXX function was called (file is the __FILE__ literal) */
+	struct CallSite_t {
+		CallSite_t() : file(nullptr), line(-1) {}
+		CallSite_t(const char* file, int line) : file(file), line(line) {}
+
+		const char* file;
+		int line;
+	}; typedef Map<hash_t,CallSite_t> CallSite_m;
+
+	/** entry points moving client data to the driver */
+	enum Upload_e {
+		UPLOAD_BUFFER_DATA = 0,
+		UPLOAD_BUFFER_SUB_DATA,
+		UPLOAD_TEX_IMAGE_2D,
+		UPLOAD_TEX_SUB_IMAGE_2D,
+		UPLOAD_COMPRESSED_TEX_IMAGE_2D,
+		UPLOAD_COMPRESSED_TEX_SUB_IMAGE_2D,
+		UPLOAD_TEX_IMAGE_3D,
+		UPLOAD_TEX_SUB_IMAGE_3D,
+		UPLOAD_COMPRESSED_TEX_IMAGE_3D,
+		UPLOAD_COMPRESSED_TEX_SUB_IMAGE_3D,
+		UPLOAD_CLIENT_INDICES,		// glDrawElements without element buffer
+		UPLOAD_CLIENT_VERTICES,		// attributes without array buffer
+		UPLOAD_MAP_BUFFER,			// written through a mapped buffer
+		UPLOAD_SIZE
+	};
+
+	/** bytes uploaded by an entry point or a call site */
+	struct Upload_t {
+		Upload_t() : kind(UPLOAD_SIZE), site(0), calls(0), bytes(0),
+			frameCalls(0), frameBytes(0), lastFrameCalls(0),
+			lastFrameBytes(0), peakBytes(0) {}
+
+		uint kind;
+		hash_t site;			// call site (0 : entry point total)
+		uint64_t calls;			// since init
+		uint64_t bytes;			// since init
+		uint64_t frameCalls;	// current frame
+		uint64_t frameBytes;	// current frame
+		uint64_t lastFrameCalls;// last complete frame
+		uint64_t lastFrameBytes;// last complete frame
+		uint64_t peakBytes;		// biggest frame
+
+		inline void add(uint64_t size)
+		{
+			++calls;
+			++frameCalls;
+			bytes += size;
+			frameBytes += size;
+		}
+
+		inline void endFrame()
+		{
+			lastFrameCalls = frameCalls;
+			lastFrameBytes = frameBytes;
+			if (frameBytes > peakBytes)
+				peakBytes = frameBytes;
+			frameBytes = 0;
+			frameCalls = 0;
+		}
+	}; typedef Map<hash_t,Upload_t> Upload_m;
+
+	/** part of an object written by an upload (buffers : x is the
+	 * offset and w the size, textures : level is face << 8 | level) */
+	struct UploadRange_t {
+		UploadRange_t(uint kind, uint id, uint level, uint64_t x,
+			uint64_t y, uint64_t w, uint64_t h) : kind(kind), id(id),
+			level(level), x(x), y(y), w(w), h(h) {}
+
+		bool operator<(const UploadRange_t& rhs) const {
+			if (kind != rhs.kind) return kind < rhs.kind;
+			if (id != rhs.id) return id < rhs.id;
+			if (level != rhs.level) return level < rhs.level;
+			if (x != rhs.x) return x < rhs.x;
+			if (y != rhs.y) return y < rhs.y;
+			if (w != rhs.w) return w < rhs.w;
+			return h < rhs.h;
+		};
+
+		inline bool overlaps(const UploadRange_t& r) const {
+			return level == r.level &&
+				x < r.x + r.w && r.x < x + w &&
+				y < r.y + r.h && r.y < y + h;
+		}
+
+		uint kind;	// SHADOW_BUFFER or SHADOW_TEXTURE
+		uint id;
+		uint level;
+		uint64_t x, y, w, h;
+	}; typedef Map<UploadRange_t,uint32_t> UploadHash_m;
+
+	/** glBufferData/glBufferSubData stream of a buffer */
+	struct BufferUsage_t {
+		BufferUsage_t() : usage(GL_NONE), dataCalls(0), subDataCalls(0),
+			orphans(0), implicitSyncs(0), framesWritten(0), firstFrame(0),
+			lastWriteFrame(INVALID_FRAME), lastDrawFrame(INVALID_FRAME),
+			staticFrame(0), staticWrites(0), drawnSinceOrphan(false),
+			staticWarned(false) {}
+
+		enum {
+			INVALID_FRAME = 0xFFFFFFFF,
+			/** GL_STATIC_DRAW misuse : STATIC_WRITES glBufferData within
+			 * STATIC_FRAMES frames */
+			STATIC_WRITES = 3,
+			STATIC_FRAMES = 8
+		};
+
+		GLenum usage;		// hint of the last glBufferData
+		uint dataCalls;		// glBufferData
+		uint subDataCalls;	// glBufferSubData
+		uint orphans;		// glBufferData on a buffer in use
+		uint implicitSyncs;	// glBufferSubData on a buffer in use
+		uint framesWritten;	// frames with at least one write
+		uint firstFrame;	// first glBufferData
+		uint lastWriteFrame;
+		uint lastDrawFrame;
+		uint staticFrame;	// first frame of the GL_STATIC_DRAW window
+		uint staticWrites;	// GL_STATIC_DRAW glBufferData in the window
+		bool drawnSinceOrphan;	// used by a draw since its storage changed
+		bool staticWarned;
+	}; typedef Map<uint,BufferUsage_t> BufferUsage_m;
+
+	/** lifetime of a gl object */
+	struct Object_t {
+		Object_t() : kind(OBJECT_SIZE), id(0), frame(0), site(0) {}
+
+		uint kind;		// OBJECT_XXX
+		uint id;
+		uint frame;		// frame of creation
+		hash_t site;	// call site of creation
+	}; typedef Map<uint64_t,Object_t> Object_m;
+
+	/** create/delete counters of a creation call site */
+	struct Churn_t {
+		Churn_t() : kind(OBJECT_SIZE), site(0), created(0), deleted(0),
+			sameFrame(0), shortLived(0), lifetime(0), frameCreated(0),
+			lastFrameCreated(0), peakFrameCreated(0) {}
+
+		uint kind;
+		hash_t site;
+		uint created;
+		uint deleted;
+		uint sameFrame;		// deleted in the frame of creation
+		uint shortLived;	// deleted within the churn threshold
+		uint64_t lifetime;	// sum of the lifetimes in frames
+		uint frameCreated;	// current frame
+		uint lastFrameCreated;
+		uint peakFrameCreated;
+	}; typedef Map<hash_t,Churn_t> Churn_m;
+
+	/** live objects of a creation call site */
+	struct LiveSite_t {
+		LiveSite_t() : kind(OBJECT_SIZE), site(0), count(0), memory(0),
+			firstFrame(0) {}
+
+		uint kind;
+		hash_t site;
+		uint count;
+		uint64_t memory;	// estimated resident memory
+		uint firstFrame;	// oldest object
+		Vector<uint> ids;
+	}; typedef Map<hash_t,LiveSite_t> LiveSite_m;
+
+	/** last value sent per uniform (program << 32 | location) */
+	typedef Map<uint64_t,Vector<uchar> > Uniform_m;
+	/** uniform location per (program << 32 | interned name) */
+	typedef Map<uint64_t,GLint> UniformLocation_m;
+
+	/** array element behind a uniform location (program << 32 |
+	 * location) */
+	struct UniformElement_t {
+		UniformElement_t() : base(-1), element(0) {}
+
+		GLint base;		// location of the element 0
+		uint element;
+	}; typedef Map<uint64_t,UniformElement_t> UniformElement_m;
+	/** element locations of an array (program << 32 | base location) */
+	typedef Map<uint64_t,Vector<GLint> > UniformArray_m;
+
+	/** glGetUniformLocation calls of a call site */
+	struct LocationSite_t {
+		LocationSite_t() : site(0), calls(0), cached(0), frames(0),
+			lastFrame(0), time(0) {}
+
+		hash_t site;
+		uint calls;
+		uint cached;	// answered by the location cache
+		uint frames;	// frames with at least one call
+		uint lastFrame;
+		uint64_t time;	// nanoseconds spent in the lookups
+	}; typedef Map<hash_t,LocationSite_t> LocationSite_m;
+
+	/** compiles of a shader source (keyed by source hash) */
+	struct ShaderSource_t {
+		ShaderSource_t() : hash(0), site(0), compiles(0), time(0) {}
+
+		uint64_t hash;
+		hash_t site;	// call site of the first compile
+		uint compiles;
+		uint64_t time;	// nanoseconds in glCompileShader
+	}; typedef Map<uint64_t,ShaderSource_t> ShaderSource_m;
+
+	/** link and first draw of a program */
+	struct ProgramPrep_t {
+		ProgramPrep_t() : site(0), links(0), linkTime(0), firstUse(false),
+			firstUseTime(0) {}
+
+		hash_t site;	// call site of the last link
+		uint links;
+		uint64_t linkTime;		// nanoseconds in glLinkProgram
+		bool firstUse;			// linked, not drawn yet
+		uint64_t firstUseTime;	// nanoseconds of the first draw
+	}; typedef Map<uint,ProgramPrep_t> ProgramPrep_m;
+
+	/** what a link depends on : attached shaders and attribute bindings */
+	struct ProgramInputs_t {
+		Vector<uint> shaders;
+		Map<String,GLuint> attribs;	// glBindAttribLocation, last one wins
+	}; typedef Map<uint,ProgramInputs_t> ProgramInputs_m;
+
+	/** header of a program binary cache file */
+	struct ProgramBinaryHeader_t {
+		uint32_t magic;
+		uint32_t version;
+		uint32_t driver;	// hash of vendor/renderer/version strings
+		uint32_t inputs;	// 64 bits link inputs following the header
+		uint32_t format;	// binaryFormat of glGetProgramBinaryOES
+		uint32_t length;
+	};
+
+	/** duration of a wrapped entry point (keyed by function name) */
+	struct CallTiming_t {
+		CallTiming_t() : api(nullptr), name(nullptr), sync(false),
+			category(0), calls(0), mean(0), deviation(0), max(0), total(0),
+			outliers(0) {}
+
+		const char* api;	// "gl" or "egl"
+		const char* name;
+		bool sync;			// known to wait for the gpu / flush
+		uint category;		// Call_e
+		uint64_t calls;
+		double mean;		// rolling baseline (ns)
+		double deviation;	// rolling mean deviation (ns)
+		uint64_t max;
+		uint64_t total;
+		uint outliers;		// calls far above the baseline
+	}; typedef Map<const char*,CallTiming_t> CallTiming_m;
+
+	enum Call_e {
+		CALL_OTHER = 0,
+		CALL_DRAW,
+		CALL_STATE
+	};
+
+	/** a call above the stall threshold and the calls before it */
+	struct Stall_t {
+		Stall_t() : frame(0), site(0), time(0), baseline(0), sync(false) {}
+
+		uint frame;
+		String call;
+		hash_t site;
+		uint64_t time;
+		uint64_t baseline;
+		bool sync;
+		Vector<String> history;
+	}; typedef Vector<Stall_t> Stall_v;
+
+	enum Gpu_e {
+		GPU_READBACK_FRAMES = 3,	// frames before reading a timing
+		GPU_QUERY_BATCH = 64,		// queries generated at once
+		GPU_QUERIES = 4096,			// pool limit
+		GPU_FRAMES = 64				// frame times kept
+	};
+
+	/** a gpu timing : two timestamps (or one GL_TIME_ELAPSED_EXT query) */
+	struct GpuQuery_t {
+		GpuQuery_t() : begin(0), end(0), frame(0), key(0) {}
+
+		uint begin;		// query id (0 : not timed)
+		uint end;		// query id (0 with GL_TIME_ELAPSED_EXT)
+		uint frame;
+		hash_t key;		// entry in _gpu_sites
+	}; typedef Vector<GpuQuery_t> GpuQuery_v;
+
+	/** gpu time per frame, debug group or draw call site */
+	struct GpuSite_t {
+		GpuSite_t() : level(GPU_PROFILING_OFF), count(0), total(0), max(0),
+			frame(0), frameTime(0) {}
+
+		uint level;
+		String name;
+		uint64_t count;
+		uint64_t total;
+		uint64_t max;
+		uint frame;			// last frame read back
+		uint64_t frameTime;	// time during this frame
+	}; typedef Map<hash_t,GpuSite_t> GpuSite_m;
+
+	/** gpu time of a frame */
+	struct GpuFrame_t {
+		GpuFrame_t() : frame(~0u), time(0), draws(0) {}
+
+		uint frame;
+		uint64_t time;		// whole frame (0 : not read back)
+		uint64_t draws;		// sum of the timed draws
+	};
+
+	/** a GL_KHR_debug message id (keyed by source << 32 | id) */
+	struct DebugMessage_t {
+		DebugMessage_t() : source(0), type(0), severity(0), id(0), count(0),
+			suppressed(0), frame(0), frameCount(0), site(0) {}
+
+		GLenum source;
+		GLenum type;
+		GLenum severity;
+		GLuint id;
+		uint64_t count;
+		uint64_t suppressed;	// above DEBUG_MESSAGES_PER_FRAME
+		uint frame;
+		uint frameCount;
+		hash_t site;			// last call site
+		String text;			// last message
+	}; typedef Map<uint64_t,DebugMessage_t> DebugMessage_m;
+
+	/** blend/depth/stencil/raster state set by glBlendXXX, glDepthXXX,
+	 * glStencilXXX, ... */
+	struct RenderState_t {
+		RenderState_t() : blendSrcRGB(GL_ONE), blendDstRGB(GL_ZERO),
+			blendSrcAlpha(GL_ONE), blendDstAlpha(GL_ZERO),
+			blendModeRGB(GL_FUNC_ADD), blendModeAlpha(GL_FUNC_ADD),
+			depthFunc(GL_LESS), depthMask(GL_TRUE), colorMask(0xF),
+			cullFace(GL_BACK), frontFace(GL_CCW), polygonFactor(0.0f),
+			polygonUnits(0.0f), caps(0)
+		{
+			for (uint i = 0; i < 4; ++i)
+			{
+				viewport[i] = 0;
+				scissor[i] = 0;
+			}
+
+			for (uint i = 0; i < 2; ++i)
+			{
+				stencilFunc[i] = GL_ALWAYS;
+				stencilRef[i] = 0;
+				stencilValueMask[i] = ~0u;
+				stencilWriteMask[i] = ~0u;
+				stencilFail[i] = GL_KEEP;
+				stencilZFail[i] = GL_KEEP;
+				stencilZPass[i] = GL_KEEP;
+			}
+		}
+
+		uint32_t blendSrcRGB;
+		uint32_t blendDstRGB;
+		uint32_t blendSrcAlpha;
+		uint32_t blendDstAlpha;
+		uint32_t blendModeRGB;
+		uint32_t blendModeAlpha;
+		uint32_t depthFunc;
+		uint32_t depthMask;
+		uint32_t colorMask;		// rgba bits
+		uint32_t cullFace;
+		uint32_t frontFace;
+		int32_t viewport[4];		// x, y, width, height
+		int32_t scissor[4];		// x, y, width, height
+		uint32_t stencilFunc[2];	// front, back
+		int32_t stencilRef[2];
+		uint32_t stencilValueMask[2];
+		uint32_t stencilWriteMask[2];
+		uint32_t stencilFail[2];
+		uint32_t stencilZFail[2];
+		uint32_t stencilZPass[2];
+		float polygonFactor;
+		float polygonUnits;
+		uint32_t caps;			// glEnable caps (bits, getRenderStateHash())
+	};
+
+	/** a draw call and the state it used */
+	struct Draw_t {
+		Draw_t() : site(0), program(0), framebuffer(0), textures(0),
+			state(0), layout(0), pointers(0), elementBuffer(0), mode(0),
+			type(0), count(0), offset(0), uniforms(0), blend(false) {}
+
+		/** same state : the draws could be submitted as one */
+		inline bool sameBatch(const Draw_t& rhs) const
+		{
+			return program == rhs.program &&
+				framebuffer == rhs.framebuffer &&
+				textures == rhs.textures && state == rhs.state &&
+				layout == rhs.layout && elementBuffer == rhs.elementBuffer &&
+				mode == rhs.mode && type == rhs.type;
+		}
+
+		hash_t site;
+		uint program;
+		uint framebuffer;
+		uint32_t textures;		// hash of the bound textures
+		uint32_t state;			// hash of RenderState_t
+		uint32_t layout;		// hash of the attributes (without offsets)
+		uint32_t pointers;		// hash of the attribute offsets
+		uint elementBuffer;
+		GLenum mode;
+		GLenum type;			// 0 : glDrawArrays
+		uint count;
+		uint64_t offset;		// first vertex or index offset (bytes)
+		uint uniforms;			// glUniformXXX calls since the last draw
+		bool blend;
+	}; typedef Vector<Draw_t> Draw_v;
+
+	enum Batch_e {
+		BATCH_MERGE = 0,	// contiguous ranges, no uniform change
+		BATCH_INSTANCING,	// same geometry, uniforms change
+		BATCH_BASE_VERTEX,	// same layout, other attribute offsets
+		BATCH_MULTI_DRAW,	// other ranges of the same buffers
+		BATCH_SIZE
+	};
+
+	/** consecutive draws of the last frame that could be batched */
+	struct BatchRun_t {
+		BatchRun_t() : first(0), draws(0), kind(BATCH_SIZE) {}
+
+		uint first;		// index in _draws_last_frame
+		uint draws;
+		uint kind;		// Batch_e
+	}; typedef Vector<BatchRun_t> BatchRun_v;
+
+	/** a debug group (or event marker) of the current frame, the same
+	 * name under the same parent is merged */
+	struct Zone_t {
+		Zone_t() : parent(0), depth(0), marker(false), count(0), start(0),
+			time(0), calls(0), callTime(0), draws(0), states(0),
+			bytes(0) {}
+
+		String name;
+		uint parent;		// index in the frame tree
+		uint depth;
+		bool marker;		// glInsertEventMarkerEXT
+		uint count;			// pushes during the frame
+		uint64_t start;		// Core::now() of the last push
+		uint64_t time;		// push to pop, children included
+		// calls made directly in the zone
+		uint calls;
+		uint64_t callTime;
+		uint draws;
+		uint states;
+		uint64_t bytes;
+	}; typedef Vector<Zone_t> Zone_v;
+
+	/** times the driver call of a wrapper (TRACE_CALL), accounted at the
+	 * end of scope : the debugger's own work is not part of it */
+	class CallTimer {
+	public:
+		inline CallTimer(const char* api, const char* name,
+			const char* file, int line) :
+			_api(api), _name(name), _file(file), _line(line), _time(0),
+			_timed(false)
+		{
+			// driver messages are tagged with the call in progress
+			gl::_call_file = file;
+			gl::_call_line = line;
+		}
+		inline ~CallTimer()
+		{
+			// answered by the debugger : no driver time
+			if (_timed)
+				gl::addCallTime(_api, _name, _time, _file, _line);
+		}
+
+		/** "function" called through the timer */
+		template <typename F>
+		class Call {
+		private:
+			CallTimer& _timer;
+			F _function;
+
+			struct Scope {
+				inline Scope(CallTimer& timer) :
+					timer(timer), start(Core::now()) {}
+				inline ~Scope()
+				{
+					timer._time += Core::now() - start;
+					timer._timed = true;
+				}
+
+				CallTimer& timer;
+				uint64_t start;
+			};
+
+		public:
+			inline Call(CallTimer& timer, F function) :
+				_timer(timer), _function(function) {}
+
+			template <typename... A>
+			inline auto operator()(A... args) -> decltype(_function(args...))
+			{
+				Scope scope(_timer);
+				return _function(args...);
+			}
+		};
+
+		template <typename F>
+		inline Call<F> time(F function) { return Call<F>(*this, function); }
+
+	private:
+		const char* _api;
+		const char* _name;
+		const char* _file;
+		int _line;
+		uint64_t _time;
+		bool _timed;
+	};
+
+	enum VertexAttrib_id {
+		VERTEX_ATTRIBS = 16	// GL_MAX_VERTEX_ATTRIBS is at least 8
+	};
+
+	/** vertex attribute binding (glVertexAttribPointer) */
+	struct VertexAttrib_t {
+		VertexAttrib_t() : enabled(0), size(4), type(GL_FLOAT),
+			normalized(0), stride(0), buffer(0), detached(0),
+			pointer(nullptr), maxVertex(-1) {}
+
+		uchar enabled;
+		GLint size;
+		GLenum type;
+		uchar normalized;
+		GLsizei stride;
+		uint buffer;			// 0 : client memory
+		uchar detached;			// buffer deleted : "pointer" is an offset
+		const void* pointer;	// offset when buffer != 0
+		int64_t maxVertex;		// last vertex readable (-1 : none)
+	};
+
+	/** vertex attributes and the vertex limit they allow (the default
+	 * or a GL_OES_vertex_array_object one) */
+	struct VertexArray_t {
+		VertexArray_t() : dirty(1), maxVertex(-1),
+			limitAttrib(VERTEX_ATTRIBS), generation(0), elementBuffer(0),
+			layoutDirty(1), layout(0), pointers(0) {}
+
+		VertexAttrib_t attribs[VERTEX_ATTRIBS];
+		/** attributes or their buffers changed since the last check */
+		uchar dirty;
+		/** last vertex readable by all the enabled attributes */
+		int64_t maxVertex;
+		/** attribute giving "maxVertex" */
+		uint limitAttrib;
+		/** _vertex_buffer_generation of the last check */
+		uint generation;
+		/** element array buffer bound with the array */
+		uint elementBuffer;
+		/** attributes changed since the draw stream hashes */
+		uchar layoutDirty;
+		/** draw stream hashes of the attributes, with and without the
+		 * offsets (Draw_t) */
+		uint32_t layout;
+		uint32_t pointers;
+	}; typedef Map<uint,VertexArray_t> VertexArray_m;
+
+	/** indices read by a glDrawElements from an element array buffer */
+	struct IndexRange_t {
+		IndexRange_t(uint buffer, GLenum type, uint64_t offset,
+			GLsizei count) : buffer(buffer), type(type), offset(offset),
+			count(count) {}
+
+		bool operator<(const IndexRange_t& rhs) const {
+			if (buffer != rhs.buffer) return buffer < rhs.buffer;
+			if (type != rhs.type) return type < rhs.type;
+			if (offset != rhs.offset) return offset < rhs.offset;
+			return count < rhs.count;
+		};
+
+		uint buffer;
+		GLenum type;
+		uint64_t offset;
+		GLsizei count;
+	}; typedef Map<IndexRange_t,uint> IndexRange_m;
+
+	/** shadow store entry kinds */
+	enum Shadow_e {
+		SHADOW_BUFFER = 1,
+		SHADOW_TEXTURE,
+		SHADOW_SNAPSHOT
+	};
+
+	/** resident memory kinds */
+	enum Memory_e {
+		MEMORY_TEXTURE = 0,
+		MEMORY_BUFFER,
+		MEMORY_RENDERBUFFER,
+		MEMORY_SIZE
+	};
+
 	// -----------------------------------------------------------------
 	// functions
 	// -----------------------------------------------------------------
@@ -363,6 +1505,315 @@ protected:
 		return _bound_buffer[ELEMENT_ARRAY_BUFFER];
 	}
 
+	/** a buffer of local "target" was mapped (unmapped) */
+	static void beginMapping(uint target, int64_t offset, int64_t length,
+		GLbitfield access, void* pointer, uint64_t time, const char* file,
+		int line);
+	static void flushMapping(uint target, int64_t offset, int64_t length);
+	static void endMapping(uint target, GLboolean result);
+	/** mark the buffers read by a draw, error message if one is mapped */
+	static const char* checkMappedBuffers(bool elements);
+
+	/** return the id of a call site (file@line), register it if needed */
+	static hash_t getCallSite(const char* file, int line);
+	/** format a call site as "path/file@line" */
+	static String getCallSiteName(hash_t site);
+	/** format a size in B, KB or MB */
+	static String formatBytes(uint64_t bytes);
+
+	/** number of bytes read from client memory by glTexImage2D/3D... */
+	static uint64_t getImageSize(GLsizei width, GLsizei height,
+		GLsizei depth, GLenum format, GLenum type);
+	/** return the glXXX name of an upload entry point */
+	static const char* getUploadName(uint kind);
+	/** client array kinds, counted apart from the uploaded bytes */
+	static inline bool isClientArray(uint kind)
+	{
+		return kind == UPLOAD_CLIENT_INDICES ||
+			kind == UPLOAD_CLIENT_VERTICES;
+	}
+	/** account bytes sent through an upload entry point */
+	static void addUpload(uint kind, uint64_t bytes,
+		const char* file, int line);
+	/** close the upload counters of the current frame (gl::reset()) */
+	static void endFrameUploads();
+	/** bytes read from client memory by the enabled attributes for
+	 * "vertices" vertices */
+	static uint64_t getClientArraySize(uint vertices);
+	/** account a client array copy, warn once per call site */
+	static void addClientArray(uint kind, uint64_t bytes,
+		const char* file, int line);
+	/** compare the payload of an upload with the last one written to the
+	 * same range, "data" == nullptr : content unknown. a new storage
+	 * (glBufferData, glTexImage2D...) forgets the other ranges of the
+	 * buffer / texture level */
+	static void checkRedundantUpload(uint kind, const UploadRange_t& range,
+		const void* data, uint64_t bytes, const char* file, int line);
+	/** forget the upload hashes of an object (deleted, mapped, ...) */
+	static void invalidateUploadHashes(uint kind, uint id);
+	/** track the glBufferData/glBufferSubData stream of a buffer */
+	static void addBufferData(uint id, GLenum usage, const char* file,
+		int line);
+	static void addBufferSubData(uint id, const char* file, int line);
+	/** mark the buffers read by a draw call as in use */
+	static void setBuffersDrawn(bool elements);
+	/** ratio of frames (since the first glBufferData) with a write */
+	static float getBufferWriteFrequency(const BufferUsage_t& usage);
+	/** return the name of an object kind */
+	static const char* getObjectName(uint kind);
+	/** start/end the lifetime of an object */
+	static void addObject(uint kind, uint id, const char* file, int line);
+	static void removeObject(uint kind, uint id, const char* file,
+		int line);
+	/** close the churn counters of the current frame (gl::reset()) */
+	static void endFrameObjects();
+	/** estimated resident memory of an object */
+	static uint64_t getObjectMemory(const Object_t& object);
+	/** group the live objects created since "sinceFrame" by call site */
+	static void getLiveSites(uint sinceFrame, LiveSite_m& sites);
+	/** compare "count" uniform values of "size" bytes with the last ones
+	 * sent to the bound program, return false if they are the same (one
+	 * value per array element, at the locations of setUniformLocations) */
+	static bool addUniform(GLint location, const void* data, uint size,
+		GLsizei count, const char* file, int line);
+	/** forget the uniform values and locations of a program (link,
+	 * delete) */
+	static void releaseUniforms(uint program);
+	/** interned id of a uniform name */
+	static uint getUniformNameId(const char* name);
+	/** read the locations of the active uniforms of a linked program */
+	static void setUniformLocations(uint program);
+	/** account a glGetUniformLocation call, warn once per call site
+	 * called in more than one frame */
+	static void addLocationQuery(uint64_t time, bool cached,
+		const char* file, int line);
+	/** account shader preparation time to the current frame */
+	static void addShaderTime(uint64_t time);
+	/** program bound waiting for its first draw (nullptr if none) */
+	static ProgramPrep_t* getFirstUseProgram();
+	/** account the first draw of a program (deferred compile/link) */
+	static void setFirstUse(ProgramPrep_t* prep, uint64_t time);
+	/** close the shader counters of the current frame (gl::reset()) */
+	static void endFrameShaders();
+	/** link inputs of a program : sorted source hashes and attribute
+	 * bindings (false if a source is unknown) */
+	static bool getProgramBinaryInputs(uint program,
+		Vector<uint64_t>& inputs);
+	/** cache file of link inputs */
+	static String getProgramBinaryPath(const Vector<uint64_t>& inputs);
+	/** header and link inputs of a cache file of this driver (false if
+	 * the file is not one) */
+	static bool readProgramBinaryHeader(FILE* fp,
+		ProgramBinaryHeader_t& header, Vector<uint64_t>& inputs);
+	/** link "program" from the cache, false on a miss ("time" : driver
+	 * time of the binary load) */
+	static bool loadProgramBinary(uint program,
+		const Vector<uint64_t>& inputs, uint64_t& time);
+	/** store the binary of a linked program (not over the file of other
+	 * link inputs) */
+	static void saveProgramBinary(uint program,
+		const Vector<uint64_t>& inputs);
+	/** entry points known to wait for the gpu or flush the driver */
+	static bool isSyncCall(const char* name);
+	/** draw, state change or other (Call_e) */
+	static uint getCallCategory(const char* name);
+	/** account the duration of a wrapped call (CallTimer), "api" : "gl"
+	 * or "egl" */
+	static void addCallTime(const char* api, const char* name,
+		uint64_t time, const char* file, int line);
+	/** capture the call history before a stall */
+	static void addStall(const CallTiming_t& timing, uint64_t time,
+		uint64_t baseline, const char* file, int line);
+	/** take a query from the pool (0 if the pool is exhausted) */
+	static uint getGpuQuery();
+	/** start a gpu timing, "name" is used by the first timing of "key" */
+	static GpuQuery_t beginGpuQuery(uint level, hash_t key,
+		const String& name);
+	/** stop a gpu timing, the results are read by endFrameGpu() */
+	static void endGpuQuery(GpuQuery_t& query);
+	/** give back the queries of a timing */
+	static void releaseGpuQuery(GpuQuery_t& query);
+	/** key/name of a draw call site */
+	static GpuQuery_t beginGpuDraw(const char* call, const char* file,
+		int line);
+	/** open/close a debug group */
+	static void pushGpuGroup(GLsizei length, const GLchar* message);
+	static void popGpuGroup();
+	/** account a gpu time read back */
+	static void addGpuTime(const GpuQuery_t& query, uint64_t time);
+	/** close the frame timing, read the finished queries and start the
+	 * next frame timing (gl::reset()) */
+	static void endFrameGpu();
+	/** GL_KHR_debug callback installed by setDebugOutput() */
+	static void GL_APIENTRY debugCallback(GLenum source, GLenum type,
+		GLuint id, GLenum severity, GLsizei length, const GLchar* message,
+		const void* userParam);
+	/** account a driver message, rate limited per id */
+	static void addDebugMessage(GLenum source, GLenum type, GLuint id,
+		GLenum severity, const String& message);
+	/** open a zone under the current one (merged by name) */
+	static void pushZone(GLsizei length, const GLchar* name, bool marker);
+	/** close the current zone */
+	static void popZone();
+	/** account a wrapped call to the current zone */
+	static void addZoneCall(const CallTiming_t& timing, uint64_t time);
+	/** close the frame tree, keep it for the report and reopen the
+	 * zones still open in a new tree (gl::reset()) */
+	static void endFrameZones();
+	/** hash of the render state (updated when dirty) */
+	static uint32_t getRenderStateHash();
+	/** hash of the textures bound on all units (updated when dirty) */
+	static uint32_t getTextureSetHash();
+	/** add a draw to the stream of the frame, "type" 0 for glDrawArrays */
+	static void addDraw(GLenum mode, GLenum type, uint64_t offset,
+		GLsizei count, const char* file, int line);
+	/** how a run of draws [first, last[ could be batched (Batch_e) */
+	static uint getBatchKind(const Draw_v& draws, uint first, uint last);
+	/** keep the draw stream of the frame and find the batch candidates
+	 * (gl::reset()) */
+	static void endFrameDraws();
+	/** state changes per dimension of draws submitted in "order" */
+	static void countStateChanges(const Draw_v& draws,
+		const Vector<uint>& order, uint changes[STATE_SIZE]);
+
+	/** return a registered texture or nullptr */
+	static Texture_t* getTexture(uint id);
+	/** return the texture bound to "target" on the active unit, "target"
+	 * can be a cube map face */
+	static Texture_t* getBoundTexture(GLenum target);
+	/** opengl target to local target (TEXTURE_TARGET_SIZE if unknown) */
+	static uint getTextureTarget(GLenum target);
+	/** cube map face of an opengl target (0 for others) */
+	static uint getTextureFace(GLenum target);
+	/** number of components of an unsized format (GL_RGB, ...) */
+	static uint getFormatComponents(GLenum format);
+	/** bytes per texel of a format (sized or format+type), 0 if unknown */
+	static uint64_t getTexelSize(GLenum internalformat, GLenum type);
+	/** bytes of a compressed image, 0 if not a known compressed format */
+	static uint64_t getCompressedSize(GLenum internalformat,
+		GLsizei width, GLsizei height, GLsizei depth);
+	/** estimated resident size of a texture level */
+	static uint64_t getLevelSize(GLenum internalformat, GLenum type,
+		GLsizei width, GLsizei height, GLsizei depth);
+	/** set the size of a level of the bound texture */
+	static void setTextureLevel(GLenum target, GLint level,
+		GLenum internalformat, GLenum type, GLsizei width, GLsizei height,
+		GLsizei depth, uint64_t bytes);
+	/** set the whole mipmap chain of the bound texture (glTexStorage) */
+	static void setTextureStorage(GLenum target, GLsizei levels,
+		GLenum internalformat, GLsizei width, GLsizei height,
+		GLsizei depth);
+	/** fill the mipmap chain of the bound texture (glGenerateMipmap) */
+	static void setTextureMipmaps(GLenum target);
+
+	/** (un)register renderbuffer */
+	static bool register_renderbuffer(uint id);
+	static bool unregister_renderbuffer(uint id);
+	/** return a registered renderbuffer or nullptr */
+	static Renderbuffer_t* getRenderbuffer(uint id);
+	/** set the storage of the bound renderbuffer */
+	static void setRenderbufferStorage(GLenum internalformat,
+		GLsizei samples, GLsizei width, GLsizei height);
+	/** (un)register framebuffer */
+	static bool register_framebuffer(uint id);
+	static bool unregister_framebuffer(uint id);
+	/** return a registered framebuffer or nullptr */
+	static Framebuffer_t* getFramebuffer(uint id);
+	/** attachment point to local index (ATTACHMENT_SIZE if unknown) */
+	static uint getAttachmentIndex(GLenum attachment);
+	/** attach an image to the bound framebuffer (id 0 : detach) */
+	static void setAttachment(GLenum attachment, GLenum kind, uint id,
+		GLint level, GLenum textarget);
+	/** detach a deleted texture/renderbuffer from the bound framebuffer */
+	static void detachObject(GLenum kind, uint id);
+	/** an attached image was re-specified or deleted */
+	static void setFramebuffersDirty(GLenum kind, uint id);
+	/** format and size of an attached image (false if unknown) */
+	static bool getAttachmentImage(const Attachment_t& attachment,
+		GLenum& format, GLsizei& width, GLsizei& height);
+	/** completeness of a framebuffer : cached per attachment
+	 * configuration, the driver is only asked for new ones
+	 * (0 : unknown, the framebuffer is not bound) */
+	static GLenum getFramebufferStatus(Framebuffer_t& framebuffer);
+	/** error message if the bound framebuffer is incomplete */
+	static const char* checkFramebuffer();
+	/** bytes of an attached image (samples included, 0 if unknown) */
+	static uint64_t getAttachmentBytes(const Attachment_t& attachment);
+	/** render pass of the bound framebuffer (opened on first use) */
+	static RenderPass_t& getPass();
+	/** decide the loads/stores of the open pass and keep it */
+	static void endPass();
+	/** glClear, draw, glDiscardFramebufferEXT in the open pass */
+	static void addPassClear(GLbitfield mask);
+	static void addPassDraw();
+	static void addPassDiscard(GLsizei count, const GLenum* attachments);
+	/** glStartTilingQCOM/glEndTilingQCOM : a pass with explicit
+	 * load/store masks */
+	static void startPassTiling(GLbitfield preserveMask);
+	static void endPassTiling(GLbitfield preserveMask);
+	/** close the passes of the frame and find the needless loads/stores
+	 * (gl::reset()) */
+	static void endFramePasses();
+	/** area of the union of "rects" clipped to the surface */
+	static uint64_t getRectsArea(const Rect_v& rects, GLsizei width,
+		GLsizei height);
+	/** add the area written by a draw or a clear on the default
+	 * framebuffer */
+	static void addRenderedRect(bool clear);
+	/** egl rects (x, y, width, height) */
+	static void getRects(const EGLint* rects, EGLint count, Rect_v& out);
+	/** eglSetDamageRegionKHR : where the frame may render */
+	static void setDamageRegion(const EGLint* rects, EGLint count);
+	/** check the damage of a swap against the frame rendering and the
+	 * buffer age (before the swap) */
+	static void addDamage(EGLDisplay dpy, EGLSurface surface,
+		const EGLint* rects, EGLint count);
+	/** forget the rendering of a frame presented without damage
+	 * (gl::reset()) */
+	static void endFrameDamage();
+
+	/** add (or remove) resident memory */
+	static void addMemory(uint kind, int64_t bytes);
+	/** return the name of a memory kind */
+	static const char* getMemoryName(uint kind);
+	/** close the memory deltas of the current frame (gl::reset()) */
+	static void endFrameMemory();
+
+	/** shadow store key : kind | id | face | level */
+	static ShadowStore::Key getShadowKey(uint kind, uint id,
+		uint face = 0, uint level = 0);
+	/** copy glBufferData/glBufferSubData data of a buffer */
+	static void shadowBufferData(uint id, uint64_t size, const void* data);
+	static void shadowBufferSubData(uint id, uint64_t offset,
+		uint64_t size, const void* data);
+	/** copy glTexImage2D/glTexSubImage2D pixels of the bound texture */
+	static void shadowTexImage(GLenum target, GLint level, GLsizei width,
+		GLsizei height, GLenum format, GLenum type, const void* pixels);
+	static void shadowTexSubImage(GLenum target, GLint level,
+		GLint xoffset, GLint yoffset, GLsizei width, GLsizei height,
+		GLenum format, GLenum type, const void* pixels);
+	/** drop the shadow copies of a texture (all faces and levels) */
+	static void releaseShadowTexture(uint id);
+
+	/** size of a registered buffer (0 if unknown) */
+	static uint64_t getBufferSize(uint id);
+	/** biggest index read by a glDrawElements from a buffer (cached),
+	 * false if the buffer content is unknown (shadowing disabled) */
+	static bool getMaxIndex(uint buffer, GLenum type, uint64_t offset,
+		GLsizei count, uint& maxIndex);
+	/** forget the index ranges of a buffer (content changed) */
+	static void invalidateIndexRanges(uint buffer);
+	/** check that every enabled attribute can read vertex "maxIndex" */
+	static bool checkVertexAttribs(uint maxIndex);
+	/** recompute the vertex limits of the attributes if dirty */
+	static void updateVertexLimits();
+	/** attributes using "buffer" must be checked again */
+	static void setVertexBufferDirty(uint buffer);
+	/** swap in the state of a vertex array object (0 : default) */
+	static void bindVertexArray(uint array);
+	/** GL_MAX_VERTEX_ATTRIBS (queried once) */
+	static GLint getMaxVertexAttribs();
+
 	/** send message to console */
 	static inline void setConsole(const String& buffer)
 	{
@@ -968,6 +2419,11 @@ protected:
 	static Buffer_v _buffers;
 	/** actual bound buffer */
 	static Buffer_t* _bound_buffer[BUFFER_SIZE];
+	/** mapped buffers, mappings per call site and draws reading a
+	 * mapped buffer */
+	static Mapping_m _mappings;
+	static MapSite_m _map_sites;
+	static uint _map_draws;
 	/** calls function history */
 	static History_cb _call_history;
 	/** actuel bound program */
@@ -997,6 +2453,231 @@ protected:
 	static uint frame; // frame id
 	/** console callback */
 	static fnc_console_cb _console_cb;
+	/** all call sites seen (id -> file@line) */
+	static CallSite_m _call_sites;
+	/** GL_UNPACK_ALIGNMENT (gl::PixelStorei) */
+	static GLint _unpack_alignment;
+	/** upload counters per entry point */
+	static Upload_t _uploads[UPLOAD_SIZE];
+	/** upload counters per call site */
+	static Upload_m _upload_sites;
+	/** uploaded bytes : current frame, last frame and since init */
+	static uint64_t _upload_frame;
+	static uint64_t _upload_last_frame;
+	static uint64_t _upload_total;
+	/** client array bytes : current frame, last frame and since init */
+	static uint64_t _client_frame;
+	static uint64_t _client_last_frame;
+	static uint64_t _client_total;
+	/** upload spike warning threshold (0 == disabled) */
+	static uint64_t _upload_spike_threshold;
+	/** redundant upload check state */
+	static bool _redundant_check;
+	/** last payload hash per written range */
+	static UploadHash_m _upload_hashes;
+	/** identical re-uploads : total and per call site */
+	static Upload_t _redundant_total;
+	static Upload_m _redundant_sites;
+	/** usage stream per buffer id */
+	static BufferUsage_m _buffer_usage;
+	/** live objects (kind << 32 | id) */
+	static Object_m _objects;
+	/** churn counters per creation call site */
+	static Churn_m _churn_sites;
+	/** lifetime (in frames) under which an object is churn */
+	static uint _churn_frames;
+	/** objects created : current frame and last frame */
+	static uint _objects_frame;
+	static uint _objects_last_frame;
+	/** uniform values per program and location */
+	static Uniform_m _uniforms;
+	/** uniform calls : all and redundant (total and per call site) */
+	static Upload_t _uniform_total;
+	static Upload_t _uniform_redundant;
+	static Upload_m _uniform_sites;
+	static Upload_m _uniform_redundant_sites;
+	/** uniform location cache state */
+	static bool _uniform_location_cache;
+	/** interned uniform names */
+	static Map<String,uint> _uniform_names;
+	/** uniform locations read at link time or from the driver */
+	static UniformLocation_m _uniform_locations;
+	/** array elements read at link time : the driver does not have to
+	 * give them consecutive locations */
+	static UniformElement_m _uniform_elements;
+	static UniformArray_m _uniform_arrays;
+	/** glGetUniformLocation counters per call site */
+	static LocationSite_m _location_sites;
+	/** driver lookups at link time : count and nanoseconds */
+	static uint _location_driver_calls;
+	static uint64_t _location_driver_time;
+	/** source hash per shader id (glShaderSource) */
+	static Map<uint,uint64_t> _shader_hashes;
+	/** compiles per source */
+	static ShaderSource_m _shader_sources;
+	/** link and first use per program */
+	static ProgramPrep_m _program_preps;
+	/** shader preparation time : frame 0, current, last, peak, total */
+	static uint64_t _shader_time_startup;
+	static uint64_t _shader_time_frame;
+	static uint64_t _shader_time_last_frame;
+	static uint64_t _shader_time_peak;
+	static uint64_t _shader_time_total;
+	/** link inputs per program */
+	static ProgramInputs_m _program_inputs;
+	/** program binary cache : directory, driver hash and counters */
+	static String _program_binary_dir;
+	static uint32_t _program_binary_driver;
+	static uint _program_binary_hits;
+	static uint _program_binary_misses;
+	static uint _program_binary_rejects;
+	static uint _program_binary_collisions;
+	/** duration per entry point */
+	static CallTiming_m _call_timings;
+	/** stall threshold (ns), last stalls and count since init */
+	static uint64_t _stall_threshold;
+	static Stall_v _stalls;
+	static uint _stall_count;
+	/** gpu profiling level, timestamps support and query pool */
+	static uint _gpu_profiling;
+	static bool _gpu_timestamps;
+	static Vector<uint> _gpu_queries;
+	static uint _gpu_query_count;
+	/** timings waiting for their results (oldest first) */
+	static GpuQuery_v _gpu_pending;
+	/** open debug groups and frame timing */
+	static GpuQuery_v _gpu_groups;
+	static GpuQuery_t _gpu_frame;
+	/** GL_TIME_ELAPSED_EXT query of the application is active */
+	static bool _gpu_app_elapsed;
+	static GpuSite_m _gpu_sites;
+	static GpuFrame_t _gpu_frames[GPU_FRAMES];
+	static uint64_t _gpu_last_frame_time;
+	/** timings dropped : disjoint events, exhausted pool */
+	static uint _gpu_disjoint;
+	static uint _gpu_dropped;
+	/** prefix of the wrapped entry points (TRACE_FUNCTION) */
+	static const char* const _api;
+	/** wrapped call in progress (CallTimer) */
+	static const char* _call_file;
+	static int _call_line;
+	/** debugger callback installed, errors read from the messages */
+	static bool _debug_output;
+	static bool _debug_errors;
+	/** error message of the call in progress (get_last_error()) */
+	static String _debug_error;
+	static bool _debug_has_error;
+	/** application callback (chained) */
+	static GLDEBUGPROCKHR _app_debug_callback;
+	static const void* _app_debug_param;
+	static DebugMessage_m _debug_messages;
+	static uint _debug_message_count;
+	static uint _debug_suppressed;
+	/** zone tree of the current frame (0 : frame) and of the last one */
+	static Zone_v _zones;
+	static Zone_v _zones_last_frame;
+	/** current zone and children per (name, parent) */
+	static uint _zone_current;
+	static Map<hash_t,uint> _zone_children;
+	/** self time per zone path since init */
+	static Map<String,uint64_t> _zone_folded;
+	/** render state, its hash and the bound textures hash */
+	static RenderState_t _render_state;
+	static uint32_t _render_state_hash;
+	static bool _render_state_dirty;
+	static uint32_t _texture_set_hash;
+	static bool _texture_set_dirty;
+	/** bound framebuffer (0 : default) */
+	static uint _bound_framebuffer;
+	/** draws of the frame and of the last one */
+	static Draw_v _draws;
+	static Draw_v _draws_last_frame;
+	static uint _draws_dropped;
+	/** glUniformXXX calls at the last draw */
+	static uint64_t _draw_uniform_calls;
+	/** batch candidates of the last frame */
+	static BatchRun_v _batch_runs;
+	static uint _batch_saved_last_frame;
+	/** cost of a change per StateDimension_e */
+	static uint _state_costs[STATE_SIZE];
+	/** active texture unit (gl::ActiveTexture) */
+	static uint _active_texture;
+	/** texture ids bound per unit and local target */
+	static uint _bound_texture[TEXTURE_UNITS][TEXTURE_TARGET_SIZE];
+	/** all registered renderbuffer */
+	static Renderbuffer_v _renderbuffers;
+	/** actual bound renderbuffer id */
+	static uint _bound_renderbuffer;
+	/** all registered framebuffer */
+	static Framebuffer_v _framebuffers;
+	/** completeness per attachment configuration, driver queries and
+	 * answers from the cache */
+	static Map<uint32_t,GLenum> _framebuffer_status;
+	static uint _framebuffer_status_queries;
+	static uint _framebuffer_status_hits;
+	/** render passes : open pass, passes of the frame and of the last
+	 * one */
+	static RenderPass_t _pass;
+	static bool _pass_open;
+	static RenderPass_v _passes;
+	static RenderPass_v _passes_last_frame;
+	static uint64_t _pass_bytes_last_frame;
+	static uint64_t _pass_needless_last_frame;
+	/** images holding a stored content at the end of the last frame */
+	static Map<uint64_t,bool> _pass_stored;
+	/** stores of the last frame not used yet in the frame (bytes per
+	 * image) and the needless ones settled in the last frame */
+	static Map<uint64_t,uint64_t> _pass_pending;
+	static uint64_t _pass_carried_last_frame;
+	/** default framebuffer size and bytes per pixel per attachment */
+	static GLsizei _default_width;
+	static GLsizei _default_height;
+	static uint _default_texel[ATTACHMENT_SIZE];
+	static bool _default_size_set;
+	/** viewport and scissor box */
+	static Rect_t _viewport;
+	static Rect_t _scissor;
+	/** damage : rendered rects and damage region of the frame */
+	static Rect_v _damage_rendered;
+	static Rect_v _damage_region;
+	static bool _damage_region_set;
+	/** damage of the last DAMAGE_AGES swaps (ring) */
+	static Rect_v _damage_history[DAMAGE_AGES];
+	static uint _damage_history_index;
+	/** last DAMAGE_FRAMES swaps with damage and the counters since init */
+	static DamageFrame_v _damage_frames;
+	static uint _damage_swaps;
+	static uint _damage_stale;
+	static uint _damage_outside_region;
+	static uint _damage_undeclared;
+	/** resident memory per kind */
+	static uint64_t _memory[MEMORY_SIZE];
+	/** resident memory per kind at the start of the frame */
+	static uint64_t _memory_frame_start[MEMORY_SIZE];
+	/** memory delta per kind of the last complete frame */
+	static int64_t _memory_last_delta[MEMORY_SIZE];
+	/** shadow store state */
+	static bool _shadowing;
+	/** buffer/texture contents */
+	static ShadowStore _shadow;
+	/** row size in bytes of the shadowed texture levels */
+	static Map<ShadowStore::Key,uint64_t> _shadow_rows;
+	/** last snapshot id */
+	static uint _shadow_snapshot;
+	/** vertex attributes */
+	static VertexArray_t _vertex_array;
+	/** state of the vertex array objects not bound (the bound slot is
+	 * stale) */
+	static VertexArray_m _vertex_arrays;
+	static uint _bound_vertex_array;
+	/** changes of buffers used by attributes, and the last change of
+	 * each buffer (stale vertex limits of the arrays not bound) */
+	static uint _vertex_buffer_generation;
+	static Map<uint,uint> _vertex_buffer_generations;
+	/** GL_MAX_VERTEX_ATTRIBS (0 : not queried yet) */
+	static GLint _max_vertex_attribs;
+	/** max index per glDrawElements index range */
+	static IndexRange_m _index_ranges;
 
 	// -----------------------------------------------------------------
 	// OpenGL/ES function (call it "the mess")
@@ -1012,6 +2693,9 @@ public:
 	public:
 		/** todo: all function in egl.h */
 
+		/** prefix of the wrapped entry points (hides gl::_api) */
+		static const char* const _api;
+
 		// all the define mess -----------------------------------------
 		static const char* is_define_egl_h(GLenum pname);
 		static const char* is_define_version_1_0(GLenum pname);
@@ -2369,7 +4053,7 @@ public:
 	static PFNGLFLUSHMAPPEDBUFFERRANGEEXTPROC gl_FlushMappedBufferRangeEXT;
 
 	#define glMapBufferRangeEXT(...) gl::MapBufferRangeEXT( __VA_ARGS__, __FILE__,__LINE__ )
-	static void MapBufferRangeEXT (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access, const char* file, int line);
+	static void* MapBufferRangeEXT (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access, const char* file, int line);
 	static PFNGLMAPBUFFERRANGEEXTPROC gl_MapBufferRangeEXT;
 
 	// GL_EXT_multi_draw_arrays
@@ -3432,7 +5116,7 @@ public:
 	static PFNGLGETBUFFERPOINTERVOESPROC gl_GetBufferPointervOES;
 
 	#define glMapBufferOES(...) gl::MapBufferOES( __VA_ARGS__, __FILE__,__LINE__ )
-	static void MapBufferOES (GLenum target, GLenum access, const char* file, int line);
+	static void* MapBufferOES (GLenum target, GLenum access, const char* file, int line);
 	static PFNGLMAPBUFFEROESPROC gl_MapBufferOES;
 
 	#define glUnmapBufferOES(...) gl::UnmapBufferOES( __VA_ARGS__, __FILE__,__LINE__ )
@@ -26,12 +26,14 @@
 // map class with your own with just one define.
 
 #include <stdarg.h>	// va_list, va_start, va_arg, va_end
+#include <stdint.h>	// uint64_t
 
 #include <iostream>	// std::cout
 #include <sstream>	// std::stringstream
 #include <string>	// std::string
 #include <vector>	// std::vector
 #include <map>		// std::map
+#include <chrono>	// std::chrono::steady_clock
 
 // type
 //#define String	std::string 
@@ -147,6 +149,12 @@ class Core
 {
 public:
 	static inline hash_t hash(const char* a) { return ::hash(a); }
+	/** monotonic clock in nanoseconds */
+	static inline uint64_t now()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
 }; // Core
 
 #endif // __MISCS_INCLUDE_H__
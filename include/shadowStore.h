@@ -0,0 +1,401 @@
+/*
+ * Simple OpenGL ES 2.0 debugger
+ *
+ *  Copyright (C) 2016 ESTEVE Olivier
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ */
+#ifndef __GLES2_DEBUGGER_SHADOW_STORE_INCLUDE_H__
+#define __GLES2_DEBUGGER_SHADOW_STORE_INCLUDE_H__
+
+#include <list>		// std::list
+#include <iterator>	// std::distance
+#include <set>		// std::set
+
+/**
+ * copy of client data sent to opengl (buffer/texture contents).
+ *
+ * every entry is a list of fixed size pages taken from a pooled arena.
+ * pages are reference counted : clone() shares them and a write on a
+ * shared page copies it first (copy-on-write). when the pages in use go
+ * above the budget, the least recently used entries are dropped and the
+ * empty chunks of the arena above the budget are released.
+ */
+class ShadowStore
+{
+public:
+	typedef uint64_t Key;
+
+	enum {
+		PAGE_SIZE = 4096,
+		PAGES_PER_CHUNK = 64,
+		INVALID_PAGE = 0xFFFFFFFF
+	};
+
+	inline ShadowStore(const uint64_t budget = 64 * 1024 * 1024) :
+		_budget(budget), _used(0), _peak(0), _evicted(0) { }
+	virtual ~ShadowStore() { clear(); }
+
+	/** release all entries and the arena */
+	inline void clear()
+	{
+		_entries.clear();
+		_lru.clear();
+		for (size_t i = 0; i < _chunks.size(); ++i)
+			delete[] _chunks[i];
+		_chunks.clear();
+		_refs.clear();
+		_free.clear();
+		_used = 0;
+	}
+
+	/** memory cap of the pages in use (0 == no cap) */
+	inline void budget(const uint64_t& bytes)
+	{
+		_budget = bytes;
+		evict(INVALID_KEY);
+		trim();
+	}
+	inline uint64_t budget() const { return _budget; }
+	/** bytes of pages in use */
+	inline uint64_t used() const { return _used; }
+	/** bytes of the arena (pages in use and free pages) */
+	inline uint64_t reserved() const
+	{
+		return static_cast<uint64_t>(_chunks.size()) *
+			PAGES_PER_CHUNK * PAGE_SIZE;
+	}
+	/** biggest "used" seen */
+	inline uint64_t peak() const { return _peak; }
+	/** entries dropped by the lru */
+	inline uint64_t evicted() const { return _evicted; }
+	/** number of entries */
+	inline size_t size() const { return _entries.size(); }
+
+	inline bool has(const Key& key) const
+	{
+		return _entries.find(key) != _entries.end();
+	}
+
+	/** size in bytes of an entry (0 if unknown) */
+	inline uint64_t size(const Key& key) const
+	{
+		Entry_m::const_iterator iter = _entries.find(key);
+		return iter == _entries.end() ? 0 : iter->second.size;
+	}
+
+	/** (re)create an entry of "size" bytes, content is zero until written */
+	inline void resize(const Key& key, const uint64_t& size)
+	{
+		release(key);
+
+		Entry_t& entry = _entries[key];
+		entry.size = size;
+		entry.pages.assign(pageCount(size), INVALID_PAGE);
+		entry.lru = _lru.insert(_lru.end(), key);
+	}
+
+	/** copy "size" bytes at "offset", the entry must exist and be big
+	 * enough (false if not) */
+	inline bool write(const Key& key, const uint64_t& offset,
+		const void* data, const uint64_t& size)
+	{
+		Entry_m::iterator iter = _entries.find(key);
+
+		if (iter == _entries.end() || !data)
+			return false;
+
+		if (offset + size > iter->second.size)
+			return false;
+
+		touch(iter->second);
+
+		const uchar* src = static_cast<const uchar*>(data);
+		uint64_t position = offset;
+		uint64_t left = size;
+
+		while (left)
+		{
+			const uint64_t index = position / PAGE_SIZE;
+			const uint64_t in_page = position % PAGE_SIZE;
+			const uint64_t count = (PAGE_SIZE - in_page) < left ?
+				(PAGE_SIZE - in_page) : left;
+
+			uint& page = iter->second.pages[index];
+
+			// partial write on a new page : keep the rest to zero
+			if (page == INVALID_PAGE)
+			{
+				page = allocate();
+				memset(page_data(page), 0, PAGE_SIZE);
+			}
+			// copy-on-write
+			else if (_refs[page] > 1)
+			{
+				const uint copy = allocate();
+				memcpy(page_data(copy), page_data(page), PAGE_SIZE);
+				--_refs[page];
+				page = copy;
+			}
+
+			memcpy(page_data(page) + in_page, src, count);
+
+			src += count;
+			position += count;
+			left -= count;
+		}
+
+		// the new pages may be above the budget
+		evict(key);
+		return true;
+	}
+
+	/** copy "size" bytes at "offset" to "dst" (false if unknown) */
+	inline bool read(const Key& key, const uint64_t& offset, void* dst,
+		const uint64_t& size)
+	{
+		Entry_m::iterator iter = _entries.find(key);
+
+		if (iter == _entries.end() || !dst)
+			return false;
+
+		if (offset + size > iter->second.size)
+			return false;
+
+		touch(iter->second);
+
+		uchar* out = static_cast<uchar*>(dst);
+		uint64_t position = offset;
+		uint64_t left = size;
+
+		while (left)
+		{
+			const uint64_t index = position / PAGE_SIZE;
+			const uint64_t in_page = position % PAGE_SIZE;
+			const uint64_t count = (PAGE_SIZE - in_page) < left ?
+				(PAGE_SIZE - in_page) : left;
+
+			const uint page = iter->second.pages[index];
+
+			if (page == INVALID_PAGE)
+				memset(out, 0, count);
+			else
+				memcpy(out, page_data(page) + in_page, count);
+
+			out += count;
+			position += count;
+			left -= count;
+		}
+		return true;
+	}
+
+	/** "dst" shares the pages of "src" until one of them is written */
+	inline bool clone(const Key& src, const Key& dst)
+	{
+		if (src == dst || !has(src))
+			return false;
+
+		release(dst);
+
+		Entry_t& from = _entries[src];
+		Entry_t& to = _entries[dst];
+
+		to.size = from.size;
+		to.pages = from.pages;
+		to.lru = _lru.insert(_lru.end(), dst);
+
+		for (size_t i = 0; i < to.pages.size(); ++i)
+		{
+			if (to.pages[i] != INVALID_PAGE)
+				++_refs[to.pages[i]];
+		}
+		return true;
+	}
+
+	/** drop an entry, its pages go back to the arena */
+	inline void release(const Key& key)
+	{
+		Entry_m::iterator iter = _entries.find(key);
+
+		if (iter == _entries.end())
+			return;
+
+		drop(iter);
+		trim();
+	}
+
+	/** drop all the entries in [first,last] */
+	inline void release(const Key& first, const Key& last)
+	{
+		Entry_m::iterator iter = _entries.lower_bound(first);
+
+		while (iter != _entries.end() && iter->first <= last)
+		{
+			Entry_m::iterator next = iter;
+			++next;
+			drop(iter);
+			iter = next;
+		}
+		trim();
+	}
+
+private:
+	static const Key INVALID_KEY = ~0ULL;
+
+	/** the store owns the arena : no copy */
+	ShadowStore(const ShadowStore&);
+	ShadowStore& operator=(const ShadowStore&);
+
+	struct Entry_t {
+		Entry_t() : size(0) {}
+
+		uint64_t size;
+		Vector<uint> pages;
+		std::list<Key>::iterator lru;
+	}; typedef Map<Key,Entry_t> Entry_m;
+
+	static inline uint64_t pageCount(const uint64_t& size)
+	{
+		return (size + PAGE_SIZE - 1) / PAGE_SIZE;
+	}
+
+	inline uchar* page_data(const uint page)
+	{
+		return _chunks[page / PAGES_PER_CHUNK] +
+			(page % PAGES_PER_CHUNK) * PAGE_SIZE;
+	}
+
+	/** take a page from the arena (refcount 1), the lowest free page
+	 * first so that the last chunks empty out */
+	inline uint allocate()
+	{
+		if (_free.empty())
+		{
+			const uint first = static_cast<uint>(_chunks.size()) * PAGES_PER_CHUNK;
+			_chunks.push_back(new uchar[PAGES_PER_CHUNK * PAGE_SIZE]);
+			_refs.resize(first + PAGES_PER_CHUNK, 0);
+
+			for (uint i = 0; i < PAGES_PER_CHUNK; ++i)
+				_free.insert(_free.end(), first + i);
+		}
+
+		const uint page = *_free.begin();
+		_free.erase(_free.begin());
+		_refs[page] = 1;
+
+		_used += PAGE_SIZE;
+		if (_used > _peak)
+			_peak = _used;
+
+		return page;
+	}
+
+	/** give back a page reference */
+	inline void deallocate(const uint page)
+	{
+		if (--_refs[page])
+			return;
+
+		_free.insert(page);
+		_used -= PAGE_SIZE;
+	}
+
+	/** release the last chunks while they are empty and the arena is
+	 * above the budget */
+	inline void trim()
+	{
+		if (!_budget)
+			return;
+
+		while (!_chunks.empty() && reserved() > _budget)
+		{
+			const uint first = static_cast<uint>(_chunks.size() - 1) *
+				PAGES_PER_CHUNK;
+
+			// the free pages are sorted : the chunk is empty when its
+			// pages are the last free ones
+			std::set<uint>::iterator iter = _free.lower_bound(first);
+
+			if (static_cast<uint>(std::distance(iter, _free.end())) !=
+				PAGES_PER_CHUNK)
+				break;
+
+			_free.erase(iter, _free.end());
+			delete[] _chunks.back();
+			_chunks.pop_back();
+			_refs.resize(first);
+		}
+	}
+
+	inline void drop(Entry_m::iterator iter)
+	{
+		Vector<uint>& pages = iter->second.pages;
+
+		for (size_t i = 0; i < pages.size(); ++i)
+		{
+			if (pages[i] != INVALID_PAGE)
+				deallocate(pages[i]);
+		}
+
+		_lru.erase(iter->second.lru);
+		_entries.erase(iter);
+	}
+
+	/** most recently used */
+	inline void touch(Entry_t& entry)
+	{
+		_lru.splice(_lru.end(), _lru, entry.lru);
+	}
+
+	/** drop the least recently used entries until under budget,
+	 * "keep" is never dropped */
+	inline void evict(const Key keep)
+	{
+		if (!_budget)
+			return;
+
+		std::list<Key>::iterator iter = _lru.begin();
+
+		while (_used > _budget && iter != _lru.end())
+		{
+			const Key key = *iter;
+			++iter;
+
+			if (key == keep)
+				continue;
+
+			release(key);
+			++_evicted;
+		}
+	}
+
+	uint64_t _budget;
+	uint64_t _used;
+	uint64_t _peak;
+	uint64_t _evicted;
+
+	Entry_m _entries;
+	/** front : least recently used */
+	std::list<Key> _lru;
+	/** arena */
+	Vector<uchar*> _chunks;
+	Vector<uint> _refs;
+	/** free pages, sorted */
+	std::set<uint> _free;
+
+};	// End of class ShadowStore
+
+#endif	// __GLES2_DEBUGGER_SHADOW_STORE_INCLUDE_H__
@@ -0,0 +1,384 @@
+/*
+ * Simple OpenGL ES 2.0 debugger
+ *
+ *  Copyright (C) 2016 ESTEVE Olivier
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ */
+#ifndef __GLES2_DEBUGGER_SIMD_INCLUDE_H__
+#define __GLES2_DEBUGGER_SIMD_INCLUDE_H__
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+	(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define DEBUGGER_SIMD_SSE2
+	#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#define DEBUGGER_SIMD_NEON
+	#include <arm_neon.h>
+#endif
+
+/** vectorized helpers (sse2, neon or scalar fallback) */
+class Simd
+{
+public:
+	/** name of the instruction set in use */
+	static inline const char* name()
+	{
+#if defined(DEBUGGER_SIMD_SSE2)
+		return "sse2";
+#elif defined(DEBUGGER_SIMD_NEON)
+		return "neon";
+#else
+		return "scalar";
+#endif
+	}
+
+	/** biggest of "count" unsigned indices of "bytes" (1, 2 or 4) each.
+	 * "data" does not need to be aligned */
+	static inline uint maxIndex(const void* data, uint count, uint bytes)
+	{
+		switch (bytes)
+		{
+			case 1: return maxIndex8(static_cast<const uchar*>(data), count);
+			case 2: return maxIndex16(static_cast<const uint16_t*>(data), count);
+			case 4: return maxIndex32(static_cast<const uint32_t*>(data), count);
+		}
+		return 0;
+	}
+
+	/** reference implementation */
+	static inline uint maxIndexScalar(const void* data, uint count, uint bytes)
+	{
+		uint result = 0;
+		for (uint i = 0; i < count; ++i)
+		{
+			uint v = 0;
+			switch (bytes)
+			{
+				case 1: v = static_cast<const uchar*>(data)[i]; break;
+				case 2: v = static_cast<const uint16_t*>(data)[i]; break;
+				case 4: v = static_cast<const uint32_t*>(data)[i]; break;
+			}
+			if (v > result)
+				result = v;
+		}
+		return result;
+	}
+
+	static inline uint maxIndex8(const uchar* data, uint count)
+	{
+		uint i = 0;
+		uint result = 0;
+#if defined(DEBUGGER_SIMD_SSE2)
+		if (count >= 16)
+		{
+			__m128i m = _mm_setzero_si128();
+			for (; i + 16 <= count; i += 16)
+				m = _mm_max_epu8(m, _mm_loadu_si128(
+					reinterpret_cast<const __m128i*>(data + i)));
+
+			uchar lanes[16];
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), m);
+			result = maxIndexScalar(lanes, 16, 1);
+		}
+#elif defined(DEBUGGER_SIMD_NEON)
+		if (count >= 16)
+		{
+			uint8x16_t m = vdupq_n_u8(0);
+			for (; i + 16 <= count; i += 16)
+				m = vmaxq_u8(m, vld1q_u8(data + i));
+
+			uint8x8_t h = vmax_u8(vget_low_u8(m), vget_high_u8(m));
+			h = vpmax_u8(h, h);
+			h = vpmax_u8(h, h);
+			h = vpmax_u8(h, h);
+			result = vget_lane_u8(h, 0);
+		}
+#endif
+		for (; i < count; ++i)
+			if (data[i] > result)
+				result = data[i];
+		return result;
+	}
+
+	static inline uint maxIndex16(const uint16_t* data, uint count)
+	{
+		uint i = 0;
+		uint result = 0;
+#if defined(DEBUGGER_SIMD_SSE2)
+		if (count >= 8)
+		{
+			// sse2 has only a signed 16 bits max : flip the sign bit
+			const __m128i bias = _mm_set1_epi16(static_cast<short>(0x8000));
+			__m128i m = _mm_set1_epi16(static_cast<short>(0x8000));
+			for (; i + 8 <= count; i += 8)
+				m = _mm_max_epi16(m, _mm_xor_si128(bias, _mm_loadu_si128(
+					reinterpret_cast<const __m128i*>(data + i))));
+			m = _mm_xor_si128(m, bias);
+
+			uint16_t lanes[8];
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), m);
+			result = maxIndexScalar(lanes, 8, 2);
+		}
+#elif defined(DEBUGGER_SIMD_NEON)
+		if (count >= 8)
+		{
+			uint16x8_t m = vdupq_n_u16(0);
+			for (; i + 8 <= count; i += 8)
+				m = vmaxq_u16(m, vld1q_u16(data + i));
+
+			uint16x4_t h = vmax_u16(vget_low_u16(m), vget_high_u16(m));
+			h = vpmax_u16(h, h);
+			h = vpmax_u16(h, h);
+			result = vget_lane_u16(h, 0);
+		}
+#endif
+		for (; i < count; ++i)
+			if (data[i] > result)
+				result = data[i];
+		return result;
+	}
+
+	static inline uint maxIndex32(const uint32_t* data, uint count)
+	{
+		uint i = 0;
+		uint result = 0;
+#if defined(DEBUGGER_SIMD_SSE2)
+		if (count >= 4)
+		{
+			// unsigned compare with the signed one : flip the sign bit
+			const __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000));
+			__m128i m = bias;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128i v = _mm_xor_si128(bias, _mm_loadu_si128(
+					reinterpret_cast<const __m128i*>(data + i)));
+				const __m128i gt = _mm_cmpgt_epi32(v, m);
+				m = _mm_or_si128(_mm_and_si128(gt, v), _mm_andnot_si128(gt, m));
+			}
+			m = _mm_xor_si128(m, bias);
+
+			uint32_t lanes[4];
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), m);
+			result = maxIndexScalar(lanes, 4, 4);
+		}
+#elif defined(DEBUGGER_SIMD_NEON)
+		if (count >= 4)
+		{
+			uint32x4_t m = vdupq_n_u32(0);
+			for (; i + 4 <= count; i += 4)
+				m = vmaxq_u32(m, vld1q_u32(data + i));
+
+			uint32x2_t h = vmax_u32(vget_low_u32(m), vget_high_u32(m));
+			h = vpmax_u32(h, h);
+			result = vget_lane_u32(h, 0);
+		}
+#endif
+		for (; i < count; ++i)
+			if (data[i] > result)
+				result = data[i];
+		return result;
+	}
+
+	/** 32 bits hash of "size" bytes (xxhash32), the 4 accumulators run
+	 * in the 4 lanes of a vector */
+	static inline uint32_t hash(const void* data, size_t size,
+		uint32_t seed = 0)
+	{
+		const uchar* p = static_cast<const uchar*>(data);
+		const uchar* end = p + size;
+		uint32_t h;
+
+		if (size >= 16)
+		{
+			uint32_t v[4] = {
+				seed + PRIME32_1 + PRIME32_2, seed + PRIME32_2,
+				seed, seed - PRIME32_1
+			};
+			const uchar* limit = end - 16;
+#if defined(DEBUGGER_SIMD_SSE2)
+			__m128i acc = _mm_loadu_si128(reinterpret_cast<const __m128i*>(v));
+			const __m128i prime1 = _mm_set1_epi32(static_cast<int>(PRIME32_1));
+			const __m128i prime2 = _mm_set1_epi32(static_cast<int>(PRIME32_2));
+			for (; p <= limit; p += 16)
+			{
+				const __m128i in =
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+				acc = _mm_add_epi32(acc, mullo32(in, prime2));
+				acc = _mm_or_si128(_mm_slli_epi32(acc, 13),
+					_mm_srli_epi32(acc, 19));
+				acc = mullo32(acc, prime1);
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(v), acc);
+#elif defined(DEBUGGER_SIMD_NEON)
+			uint32x4_t acc = vld1q_u32(v);
+			const uint32x4_t prime1 = vdupq_n_u32(PRIME32_1);
+			const uint32x4_t prime2 = vdupq_n_u32(PRIME32_2);
+			for (; p <= limit; p += 16)
+			{
+				const uint32x4_t in = vreinterpretq_u32_u8(vld1q_u8(p));
+				acc = vmlaq_u32(acc, in, prime2);
+				acc = vorrq_u32(vshlq_n_u32(acc, 13), vshrq_n_u32(acc, 19));
+				acc = vmulq_u32(acc, prime1);
+			}
+			vst1q_u32(v, acc);
+#else
+			for (; p <= limit; p += 16)
+			{
+				v[0] = round(v[0], read32(p));
+				v[1] = round(v[1], read32(p + 4));
+				v[2] = round(v[2], read32(p + 8));
+				v[3] = round(v[3], read32(p + 12));
+			}
+#endif
+			h = rotl(v[0], 1) + rotl(v[1], 7) + rotl(v[2], 12) +
+				rotl(v[3], 18);
+		}
+		else
+		{
+			h = seed + PRIME32_5;
+		}
+
+		return finalize(h + static_cast<uint32_t>(size), p, end);
+	}
+
+	/** reference implementation */
+	static inline uint32_t hashScalar(const void* data, size_t size,
+		uint32_t seed = 0)
+	{
+		const uchar* p = static_cast<const uchar*>(data);
+		const uchar* end = p + size;
+		uint32_t h;
+
+		if (size >= 16)
+		{
+			uint32_t v1 = seed + PRIME32_1 + PRIME32_2;
+			uint32_t v2 = seed + PRIME32_2;
+			uint32_t v3 = seed;
+			uint32_t v4 = seed - PRIME32_1;
+
+			for (; p + 16 <= end; p += 16)
+			{
+				v1 = round(v1, read32(p));
+				v2 = round(v2, read32(p + 4));
+				v3 = round(v3, read32(p + 8));
+				v4 = round(v4, read32(p + 12));
+			}
+			h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+		}
+		else
+		{
+			h = seed + PRIME32_5;
+		}
+
+		return finalize(h + static_cast<uint32_t>(size), p, end);
+	}
+
+	/** memcmp(a, b, size) == 0, 16 bytes per step */
+	static inline bool equal(const void* a, const void* b, size_t size)
+	{
+		const uchar* pa = static_cast<const uchar*>(a);
+		const uchar* pb = static_cast<const uchar*>(b);
+		size_t i = 0;
+#if defined(DEBUGGER_SIMD_SSE2)
+		for (; i + 16 <= size; i += 16)
+		{
+			const __m128i va =
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(pa + i));
+			const __m128i vb =
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(pb + i));
+			if (_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) != 0xFFFF)
+				return false;
+		}
+#elif defined(DEBUGGER_SIMD_NEON)
+		for (; i + 16 <= size; i += 16)
+		{
+			const uint64x2_t eq = vreinterpretq_u64_u8(
+				vceqq_u8(vld1q_u8(pa + i), vld1q_u8(pb + i)));
+			if ((vgetq_lane_u64(eq, 0) & vgetq_lane_u64(eq, 1)) != ~0ULL)
+				return false;
+		}
+#endif
+		return memcmp(pa + i, pb + i, size - i) == 0;
+	}
+
+private:
+	static const uint32_t PRIME32_1 = 2654435761U;
+	static const uint32_t PRIME32_2 = 2246822519U;
+	static const uint32_t PRIME32_3 = 3266489917U;
+	static const uint32_t PRIME32_4 = 668265263U;
+	static const uint32_t PRIME32_5 = 374761393U;
+
+	static inline uint32_t rotl(uint32_t x, int r)
+	{
+		return (x << r) | (x >> (32 - r));
+	}
+
+	/** unaligned little endian read */
+	static inline uint32_t read32(const uchar* p)
+	{
+		return static_cast<uint32_t>(p[0]) |
+			(static_cast<uint32_t>(p[1]) << 8) |
+			(static_cast<uint32_t>(p[2]) << 16) |
+			(static_cast<uint32_t>(p[3]) << 24);
+	}
+
+	static inline uint32_t round(uint32_t acc, uint32_t input)
+	{
+		acc += input * PRIME32_2;
+		acc = rotl(acc, 13);
+		return acc * PRIME32_1;
+	}
+
+	/** remaining bytes and avalanche */
+	static inline uint32_t finalize(uint32_t h, const uchar* p,
+		const uchar* end)
+	{
+		for (; p + 4 <= end; p += 4)
+		{
+			h += read32(p) * PRIME32_3;
+			h = rotl(h, 17) * PRIME32_4;
+		}
+		for (; p < end; ++p)
+		{
+			h += (*p) * PRIME32_5;
+			h = rotl(h, 11) * PRIME32_1;
+		}
+
+		h ^= h >> 15;
+		h *= PRIME32_2;
+		h ^= h >> 13;
+		h *= PRIME32_3;
+		h ^= h >> 16;
+		return h;
+	}
+
+#if defined(DEBUGGER_SIMD_SSE2)
+	/** 32 bits multiply of the 4 lanes (pmulld is sse4.1) */
+	static inline __m128i mullo32(const __m128i& a, const __m128i& b)
+	{
+		const __m128i even = _mm_mul_epu32(a, b);
+		const __m128i odd = _mm_mul_epu32(
+			_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+		return _mm_unpacklo_epi32(
+			_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+			_mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+	}
+#endif
+
+}; // Simd
+
+#endif	// __GLES2_DEBUGGER_SIMD_INCLUDE_H__
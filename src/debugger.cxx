@@ -28,6 +28,8 @@
 #include <extensions.h>
 #include <debugger.h>
 
+#include <algorithm>	// std::sort
+
 #if defined(max)
 #undef max
 #undef min
@@ -38,9 +40,24 @@ namespace Debugger {
 #define INIT_POINTER =nullptr
 
 //#define TRACE_FUNCTION TRACE_DEBUG
-#define TRACE_FUNCTION(...)
+/** time every wrapped call (see gl::addCallTime) */
+#define TRACE_FUNCTION(...) CallTimer call_timer_(_api, __func__, file, line)
+/** only the driver entry point is timed, not the debugger checks */
+#define TRACE_CALL(function) call_timer_.time(function)
 
 #define RESERVED_SIZE 4096
+#define RESERVED_INDEX_RANGES 4096
+/** calls before a baseline is trusted */
+#define CALL_TIMING_WARMUP 16
+/** stalls kept and calls captured before each of them */
+#define RESERVED_STALLS 16
+#define STALL_WINDOW 32
+/** driver messages of the same id logged per frame */
+#define DEBUG_MESSAGES_PER_FRAME 4
+/** draws recorded per frame */
+#define RESERVED_DRAWS 16384
+/** frames a draw can still be queued after its frame ended */
+#define MAP_FRAMES_IN_FLIGHT 3
 
 const char* gl::invalid_framebuffer_operation =
 	"GL_INVALID_FRAMEBUFFER_OPERATION";
@@ -59,6 +76,9 @@ gl::Program_v gl::_programs(RESERVED_SIZE);
 gl::Shader_v gl::_shaders(RESERVED_SIZE);
 gl::Buffer_v gl::_buffers(RESERVED_SIZE);
 gl::Buffer_t* gl::_bound_buffer[BUFFER_SIZE] = {0};
+gl::Mapping_m gl::_mappings;
+gl::MapSite_m gl::_map_sites;
+uint gl::_map_draws = 0;
 Map<uint, uchar> gl::_states;
 
 uint_v gl::_allowed_enable;
@@ -73,15 +93,189 @@ uint gl::frame = 0;
 
 gl::fnc_console_cb gl::_console_cb = nullptr;
 
+gl::CallSite_m gl::_call_sites;
+GLint gl::_unpack_alignment = 4;
+
+gl::Upload_t gl::_uploads[UPLOAD_SIZE];
+gl::Upload_m gl::_upload_sites;
+uint64_t gl::_upload_frame = 0;
+uint64_t gl::_upload_last_frame = 0;
+uint64_t gl::_upload_total = 0;
+uint64_t gl::_client_frame = 0;
+uint64_t gl::_client_last_frame = 0;
+uint64_t gl::_client_total = 0;
+uint64_t gl::_upload_spike_threshold = 0;
+bool gl::_redundant_check = false;
+gl::UploadHash_m gl::_upload_hashes;
+gl::Upload_t gl::_redundant_total;
+gl::Upload_m gl::_redundant_sites;
+gl::BufferUsage_m gl::_buffer_usage;
+gl::Object_m gl::_objects;
+gl::Churn_m gl::_churn_sites;
+gl::Uniform_m gl::_uniforms;
+gl::Upload_t gl::_uniform_total;
+gl::Upload_t gl::_uniform_redundant;
+gl::Upload_m gl::_uniform_sites;
+gl::Upload_m gl::_uniform_redundant_sites;
+bool gl::_uniform_location_cache = true;
+Map<String,uint> gl::_uniform_names;
+gl::UniformLocation_m gl::_uniform_locations;
+gl::UniformElement_m gl::_uniform_elements;
+gl::UniformArray_m gl::_uniform_arrays;
+gl::LocationSite_m gl::_location_sites;
+uint gl::_location_driver_calls = 0;
+uint64_t gl::_location_driver_time = 0;
+Map<uint,uint64_t> gl::_shader_hashes;
+gl::ShaderSource_m gl::_shader_sources;
+gl::ProgramPrep_m gl::_program_preps;
+uint64_t gl::_shader_time_startup = 0;
+uint64_t gl::_shader_time_frame = 0;
+uint64_t gl::_shader_time_last_frame = 0;
+uint64_t gl::_shader_time_peak = 0;
+uint64_t gl::_shader_time_total = 0;
+gl::ProgramInputs_m gl::_program_inputs;
+String gl::_program_binary_dir;
+uint32_t gl::_program_binary_driver = 0;
+uint gl::_program_binary_hits = 0;
+uint gl::_program_binary_misses = 0;
+uint gl::_program_binary_rejects = 0;
+uint gl::_program_binary_collisions = 0;
+gl::CallTiming_m gl::_call_timings;
+uint64_t gl::_stall_threshold = 8000000;
+gl::Stall_v gl::_stalls;
+uint gl::_stall_count = 0;
+uint gl::_gpu_profiling = GPU_PROFILING_OFF;
+bool gl::_gpu_timestamps = false;
+Vector<uint> gl::_gpu_queries;
+uint gl::_gpu_query_count = 0;
+gl::GpuQuery_v gl::_gpu_pending;
+gl::GpuQuery_v gl::_gpu_groups;
+gl::GpuQuery_t gl::_gpu_frame;
+bool gl::_gpu_app_elapsed = false;
+gl::GpuSite_m gl::_gpu_sites;
+gl::GpuFrame_t gl::_gpu_frames[GPU_FRAMES];
+uint64_t gl::_gpu_last_frame_time = 0;
+uint gl::_gpu_disjoint = 0;
+uint gl::_gpu_dropped = 0;
+const char* const gl::_api = "gl";
+const char* const gl::egl::_api = "egl";
+const char* gl::_call_file = nullptr;
+int gl::_call_line = 0;
+bool gl::_debug_output = false;
+bool gl::_debug_errors = false;
+String gl::_debug_error;
+bool gl::_debug_has_error = false;
+GLDEBUGPROCKHR gl::_app_debug_callback = nullptr;
+const void* gl::_app_debug_param = nullptr;
+gl::DebugMessage_m gl::_debug_messages;
+gl::Zone_v gl::_zones(1);
+gl::Zone_v gl::_zones_last_frame;
+uint gl::_zone_current = 0;
+Map<hash_t,uint> gl::_zone_children;
+Map<String,uint64_t> gl::_zone_folded;
+gl::RenderState_t gl::_render_state;
+uint32_t gl::_render_state_hash = 0;
+bool gl::_render_state_dirty = true;
+uint32_t gl::_texture_set_hash = 0;
+bool gl::_texture_set_dirty = true;
+uint gl::_bound_framebuffer = 0;
+gl::Draw_v gl::_draws;
+gl::Draw_v gl::_draws_last_frame;
+uint gl::_draws_dropped = 0;
+uint64_t gl::_draw_uniform_calls = 0;
+gl::BatchRun_v gl::_batch_runs;
+uint gl::_batch_saved_last_frame = 0;
+uint gl::_state_costs[STATE_SIZE] = { 100, 10, 4, 2 };
+uint gl::_debug_message_count = 0;
+uint gl::_debug_suppressed = 0;
+uint gl::_churn_frames = 4;
+uint gl::_objects_frame = 0;
+uint gl::_objects_last_frame = 0;
+
+uint gl::_active_texture = 0;
+uint gl::_bound_texture[TEXTURE_UNITS][TEXTURE_TARGET_SIZE] = {{0}};
+gl::Renderbuffer_v gl::_renderbuffers;
+uint gl::_bound_renderbuffer = 0;
+gl::Framebuffer_v gl::_framebuffers;
+Map<uint32_t,GLenum> gl::_framebuffer_status;
+uint gl::_framebuffer_status_queries = 0;
+uint gl::_framebuffer_status_hits = 0;
+gl::RenderPass_t gl::_pass;
+bool gl::_pass_open = false;
+gl::RenderPass_v gl::_passes;
+gl::RenderPass_v gl::_passes_last_frame;
+uint64_t gl::_pass_bytes_last_frame = 0;
+uint64_t gl::_pass_needless_last_frame = 0;
+Map<uint64_t,bool> gl::_pass_stored;
+Map<uint64_t,uint64_t> gl::_pass_pending;
+uint64_t gl::_pass_carried_last_frame = 0;
+GLsizei gl::_default_width = 0;
+GLsizei gl::_default_height = 0;
+uint gl::_default_texel[ATTACHMENT_SIZE] = { 4, 3, 1 };
+bool gl::_default_size_set = false;
+gl::Rect_t gl::_viewport(0, 0, DAMAGE_MAX_SIZE, DAMAGE_MAX_SIZE);
+gl::Rect_t gl::_scissor(0, 0, DAMAGE_MAX_SIZE, DAMAGE_MAX_SIZE);
+gl::Rect_v gl::_damage_rendered;
+gl::Rect_v gl::_damage_region;
+bool gl::_damage_region_set = false;
+gl::Rect_v gl::_damage_history[DAMAGE_AGES];
+uint gl::_damage_history_index = 0;
+gl::DamageFrame_v gl::_damage_frames;
+uint gl::_damage_swaps = 0;
+uint gl::_damage_stale = 0;
+uint gl::_damage_outside_region = 0;
+uint gl::_damage_undeclared = 0;
+uint64_t gl::_memory[MEMORY_SIZE] = {0};
+uint64_t gl::_memory_frame_start[MEMORY_SIZE] = {0};
+int64_t gl::_memory_last_delta[MEMORY_SIZE] = {0};
+
+bool gl::_shadowing = false;
+ShadowStore gl::_shadow;
+Map<ShadowStore::Key,uint64_t> gl::_shadow_rows;
+uint gl::_shadow_snapshot = 0;
+
+gl::VertexArray_t gl::_vertex_array;
+gl::VertexArray_m gl::_vertex_arrays;
+uint gl::_bound_vertex_array = 0;
+uint gl::_vertex_buffer_generation = 0;
+Map<uint,uint> gl::_vertex_buffer_generations;
+GLint gl::_max_vertex_attribs = 0;
+gl::IndexRange_m gl::_index_ranges;
+
 // ---------------------------------------------------------------------
 
 void gl::reset()
 {
+	endFrameUploads();
+	endFrameMemory();
+	endFrameObjects();
+	endFrameShaders();
+	endFrameGpu();
+	endFrameZones();
+	endFrameDraws();
+	endFramePasses();
+	endFrameDamage();
+
 	++frame;
 	_call_history.reset();
 	_output_buffer.clear();
 }
 
+void gl::shutdown()
+{
+	if (_objects.empty())
+		return;
+
+	const String report = getLeakReport();
+
+	if (_append_to_log_calls)
+	{
+		TRACE_WARNING(report.c_str());
+	}
+
+	appendConsole(report);
+}
+
 // ---------------------------------------------------------------------
 
 gl::Type gl::GenTypeInfo(GLuint bytes, bool specialInterpretation)
@@ -163,6 +357,20 @@ const gl::Type& gl::GetTypeInfo(GLenum type)
 
 const char* gl::get_last_error()
 {
+	/** the driver reports the errors through the debug callback */
+	if (_debug_errors)
+	{
+		if (!_debug_has_error)
+			return nullptr;
+
+		// the driver error flag is still set : clear it, or the
+		// application's own glGetError returns it later
+		gl::gl_GetError();
+
+		_debug_has_error = false;
+		return _debug_error.c_str();
+	}
+
 	const GLenum err = gl::gl_GetError();
 
 	switch (err)
@@ -248,16 +456,19 @@ bool gl::is_cap_enabled(GLenum cap)
 void gl::setStates(GLenum cap, uchar state)
 {
 	_states[cap] = state;
+	_render_state_dirty = true;
 }
 
 void gl::enableStates(GLenum cap)
 {
 	_states[cap] = static_cast<uchar>(1);
+	_render_state_dirty = true;
 }
 
 void gl::disableStates(GLenum cap)
 {
 	_states[cap] = static_cast<uchar>(0);
+	_render_state_dirty = true;
 }
 
 bool gl::is_allowed_capability_enable_disable(GLenum cap)
@@ -568,6 +779,27 @@ bool gl::unregister_buffer(uint id)
 	{
 		if (iter->id == id)
 		{
+			addMemory(MEMORY_BUFFER, -static_cast<int64_t>(iter->size));
+			_shadow.release(getShadowKey(SHADOW_BUFFER, id));
+			invalidateIndexRanges(id);
+			invalidateUploadHashes(SHADOW_BUFFER, id);
+			_buffer_usage.erase(id);
+
+			// deleted buffers are detached from the attributes
+			setVertexBufferDirty(id);
+			for (uint i = 0; i < VERTEX_ATTRIBS; ++i)
+			{
+				if (_vertex_array.attribs[i].buffer == id)
+				{
+					_vertex_array.attribs[i].buffer = 0;
+					_vertex_array.attribs[i].detached = 1;
+					_vertex_array.layoutDirty = 1;
+				}
+			}
+
+			if (_vertex_array.elementBuffer == id)
+				_vertex_array.elementBuffer = 0;
+
 			_buffers.erase(iter);
 			return true;
 		}
@@ -598,7 +830,20 @@ bool gl::unregister_texture(uint id)
 	{
 		if (iter->id == id)
 		{
+			addMemory(MEMORY_TEXTURE, -static_cast<int64_t>(iter->memory));
+			releaseShadowTexture(id);
+			invalidateUploadHashes(SHADOW_TEXTURE, id);
 			_textures.erase(iter);
+
+			// deleted textures are unbound
+			for (uint unit = 0; unit < TEXTURE_UNITS; ++unit)
+				for (uint target = 0; target < TEXTURE_TARGET_SIZE; ++target)
+					if (_bound_texture[unit][target] == id)
+					{
+						_bound_texture[unit][target] = 0;
+						_texture_set_dirty = true;
+					}
+
 			return true;
 		}
 	}
@@ -651,17 +896,4922 @@ void gl::setBoundBufferData(uint target, uint size, const void* data)
 	breakOnError(
 		MakeBool(_bound_buffer[target]), "buffer not registered / Invalid buffer");
 
-	_bound_buffer[target]->target = target;
-	_bound_buffer[target]->size = size;
-	_bound_buffer[target]->data = data;
-	_bound_buffer[target]->valid = (size >= 1 && data) ? 1 : 0;
+	if (!_bound_buffer[target])
+		return;
+
+	addMemory(MEMORY_BUFFER,
+		static_cast<int64_t>(size) - _bound_buffer[target]->size);
+
+	if (size != _bound_buffer[target]->size)
+		setVertexBufferDirty(_bound_buffer[target]->id);
+
+	_bound_buffer[target]->target = target;
+	_bound_buffer[target]->size = size;
+	_bound_buffer[target]->data = data;
+	_bound_buffer[target]->valid = (size >= 1 && data) ? 1 : 0;
+}
+
+uint gl::getBoundBufferId(uint target)
+{
+	if (target >= BUFFER_SIZE) ne_assert(!"local target only");
+	if (!_bound_buffer[target]) return INVALID_BOUND;
+	return _bound_buffer[target]->id;
+}
+
+// buffer mappings -----------------------------------------------------
+void gl::beginMapping(uint target, int64_t offset, int64_t length,
+	GLbitfield access, void* pointer, uint64_t time, const char* file,
+	int line)
+{
+	Buffer_t* buffer = _bound_buffer[target];
+
+	if (!buffer)
+		return;
+
+	buffer->mapped = 1;
+	buffer->mapPointer = pointer;
+	buffer->mapOffset = offset;
+	buffer->mapLength = length;
+
+	Mapping_t& mapping = _mappings[buffer->id];
+	mapping = Mapping_t();
+	mapping.file = file;
+	mapping.line = line;
+	mapping.access = access;
+	mapping.offset = offset;
+	mapping.length = length;
+
+	// the driver waits for the draws still reading the buffer
+	const bool unsynchronized = (access &
+		(GL_MAP_UNSYNCHRONIZED_BIT_EXT | GL_MAP_INVALIDATE_BUFFER_BIT_EXT)) != 0;
+	const bool in_flight = buffer->drawFrame &&
+		frame + 1 - buffer->drawFrame < MAP_FRAMES_IN_FLIGHT;
+
+	MapSite_t& site = _map_sites[getCallSite(file, line)];
+	++site.maps;
+	site.access = access;
+	site.time += time;
+	site.mapped += length;
+
+	if (time > site.peakTime)
+		site.peakTime = time;
+
+	if (unsynchronized || !in_flight)
+		return;
+
+	++site.syncs;
+
+	// once per call site
+	breakOnWarning(site.syncs > 1, format("synchronized map of buffer %u "
+		"drawn %u frame(s) ago (%.2fms blocked) : use "
+		"GL_MAP_UNSYNCHRONIZED_BIT_EXT or GL_MAP_INVALIDATE_BUFFER_BIT_EXT",
+		buffer->id, frame + 1 - buffer->drawFrame, time / 1e6).c_str());
+}
+
+void gl::flushMapping(uint target, int64_t offset, int64_t length)
+{
+	const Buffer_t* buffer = _bound_buffer[target];
+
+	if (!buffer)
+		return;
+
+	Mapping_m::iterator iter = _mappings.find(buffer->id);
+
+	if (iter == _mappings.end() || length <= 0)
+		return;
+
+	iter->second.flushed.push_back(std::make_pair(offset, length));
+}
+
+void gl::endMapping(uint target, GLboolean result)
+{
+	Buffer_t* buffer = _bound_buffer[target];
+
+	if (!buffer)
+		return;
+
+	buffer->mapped = 0;
+	buffer->mapPointer = nullptr;
+	buffer->mapOffset = 0;
+	buffer->mapLength = 0;
+
+	Mapping_m::iterator iter = _mappings.find(buffer->id);
+
+	if (iter == _mappings.end())
+		return;
+
+	Mapping_t& mapping = iter->second;
+	MapSite_t& site = _map_sites[getCallSite(mapping.file, mapping.line)];
+
+	// the writes through the pointer can't be seen : without explicit
+	// flush the whole range counts as written
+	uint64_t written = mapping.length;
+
+	if (mapping.access & GL_MAP_FLUSH_EXPLICIT_BIT_EXT)
+	{
+		Vector<std::pair<int64_t,int64_t> >& ranges = mapping.flushed;
+		std::sort(ranges.begin(), ranges.end());
+
+		uint64_t sum = 0, covered = 0;
+		int64_t end = 0;
+
+		for (uint i = 0; i < ranges.size(); ++i)
+		{
+			const int64_t first = std::max(ranges[i].first, end);
+			const int64_t last = ranges[i].first + ranges[i].second;
+
+			sum += ranges[i].second;
+
+			if (last > first)
+			{
+				covered += last - first;
+				end = last;
+			}
+		}
+
+		written = std::min<uint64_t>(covered, mapping.length);
+
+		site.flushed += covered;
+		site.reflushed += sum - covered;
+		site.unflushed += mapping.length - written;
+	}
+
+	if (!result)
+		++site.failures;
+
+	if (mapping.access & GL_MAP_WRITE_BIT_EXT)
+		addUpload(UPLOAD_MAP_BUFFER, written, mapping.file, mapping.line);
+
+	_mappings.erase(iter);
+}
+
+const char* gl::checkMappedBuffers(bool elements)
+{
+	const char* message = nullptr;
+	uint last = 0;
+
+	for (uint i = 0; i < VERTEX_ATTRIBS; ++i)
+	{
+		const VertexAttrib_t& attrib = _vertex_array.attribs[i];
+
+		if (!attrib.enabled || !attrib.buffer || attrib.buffer == last)
+			continue;
+
+		last = attrib.buffer;
+		Buffer_t* buffer = getBuffer(ARRAY_BUFFER, attrib.buffer);
+
+		if (!buffer)
+			continue;
+
+		buffer->drawFrame = frame + 1;
+
+		if (buffer->mapped)
+			message = "draw reads a mapped array buffer";
+	}
+
+	Buffer_t* buffer = elements ? elementArrayBuffer() : nullptr;
+
+	if (buffer)
+	{
+		buffer->drawFrame = frame + 1;
+
+		if (buffer->mapped)
+			message = "draw reads a mapped element array buffer";
+	}
+
+	if (message)
+		++_map_draws;
+
+	return message;
+}
+
+static bool sortMapSites(
+	const std::pair<hash_t,uint64_t>& a, const std::pair<hash_t,uint64_t>& b)
+{
+	return a.second > b.second;
+}
+
+const String gl::getMapReport(uint top)
+{
+	String report;
+
+	report << format("maps: last frame %s written, %u mapped now, %u "
+		"draws with a mapped buffer\n",
+		formatBytes(_uploads[UPLOAD_MAP_BUFFER].lastFrameBytes).c_str(),
+		static_cast<uint>(_mappings.size()), _map_draws);
+
+	// call sites, most time blocked first
+	Vector<std::pair<hash_t,uint64_t> > sites;
+
+	MapSite_m::iterator iter;
+	foreach(_map_sites)
+		sites.push_back(std::make_pair(iter->first, iter->second.time));
+
+	std::sort(sites.begin(), sites.end(), sortMapSites);
+
+	for (uint i = 0; i < sites.size() && i < top; ++i)
+	{
+		const MapSite_t& site = _map_sites[sites[i].first];
+		const GLbitfield access = site.access;
+
+		report << format("  %s : %u maps [%s%s%s%s%s%s], blocked %.2fms "
+			"(peak %.2fms), %u synchronized, mapped %s",
+			getCallSiteName(sites[i].first).c_str(),
+			static_cast<uint>(site.maps),
+			access & GL_MAP_READ_BIT_EXT ? "R" : "",
+			access & GL_MAP_WRITE_BIT_EXT ? "W" : "",
+			access & GL_MAP_INVALIDATE_RANGE_BIT_EXT ? " invalidate-range" : "",
+			access & GL_MAP_INVALIDATE_BUFFER_BIT_EXT ? " invalidate-buffer" : "",
+			access & GL_MAP_FLUSH_EXPLICIT_BIT_EXT ? " flush-explicit" : "",
+			access & GL_MAP_UNSYNCHRONIZED_BIT_EXT ? " unsynchronized" : "",
+			site.time / 1e6, site.peakTime / 1e6,
+			static_cast<uint>(site.syncs), formatBytes(site.mapped).c_str());
+
+		if (site.access & GL_MAP_FLUSH_EXPLICIT_BIT_EXT)
+		{
+			report << format(", flushed %s, twice %s, never %s",
+				formatBytes(site.flushed).c_str(),
+				formatBytes(site.reflushed).c_str(),
+				formatBytes(site.unflushed).c_str());
+		}
+
+		if (site.failures)
+			report << format(", %u corrupted", static_cast<uint>(site.failures));
+
+		report << "\n";
+	}
+
+	return report;
+}
+
+// call sites ----------------------------------------------------------
+hash_t gl::getCallSite(const char* file, int line)
+{
+	if (!file)
+		return 0;
+
+	// djb2(file) mixed with the line
+	const hash_t site = (Core::hash(file) * 33) ^ static_cast<hash_t>(line);
+
+	if (_call_sites.find(site) == _call_sites.end())
+		_call_sites[site] = CallSite_t(file, line);
+
+	return site;
+}
+
+String gl::getCallSiteName(hash_t site)
+{
+	CallSite_m::Iterator iter = _call_sites.find(site);
+
+	if (iter == _call_sites.end())
+		return "unknown";
+
+	return format("%s@%d",
+		get_path(iter->second.file).c_str(), iter->second.line);
+}
+
+String gl::formatBytes(uint64_t bytes)
+{
+	if (bytes >= 1024 * 1024)
+		return format("%.2fMB", static_cast<double>(bytes) / (1024.0 * 1024.0));
+	if (bytes >= 1024)
+		return format("%.2fKB", static_cast<double>(bytes) / 1024.0);
+	return format("%uB", static_cast<uint>(bytes));
+}
+
+// uploads -------------------------------------------------------------
+uint64_t gl::getImageSize(GLsizei width, GLsizei height, GLsizei depth,
+	GLenum format, GLenum type)
+{
+	if (width <= 0 || height <= 0 || depth <= 0)
+		return 0;
+
+	const Type& typeInfo = GetTypeInfo(type);
+
+	if (typeInfo.bytes == 0)
+		return 0;
+
+	// packed types (565, 4444, ...) store a whole pixel in one element
+	const uint components = typeInfo.specialInterpretation ?
+		1 : getFormatComponents(format);
+
+	const uint64_t pixel = static_cast<uint64_t>(components) * typeInfo.bytes;
+	const uint64_t row = pixel * width;
+	const uint64_t align = _unpack_alignment > 0 ? _unpack_alignment : 1;
+	const uint64_t pitch = ((row + align - 1) / align) * align;
+
+	// the last row is not padded
+	const uint64_t rows = static_cast<uint64_t>(height) * depth;
+	return pitch * (rows - 1) + row;
+}
+
+const char* gl::getUploadName(uint kind)
+{
+	switch (kind)
+	{
+		case UPLOAD_BUFFER_DATA: return "glBufferData";
+		case UPLOAD_BUFFER_SUB_DATA: return "glBufferSubData";
+		case UPLOAD_TEX_IMAGE_2D: return "glTexImage2D";
+		case UPLOAD_TEX_SUB_IMAGE_2D: return "glTexSubImage2D";
+		case UPLOAD_COMPRESSED_TEX_IMAGE_2D: return "glCompressedTexImage2D";
+		case UPLOAD_COMPRESSED_TEX_SUB_IMAGE_2D: return "glCompressedTexSubImage2D";
+		case UPLOAD_TEX_IMAGE_3D: return "glTexImage3DOES";
+		case UPLOAD_TEX_SUB_IMAGE_3D: return "glTexSubImage3DOES";
+		case UPLOAD_COMPRESSED_TEX_IMAGE_3D: return "glCompressedTexImage3DOES";
+		case UPLOAD_COMPRESSED_TEX_SUB_IMAGE_3D: return "glCompressedTexSubImage3DOES";
+		case UPLOAD_CLIENT_INDICES: return "glDrawElements (client indices)";
+		case UPLOAD_CLIENT_VERTICES: return "glDraw* (client vertex arrays)";
+		case UPLOAD_MAP_BUFFER: return "glMapBuffer* (written)";
+	}
+	return "unknown";
+}
+
+void gl::addUpload(uint kind, uint64_t bytes, const char* file, int line)
+{
+	if (kind >= UPLOAD_SIZE) ne_assert(!"invalid upload kind");
+
+	Upload_t& entry = _uploads[kind];
+	entry.kind = kind;
+	entry.add(bytes);
+
+	_zones[_zone_current].bytes += bytes;
+
+	const hash_t callSite = getCallSite(file, line);
+
+	// a call site can upload through several kinds (client arrays)
+	Upload_t& site = _upload_sites[callSite * 33 + kind];
+	site.kind = kind;
+	site.site = callSite;
+	site.add(bytes);
+
+	// client arrays are copied by the driver, not uploaded
+	if (isClientArray(kind))
+	{
+		_client_frame += bytes;
+		_client_total += bytes;
+		return;
+	}
+
+	_upload_frame += bytes;
+	_upload_total += bytes;
+}
+
+void gl::endFrameUploads()
+{
+	const uint64_t frameBytes = _upload_frame;
+
+	// biggest call site of the frame (for the spike warning)
+	hash_t top = 0;
+	uint64_t topBytes = 0;
+
+	for (uint i = 0; i < UPLOAD_SIZE; ++i)
+		_uploads[i].endFrame();
+
+	Upload_m::iterator iter;
+	foreach(_upload_sites)
+	{
+		Upload_t& site = iter->second;
+
+		if (site.frameBytes > topBytes && !isClientArray(site.kind))
+		{
+			top = site.site;
+			topBytes = site.frameBytes;
+		}
+
+		site.endFrame();
+	}
+
+	_redundant_total.endFrame();
+	foreach(_redundant_sites)
+		iter->second.endFrame();
+
+	_uniform_total.endFrame();
+	_uniform_redundant.endFrame();
+	foreach(_uniform_sites)
+		iter->second.endFrame();
+	foreach(_uniform_redundant_sites)
+		iter->second.endFrame();
+
+	_upload_last_frame = frameBytes;
+	_upload_frame = 0;
+
+	_client_last_frame = _client_frame;
+	_client_frame = 0;
+
+	if (_upload_spike_threshold && frameBytes > _upload_spike_threshold)
+	{
+		const String message = format(
+			"frame %u uploaded %s (threshold %s), biggest: %s %s",
+			frame, formatBytes(frameBytes).c_str(),
+			formatBytes(_upload_spike_threshold).c_str(),
+			getCallSiteName(top).c_str(), formatBytes(topBytes).c_str()
+		);
+		breakOnWarning(false, message);
+	}
+}
+
+uint64_t gl::getClientArraySize(uint vertices)
+{
+	uint64_t bytes = 0;
+
+	for (uint i = 0; i < VERTEX_ATTRIBS; ++i)
+	{
+		const VertexAttrib_t& attrib = _vertex_array.attribs[i];
+
+		// a deleted buffer leaves an offset, not client memory
+		if (!attrib.enabled || attrib.buffer || attrib.detached ||
+			!attrib.pointer)
+			continue;
+
+		const uint64_t size = attrib.size * (attrib.type == GL_FIXED ?
+			4 : GetTypeInfo(attrib.type).bytes);
+
+		// interleaved arrays : the whole vertex is read
+		bytes += static_cast<uint64_t>(vertices) *
+			(attrib.stride ? attrib.stride : size);
+	}
+	return bytes;
+}
+
+void gl::addClientArray(uint kind, uint64_t bytes, const char* file,
+	int line)
+{
+	if (!bytes)
+		return;
+
+	const hash_t site = getCallSite(file, line);
+
+	// first time for this call site
+	if (_upload_sites.find(site * 33 + kind) == _upload_sites.end())
+	{
+		const String message = format(
+			"%s : %s copied from client memory on each draw, "
+			"use a buffer object", getCallSiteName(site).c_str(),
+			kind == UPLOAD_CLIENT_INDICES ? "indices" : "vertices");
+		breakOnWarning(false, message);
+	}
+
+	addUpload(kind, bytes, file, line);
+}
+
+void gl::setRedundantUploadCheck(bool enable)
+{
+	_redundant_check = enable;
+
+	if (!enable)
+		_upload_hashes.clear();
+}
+
+void gl::checkRedundantUpload(uint kind, const UploadRange_t& range,
+	const void* data, uint64_t bytes, const char* file, int line)
+{
+	if (!_redundant_check || range.id == INVALID_BOUND)
+		return;
+
+	UploadHash_m::iterator iter = _upload_hashes.find(range);
+
+	const uint32_t hash = data ? Simd::hash(data, bytes) : 0;
+
+	// same range, same content : nothing changed on the gpu side
+	if (data && iter != _upload_hashes.end() && iter->second == hash)
+	{
+		const hash_t site = getCallSite(file, line);
+		Upload_t& entry = _redundant_sites[site * 33 + kind];
+
+		if (!entry.calls)
+		{
+			const String message = format(
+				"%s : %s re-uploads identical data (%s)",
+				getCallSiteName(site).c_str(), getUploadName(kind),
+				formatBytes(bytes).c_str());
+			breakOnWarning(false, message);
+		}
+
+		entry.kind = kind;
+		entry.site = site;
+		entry.add(bytes);
+		_redundant_total.add(bytes);
+		return;
+	}
+
+	// a new storage may be smaller : nothing outside of it is left
+	const bool storage = kind == UPLOAD_BUFFER_DATA ||
+		kind == UPLOAD_TEX_IMAGE_2D || kind == UPLOAD_COMPRESSED_TEX_IMAGE_2D;
+
+	// the ranges overwritten by this upload are no longer known
+	iter = _upload_hashes.lower_bound(
+		UploadRange_t(range.kind, range.id, 0, 0, 0, 0, 0));
+
+	while (iter != _upload_hashes.end() &&
+		iter->first.kind == range.kind && iter->first.id == range.id)
+	{
+		if (storage ? iter->first.level == range.level :
+			iter->first.overlaps(range))
+			_upload_hashes.erase(iter++);
+		else
+			++iter;
+	}
+
+	if (data)
+		_upload_hashes[range] = hash;
+}
+
+void gl::invalidateUploadHashes(uint kind, uint id)
+{
+	_upload_hashes.erase(
+		_upload_hashes.lower_bound(UploadRange_t(kind, id, 0, 0, 0, 0, 0)),
+		_upload_hashes.lower_bound(UploadRange_t(kind, id + 1, 0, 0, 0, 0, 0)));
+}
+
+static bool sortUploadSites(
+	const std::pair<hash_t,uint64_t>& a, const std::pair<hash_t,uint64_t>& b)
+{
+	return a.second > b.second;
+}
+
+const String gl::getUploadReport()
+{
+	String report;
+
+	report << "uploads: last frame " << formatBytes(_upload_last_frame)
+		<< ", total " << formatBytes(_upload_total) << "\n";
+	report << "client arrays: last frame "
+		<< formatBytes(_client_last_frame) << ", total "
+		<< formatBytes(_client_total) << "\n";
+
+	for (uint i = 0; i < UPLOAD_SIZE; ++i)
+	{
+		const Upload_t& entry = _uploads[i];
+
+		if (!entry.calls)
+			continue;
+
+		report << format("  %-30s calls:%-8u total:%-10s last:%-10s peak:%s\n",
+			getUploadName(i), static_cast<uint>(entry.calls),
+			formatBytes(entry.bytes).c_str(),
+			formatBytes(entry.lastFrameBytes).c_str(),
+			formatBytes(entry.peakBytes).c_str());
+	}
+
+	// call sites, biggest first
+	Vector<std::pair<hash_t,uint64_t> > sites;
+	Upload_m::Iterator iter;
+	foreach(_upload_sites)
+		sites.push_back(std::make_pair(iter->first, iter->second.bytes));
+
+	std::sort(sites.begin(), sites.end(), sortUploadSites);
+
+	for (size_t i = 0; i < sites.size(); ++i)
+	{
+		const Upload_t& site = _upload_sites[sites[i].first];
+
+		report << format("  %s (%s) calls:%u total:%s last:%s peak:%s\n",
+			getCallSiteName(site.site).c_str(),
+			getUploadName(site.kind), static_cast<uint>(site.calls),
+			formatBytes(site.bytes).c_str(),
+			formatBytes(site.lastFrameBytes).c_str(),
+			formatBytes(site.peakBytes).c_str());
+	}
+
+	return report;
+}
+
+const String gl::getRedundantUploadReport()
+{
+	String report;
+
+	report << "redundant uploads: last frame "
+		<< formatBytes(_redundant_total.lastFrameBytes) << ", total "
+		<< formatBytes(_redundant_total.bytes) << "\n";
+
+	Vector<std::pair<hash_t,uint64_t> > sites;
+	Upload_m::Iterator iter;
+	foreach(_redundant_sites)
+		sites.push_back(std::make_pair(iter->first, iter->second.bytes));
+
+	std::sort(sites.begin(), sites.end(), sortUploadSites);
+
+	for (size_t i = 0; i < sites.size(); ++i)
+	{
+		const Upload_t& site = _redundant_sites[sites[i].first];
+
+		report << format("  %s (%s) calls:%u total:%s last:%s peak:%s\n",
+			getCallSiteName(site.site).c_str(),
+			getUploadName(site.kind), static_cast<uint>(site.calls),
+			formatBytes(site.bytes).c_str(),
+			formatBytes(site.lastFrameBytes).c_str(),
+			formatBytes(site.peakBytes).c_str());
+	}
+
+	return report;
+}
+
+// buffer usage --------------------------------------------------------
+void gl::addBufferData(uint id, GLenum usage, const char* file, int line)
+{
+	if (id == INVALID_BOUND)
+		return;
+
+	BufferUsage_m::iterator iter = _buffer_usage.find(id);
+
+	if (iter == _buffer_usage.end())
+	{
+		iter = _buffer_usage.insert(std::make_pair(id, BufferUsage_t())).first;
+		iter->second.firstFrame = frame;
+	}
+
+	BufferUsage_t& entry = iter->second;
+
+	// new storage while a draw may still read the old one : the driver
+	// can give a fresh block without waiting (orphaning)
+	if (entry.drawnSinceOrphan)
+		++entry.orphans;
+
+	// GL_STATIC_DRAW re-specifications within a window of frames
+	if (usage == GL_STATIC_DRAW)
+	{
+		if (!entry.staticWrites ||
+			frame - entry.staticFrame >= BufferUsage_t::STATIC_FRAMES)
+		{
+			entry.staticFrame = frame;
+			entry.staticWrites = 0;
+		}
+
+		++entry.staticWrites;
+
+		if (entry.staticWrites >= BufferUsage_t::STATIC_WRITES &&
+			!entry.staticWarned)
+		{
+			const String message = format(
+				"%s : buffer %u is GL_STATIC_DRAW but re-specified %u times "
+				"in %u frames, use GL_STREAM_DRAW",
+				getCallSiteName(getCallSite(file, line)).c_str(), id,
+				entry.staticWrites, frame - entry.staticFrame + 1);
+			breakOnWarning(false, message);
+			entry.staticWarned = true;
+		}
+	}
+	else
+		entry.staticWrites = 0;
+
+	entry.usage = usage;
+	entry.drawnSinceOrphan = false;
+	++entry.dataCalls;
+
+	if (entry.lastWriteFrame != frame)
+	{
+		entry.lastWriteFrame = frame;
+		++entry.framesWritten;
+	}
+}
+
+void gl::addBufferSubData(uint id, const char* file, int line)
+{
+	BufferUsage_m::iterator iter = _buffer_usage.find(id);
+
+	if (iter == _buffer_usage.end())
+		return;
+
+	BufferUsage_t& entry = iter->second;
+
+	// the gpu is one frame behind : a draw of the last frame can still
+	// read this buffer, the driver has to wait (or copy) before writing
+	if (entry.drawnSinceOrphan && entry.lastDrawFrame + 1 >= frame)
+	{
+		if (!entry.implicitSyncs)
+		{
+			const String message = format(
+				"%s : glBufferSubData on buffer %u in use by a previous draw "
+				"(implicit sync), orphan it with glBufferData first",
+				getCallSiteName(getCallSite(file, line)).c_str(), id);
+			breakOnWarning(false, message);
+		}
+		++entry.implicitSyncs;
+	}
+
+	++entry.subDataCalls;
+
+	if (entry.lastWriteFrame != frame)
+	{
+		entry.lastWriteFrame = frame;
+		++entry.framesWritten;
+	}
+}
+
+void gl::setBuffersDrawn(bool elements)
+{
+	for (uint i = 0; i < VERTEX_ATTRIBS; ++i)
+	{
+		const VertexAttrib_t& attrib = _vertex_array.attribs[i];
+
+		if (!attrib.enabled || !attrib.buffer)
+			continue;
+
+		BufferUsage_m::iterator iter = _buffer_usage.find(attrib.buffer);
+
+		if (iter != _buffer_usage.end())
+		{
+			iter->second.lastDrawFrame = frame;
+			iter->second.drawnSinceOrphan = true;
+		}
+	}
+
+	if (!elements || !elementArrayBuffer())
+		return;
+
+	BufferUsage_m::iterator iter =
+		_buffer_usage.find(elementArrayBuffer()->id);
+
+	if (iter != _buffer_usage.end())
+	{
+		iter->second.lastDrawFrame = frame;
+		iter->second.drawnSinceOrphan = true;
+	}
+}
+
+float gl::getBufferWriteFrequency(const BufferUsage_t& usage)
+{
+	const uint frames = frame - usage.firstFrame + 1;
+	return static_cast<float>(usage.framesWritten) / frames;
+}
+
+uint gl::getBufferUsagePattern(uint id)
+{
+	BufferUsage_m::Iterator iter = _buffer_usage.find(id);
+
+	if (iter == _buffer_usage.end() || !iter->second.framesWritten)
+		return BUFFER_PATTERN_UNKNOWN;
+
+	const BufferUsage_t& entry = iter->second;
+
+	if (entry.implicitSyncs)
+		return BUFFER_PATTERN_IMPLICIT_SYNC;
+
+	// rewritten in at least half of the frames
+	const bool streamed = entry.framesWritten > 2 &&
+		getBufferWriteFrequency(entry) >= 0.5f;
+
+	if (streamed)
+	{
+		if (entry.usage == GL_STATIC_DRAW)
+			return BUFFER_PATTERN_STATIC_STREAMED;
+
+		return entry.orphans ?
+			BUFFER_PATTERN_ORPHANED : BUFFER_PATTERN_STREAMED;
+	}
+
+	// give a few frames before blaming the hint
+	if (entry.usage != GL_STATIC_DRAW && entry.framesWritten == 1 &&
+		frame - entry.firstFrame > 2)
+		return BUFFER_PATTERN_DYNAMIC_UNUSED;
+
+	return BUFFER_PATTERN_STATIC;
+}
+
+const String gl::getBufferUsageReport()
+{
+	static const char* patterns[BUFFER_PATTERN_SIZE] = {
+		"not written",
+		"ok (static)",
+		"GL_STATIC_DRAW hint but streamed, use GL_STREAM_DRAW",
+		"written once, use GL_STATIC_DRAW",
+		"streamed, ok",
+		"streamed with orphaning, ok",
+		"updated while in use by a draw (implicit sync), orphan it with "
+			"glBufferData(NULL) or use a ring of buffers"
+	};
+
+	String report;
+
+	report << "buffers usage:\n";
+
+	BufferUsage_m::Iterator iter;
+	foreach(_buffer_usage)
+	{
+		const BufferUsage_t& entry = iter->second;
+
+		report << format(
+			"  buffer %-4u %-16s written %u/%u frames (%.0f%%) data:%u "
+			"sub:%u orphans:%u syncs:%u : %s\n",
+			iter->first,
+			entry.usage == GL_STATIC_DRAW ? "GL_STATIC_DRAW" :
+			entry.usage == GL_DYNAMIC_DRAW ? "GL_DYNAMIC_DRAW" :
+			entry.usage == GL_STREAM_DRAW ? "GL_STREAM_DRAW" : "-",
+			entry.framesWritten, frame - entry.firstFrame + 1,
+			getBufferWriteFrequency(entry) * 100.f, entry.dataCalls,
+			entry.subDataCalls, entry.orphans, entry.implicitSyncs,
+			patterns[getBufferUsagePattern(iter->first)]);
+	}
+
+	return report;
+}
+
+// object churn --------------------------------------------------------
+const char* gl::getObjectName(uint kind)
+{
+	static const char* names[OBJECT_SIZE] = {
+		"buffer",
+		"texture",
+		"renderbuffer",
+		"framebuffer",
+		"program",
+		"shader"
+	};
+	return kind < OBJECT_SIZE ? names[kind] : "unknown";
+}
+
+void gl::setChurnThreshold(uint frames)
+{
+	_churn_frames = frames;
+}
+
+void gl::addObject(uint kind, uint id, const char* file, int line)
+{
+	const hash_t site = getCallSite(file, line);
+
+	Object_t& object = _objects[(static_cast<uint64_t>(kind) << 32) | id];
+	object.kind = kind;
+	object.id = id;
+	object.frame = frame;
+	object.site = site;
+
+	Churn_t& churn = _churn_sites[site * 33 + kind];
+	churn.kind = kind;
+	churn.site = site;
+	++churn.created;
+	++churn.frameCreated;
+
+	++_objects_frame;
+}
+
+void gl::removeObject(uint kind, uint id, const char* file, int line)
+{
+	Object_m::iterator iter =
+		_objects.find((static_cast<uint64_t>(kind) << 32) | id);
+
+	if (iter == _objects.end())
+		return;
+
+	const Object_t& object = iter->second;
+	const uint lifetime = frame - object.frame;
+
+	Churn_t& churn = _churn_sites[object.site * 33 + kind];
+	++churn.deleted;
+	churn.lifetime += lifetime;
+
+	if (lifetime < _churn_frames)
+		++churn.shortLived;
+
+	if (!lifetime)
+	{
+		// first one for this creation site
+		if (!churn.sameFrame)
+		{
+			const String message = format(
+				"%s : %s %u created at %s and deleted in the same frame, "
+				"pool it", getCallSiteName(getCallSite(file, line)).c_str(),
+				getObjectName(kind), id,
+				getCallSiteName(object.site).c_str());
+			breakOnWarning(false, message);
+		}
+		++churn.sameFrame;
+	}
+
+	_objects.erase(iter);
+}
+
+void gl::endFrameObjects()
+{
+	Churn_m::iterator iter;
+	foreach(_churn_sites)
+	{
+		Churn_t& churn = iter->second;
+		churn.lastFrameCreated = churn.frameCreated;
+		if (churn.frameCreated > churn.peakFrameCreated)
+			churn.peakFrameCreated = churn.frameCreated;
+		churn.frameCreated = 0;
+	}
+
+	_objects_last_frame = _objects_frame;
+	_objects_frame = 0;
+}
+
+static bool sortChurnSites(
+	const std::pair<hash_t,uint>& a, const std::pair<hash_t,uint>& b)
+{
+	return a.second > b.second;
+}
+
+const String gl::getObjectChurnReport()
+{
+	String report;
+
+	report << format("object churn (deleted within %u frames): "
+		"created last frame %u, live %u\n", _churn_frames,
+		_objects_last_frame, static_cast<uint>(_objects.size()));
+
+	// most short lived objects first
+	Vector<std::pair<hash_t,uint> > sites;
+	Churn_m::Iterator iter;
+	foreach(_churn_sites)
+	{
+		if (iter->second.shortLived)
+			sites.push_back(std::make_pair(iter->first,
+				iter->second.shortLived));
+	}
+
+	std::sort(sites.begin(), sites.end(), sortChurnSites);
+
+	for (size_t i = 0; i < sites.size(); ++i)
+	{
+		const Churn_t& churn = _churn_sites[sites[i].first];
+
+		report << format("  %s (%s) created:%u deleted:%u short:%u "
+			"same frame:%u avg life:%.1f frames, per frame last:%u peak:%u\n",
+			getCallSiteName(churn.site).c_str(), getObjectName(churn.kind),
+			churn.created, churn.deleted, churn.shortLived, churn.sameFrame,
+			static_cast<double>(churn.lifetime) / churn.deleted,
+			churn.lastFrameCreated, churn.peakFrameCreated);
+	}
+
+	return report;
+}
+
+// live objects --------------------------------------------------------
+uint64_t gl::getObjectMemory(const Object_t& object)
+{
+	switch (object.kind)
+	{
+		case OBJECT_BUFFER:
+			return getBufferSize(object.id);
+		case OBJECT_TEXTURE:
+		{
+			const Texture_t* texture = getTexture(object.id);
+			return texture ? texture->memory : 0;
+		}
+		case OBJECT_RENDERBUFFER:
+		{
+			const Renderbuffer_t* renderbuffer = getRenderbuffer(object.id);
+			return renderbuffer ? renderbuffer->memory : 0;
+		}
+		default:
+			return 0;
+	}
+}
+
+void gl::getLiveSites(uint sinceFrame, LiveSite_m& sites)
+{
+	Object_m::Iterator iter;
+	foreach(_objects)
+	{
+		const Object_t& object = iter->second;
+
+		if (object.frame < sinceFrame)
+			continue;
+
+		LiveSite_t& site = sites[object.site * 33 + object.kind];
+
+		if (!site.count || object.frame < site.firstFrame)
+			site.firstFrame = object.frame;
+
+		site.kind = object.kind;
+		site.site = object.site;
+		++site.count;
+		site.memory += getObjectMemory(object);
+		site.ids.push_back(object.id);
+	}
+}
+
+bool gl::getObjectOrigin(uint kind, uint id, uint& frame, String& site)
+{
+	Object_m::Iterator iter =
+		_objects.find((static_cast<uint64_t>(kind) << 32) | id);
+
+	if (iter == _objects.end())
+		return false;
+
+	frame = iter->second.frame;
+	site = getCallSiteName(iter->second.site);
+	return true;
+}
+
+typedef std::pair<uint64_t,uint> LiveOrder_t;
+
+static bool sortLiveSites(
+	const std::pair<hash_t,LiveOrder_t>& a,
+	const std::pair<hash_t,LiveOrder_t>& b)
+{
+	return a.second > b.second;
+}
+
+const String gl::getLiveObjectReport()
+{
+	LiveSite_m sites;
+	getLiveSites(0, sites);
+
+	uint64_t memory = 0;
+	LiveSite_m::Iterator iter;
+	foreach(sites)
+		memory += iter->second.memory;
+
+	String report;
+
+	report << format("live objects: %u, memory %s\n",
+		static_cast<uint>(_objects.size()), formatBytes(memory).c_str());
+
+	// biggest memory first (then biggest count)
+	Vector<std::pair<hash_t,LiveOrder_t> > order;
+	foreach(sites)
+	{
+		order.push_back(std::make_pair(iter->first,
+			LiveOrder_t(iter->second.memory, iter->second.count)));
+	}
+
+	std::sort(order.begin(), order.end(), sortLiveSites);
+
+	for (size_t i = 0; i < order.size(); ++i)
+	{
+		const LiveSite_t& site = sites[order[i].first];
+
+		report << format("  %s (%s) count:%u memory:%s oldest:frame %u\n",
+			getCallSiteName(site.site).c_str(), getObjectName(site.kind),
+			site.count, formatBytes(site.memory).c_str(), site.firstFrame);
+	}
+
+	return report;
+}
+
+const String gl::getLeakReport(uint sinceFrame)
+{
+	LiveSite_m sites;
+	getLiveSites(sinceFrame, sites);
+
+	String report;
+
+	if (sites.empty())
+	{
+		report << format("leaks: none since frame %u\n", sinceFrame);
+		return report;
+	}
+
+	uint count = 0;
+	uint64_t memory = 0;
+	LiveSite_m::Iterator iter;
+	foreach(sites)
+	{
+		count += iter->second.count;
+		memory += iter->second.memory;
+	}
+
+	report << format("leaks: %u objects (%s) not deleted since frame %u\n",
+		count, formatBytes(memory).c_str(), sinceFrame);
+
+	foreach(sites)
+	{
+		const LiveSite_t& site = iter->second;
+
+		report << format("  %s (%s) count:%u memory:%s ids:",
+			getCallSiteName(site.site).c_str(), getObjectName(site.kind),
+			site.count, formatBytes(site.memory).c_str());
+
+		// first ids only
+		for (size_t i = 0; i < site.ids.size() && i < 16; ++i)
+			report << format(" %u", site.ids[i]);
+
+		if (site.ids.size() > 16)
+			report << " ...";
+
+		report << "\n";
+	}
+
+	return report;
+}
+
+// uniforms ------------------------------------------------------------
+bool gl::addUniform(GLint location, const void* data, uint size,
+	GLsizei count, const char* file, int line)
+{
+	const uint program = get_program_bound();
+
+	// location -1 is silently ignored by opengl
+	if (program == INVALID_BOUND || location < 0 || !data || !size ||
+		count <= 0)
+		return true;
+
+	const hash_t site = getCallSite(file, line);
+	const uint bytes = size * count;
+
+	_uniform_total.add(bytes);
+
+	Upload_t& entry = _uniform_sites[site];
+	entry.site = site;
+	entry.add(bytes);
+
+	// one value per array element at its own location, an element set
+	// on its own updates the same entry
+	const uint64_t key = static_cast<uint64_t>(program) << 32;
+	const uchar* src = static_cast<const uchar*>(data);
+	const Vector<GLint>* locations = nullptr;
+	uint first = 0;
+	GLsizei entries = count;
+	uint entrySize = size;
+
+	UniformElement_m::Iterator element = _uniform_elements.find(key |
+		location);
+
+	if (element != _uniform_elements.end())
+	{
+		UniformArray_m::Iterator array = _uniform_arrays.find(key |
+			element->second.base);
+
+		locations = &array->second;
+		first = element->second.element;
+
+		// the elements past the end of the array are ignored
+		if (first + entries > locations->size())
+			entries = static_cast<GLsizei>(locations->size() - first);
+	}
+	// layout unknown : the values are kept as one entry
+	else if (count > 1)
+	{
+		entries = 1;
+		entrySize = size * count;
+	}
+
+	bool same = true;
+
+	for (GLsizei i = 0; i < entries && same; ++i)
+	{
+		const GLint at = locations ? (*locations)[first + i] : location;
+
+		if (at < 0)
+			continue;
+
+		Uniform_m::iterator iter = _uniforms.find(key | at);
+
+		same = iter != _uniforms.end() && iter->second.size() == entrySize &&
+			Simd::equal(&iter->second[0], src + i * entrySize, entrySize);
+	}
+
+	if (same)
+	{
+		Upload_t& redundant = _uniform_redundant_sites[site];
+
+		if (!redundant.calls)
+		{
+			const String message = format(
+				"%s : uniform %d of program %u set to its current value",
+				getCallSiteName(site).c_str(), location, program);
+			breakOnWarning(false, message);
+		}
+
+		redundant.site = site;
+		redundant.add(bytes);
+		_uniform_redundant.add(bytes);
+		return false;
+	}
+
+	for (GLsizei i = 0; i < entries; ++i)
+	{
+		const GLint at = locations ? (*locations)[first + i] : location;
+
+		if (at >= 0)
+			_uniforms[key | at].assign(src + i * entrySize,
+				src + (i + 1) * entrySize);
+	}
+
+	return true;
+}
+
+void gl::releaseUniforms(uint program)
+{
+	const uint64_t first = static_cast<uint64_t>(program) << 32;
+	const uint64_t last = static_cast<uint64_t>(program + 1) << 32;
+
+	_uniforms.erase(_uniforms.lower_bound(first), _uniforms.lower_bound(last));
+	_uniform_locations.erase(_uniform_locations.lower_bound(first),
+		_uniform_locations.lower_bound(last));
+	_uniform_elements.erase(_uniform_elements.lower_bound(first),
+		_uniform_elements.lower_bound(last));
+	_uniform_arrays.erase(_uniform_arrays.lower_bound(first),
+		_uniform_arrays.lower_bound(last));
+}
+
+uint gl::getUniformNameId(const char* name)
+{
+	Map<String,uint>::iterator iter = _uniform_names.find(name);
+
+	if (iter != _uniform_names.end())
+		return iter->second;
+
+	const uint id = static_cast<uint>(_uniform_names.size());
+	_uniform_names[name] = id;
+	return id;
+}
+
+void gl::setUniformLocations(uint program)
+{
+	GLint status = GL_FALSE;
+	gl_GetProgramiv(program, GL_LINK_STATUS, &status);
+
+	if (status != GL_TRUE)
+		return;
+
+	GLint count = 0;
+	GLint length = 0;
+	gl_GetProgramiv(program, GL_ACTIVE_UNIFORMS, &count);
+	gl_GetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &length);
+
+	if (count <= 0 || length <= 0)
+		return;
+
+	Vector<GLchar> name(length + 16);
+	const uint64_t key = static_cast<uint64_t>(program) << 32;
+
+	for (GLint i = 0; i < count; ++i)
+	{
+		GLsizei size = 0;
+		GLint elements = 0;
+		GLenum type = GL_NONE;
+
+		gl_GetActiveUniform(program, i, length, &size, &elements, &type,
+			&name[0]);
+
+		if (size <= 0)
+			continue;
+
+		String base(&name[0], size);
+
+		// arrays : "name[0]" is reported, "name" and "name[i]" are valid
+		// (only a trailing index : "s[0].f" is a member of a struct)
+		const size_t bracket = (!base.empty() &&
+			base[base.size() - 1] == ']') ? base.rfind('[') : String::npos;
+		if (bracket != String::npos)
+			base.resize(bracket);
+
+		Vector<GLint> array;
+
+		for (GLint e = 0; e < elements; ++e)
+		{
+			String element = base;
+			if (bracket != String::npos)
+				element << format("[%d]", e);
+
+			const uint64_t start = Core::now();
+			const GLint location = gl_GetUniformLocation(program,
+				element.c_str());
+			_location_driver_time += Core::now() - start;
+			++_location_driver_calls;
+
+			_uniform_locations[key | getUniformNameId(element.c_str())] =
+				location;
+
+			if (!e && bracket != String::npos)
+				_uniform_locations[key | getUniformNameId(base.c_str())] =
+					location;
+
+			array.push_back(location);
+		}
+
+		// element of each location of the array (addUniform())
+		if (elements > 1 && array[0] >= 0)
+		{
+			for (GLint e = 0; e < elements; ++e)
+			{
+				if (array[e] < 0)
+					continue;
+
+				UniformElement_t& entry = _uniform_elements[key | array[e]];
+				entry.base = array[0];
+				entry.element = e;
+			}
+
+			_uniform_arrays[key | array[0]] = array;
+		}
+	}
+
+	// the driver may leave an error behind an unused program
+	get_last_error();
+}
+
+void gl::addLocationQuery(uint64_t time, bool cached, const char* file,
+	int line)
+{
+	const hash_t site_id = getCallSite(file, line);
+	LocationSite_t& site = _location_sites[site_id];
+
+	if (site.calls && site.lastFrame != frame)
+	{
+		// second frame : the location is looked up in the frame loop
+		if (site.frames == 1)
+		{
+			const String message = format(
+				"%s : glGetUniformLocation called every frame, keep the "
+				"location after glLinkProgram",
+				getCallSiteName(site_id).c_str());
+			breakOnWarning(false, message);
+		}
+	}
+
+	if (!site.calls || site.lastFrame != frame)
+		++site.frames;
+
+	site.site = site_id;
+	site.lastFrame = frame;
+	++site.calls;
+	site.time += time;
+
+	if (cached)
+		++site.cached;
+}
+
+static bool sortLocationSites(
+	const std::pair<hash_t,uint>& a, const std::pair<hash_t,uint>& b)
+{
+	return a.second > b.second;
+}
+
+const String gl::getUniformLocationReport()
+{
+	const uint64_t driver = _location_driver_calls ?
+		_location_driver_time / _location_driver_calls : 0;
+
+	String report;
+
+	report << format("uniform locations: cache %s, %u names, %u entries, "
+		"driver lookup ~%.2fus\n",
+		_uniform_location_cache ? "enabled" : "disabled",
+		static_cast<uint>(_uniform_names.size()),
+		static_cast<uint>(_uniform_locations.size()), driver / 1000.0);
+
+	// called in the most frames first
+	Vector<std::pair<hash_t,uint> > sites;
+	LocationSite_m::Iterator iter;
+	foreach(_location_sites)
+		sites.push_back(std::make_pair(iter->first, iter->second.frames));
+
+	std::sort(sites.begin(), sites.end(), sortLocationSites);
+
+	for (size_t i = 0; i < sites.size(); ++i)
+	{
+		const LocationSite_t& site = _location_sites[sites[i].first];
+
+		// without the cache, every call is a driver lookup
+		const uint64_t uncached = site.time +
+			static_cast<uint64_t>(site.cached) * driver;
+
+		report << format("  %s%s calls:%u frames:%u cached:%u time:%.2fus "
+			"(uncached ~%.2fus)\n", getCallSiteName(site.site).c_str(),
+			site.frames > 1 ? " (frame loop)" : "", site.calls, site.frames,
+			site.cached, site.time / 1000.0, uncached / 1000.0);
+	}
+
+	return report;
+}
+
+const String gl::getUniformReport()
+{
+	String report;
+
+	report << format("uniforms: last frame %u calls (%u redundant), "
+		"total %u calls (%u redundant, %s)\n",
+		static_cast<uint>(_uniform_total.lastFrameCalls),
+		static_cast<uint>(_uniform_redundant.lastFrameCalls),
+		static_cast<uint>(_uniform_total.calls),
+		static_cast<uint>(_uniform_redundant.calls),
+		formatBytes(_uniform_redundant.bytes).c_str());
+
+	// most redundant calls first
+	Vector<std::pair<hash_t,uint64_t> > sites;
+	Upload_m::Iterator iter;
+	foreach(_uniform_redundant_sites)
+		sites.push_back(std::make_pair(iter->first, iter->second.calls));
+
+	std::sort(sites.begin(), sites.end(), sortUploadSites);
+
+	for (size_t i = 0; i < sites.size(); ++i)
+	{
+		const Upload_t& redundant = _uniform_redundant_sites[sites[i].first];
+		const Upload_t& all = _uniform_sites[sites[i].first];
+
+		report << format("  %s redundant:%u/%u calls (%.0f%%) last frame:%u/%u "
+			"bytes:%s\n",
+			getCallSiteName(redundant.site).c_str(),
+			static_cast<uint>(redundant.calls), static_cast<uint>(all.calls),
+			100.0 * redundant.calls / all.calls,
+			static_cast<uint>(redundant.lastFrameCalls),
+			static_cast<uint>(all.lastFrameCalls),
+			formatBytes(redundant.bytes).c_str());
+	}
+
+	return report;
+}
+
+// shaders -------------------------------------------------------------
+/** 64 bits hash : two 32 bits hashes with other seeds, chained */
+static inline uint64_t hash64(const void* data, size_t size, uint64_t seed)
+{
+	const uint32_t low = Simd::hash(data, size,
+		static_cast<uint32_t>(seed));
+	const uint32_t high = Simd::hash(data, size,
+		static_cast<uint32_t>(seed >> 32) ^ 0x9E3779B9);
+
+	return (static_cast<uint64_t>(high) << 32) | low;
+}
+
+void gl::addShaderTime(uint64_t time)
+{
+	_shader_time_frame += time;
+	_shader_time_total += time;
+
+	if (!frame)
+		_shader_time_startup += time;
+}
+
+gl::ProgramPrep_t* gl::getFirstUseProgram()
+{
+	if (_program_preps.empty())
+		return nullptr;
+
+	ProgramPrep_m::iterator iter = _program_preps.find(get_program_bound());
+
+	if (iter == _program_preps.end() || !iter->second.firstUse)
+		return nullptr;
+
+	return &iter->second;
+}
+
+void gl::setFirstUse(ProgramPrep_t* prep, uint64_t time)
+{
+	prep->firstUse = false;
+	prep->firstUseTime = time;
+	addShaderTime(time);
+}
+
+void gl::endFrameShaders()
+{
+	_shader_time_last_frame = _shader_time_frame;
+	if (_shader_time_frame > _shader_time_peak)
+		_shader_time_peak = _shader_time_frame;
+	_shader_time_frame = 0;
+}
+
+static bool sortProgramPreps(
+	const std::pair<uint,uint64_t>& a, const std::pair<uint,uint64_t>& b)
+{
+	return a.second > b.second;
+}
+
+const String gl::getShaderReport()
+{
+	String report;
+
+	report << format("shaders: startup %.2fms, last frame %.2fms, "
+		"peak frame %.2fms, total %.2fms\n",
+		_shader_time_startup / 1e6, _shader_time_last_frame / 1e6,
+		_shader_time_peak / 1e6, _shader_time_total / 1e6);
+
+	// slowest programs first (link + first draw)
+	Vector<std::pair<uint,uint64_t> > programs;
+	ProgramPrep_m::Iterator iter;
+	foreach(_program_preps)
+	{
+		programs.push_back(std::make_pair(iter->first,
+			iter->second.linkTime + iter->second.firstUseTime));
+	}
+
+	std::sort(programs.begin(), programs.end(), sortProgramPreps);
+
+	for (size_t i = 0; i < programs.size(); ++i)
+	{
+		const ProgramPrep_t& prep = _program_preps[programs[i].first];
+
+		report << format("  program %-4u %s links:%u link:%.2fms "
+			"first draw:%s\n", programs[i].first,
+			getCallSiteName(prep.site).c_str(), prep.links,
+			prep.linkTime / 1e6, prep.firstUse ? "pending" :
+			format("%.2fms", prep.firstUseTime / 1e6).c_str());
+	}
+
+	// same source compiled more than once
+	ShaderSource_m::Iterator source;
+	for (source = _shader_sources.begin(); source != _shader_sources.end();
+		++source)
+	{
+		const ShaderSource_t& entry = source->second;
+
+		if (entry.compiles < 2)
+			continue;
+
+		report << format("  source %016llx %s compiled %u times (%.2fms)\n",
+			static_cast<unsigned long long>(entry.hash), getCallSiteName(entry.site).c_str(), entry.compiles,
+			entry.time / 1e6);
+	}
+
+	if (!_program_binary_dir.empty())
+	{
+		report << format("  program binaries (%s): hits:%u misses:%u "
+			"rejected:%u collisions:%u\n", _program_binary_dir.c_str(),
+			_program_binary_hits, _program_binary_misses,
+			_program_binary_rejects, _program_binary_collisions);
+	}
+
+	return report;
+}
+
+// program binary cache ------------------------------------------------
+static const uint32_t PROGRAM_BINARY_MAGIC = 0x42504C47;	// "GLPB"
+static const uint32_t PROGRAM_BINARY_VERSION = 2;
+
+bool gl::getProgramBinaryInputs(uint program, Vector<uint64_t>& inputs)
+{
+	ProgramInputs_m::Iterator iter = _program_inputs.find(program);
+
+	if (iter == _program_inputs.end() || iter->second.shaders.empty())
+		return false;
+
+	inputs.clear();
+
+	for (size_t i = 0; i < iter->second.shaders.size(); ++i)
+	{
+		Map<uint,uint64_t>::Iterator hash =
+			_shader_hashes.find(iter->second.shaders[i]);
+
+		if (hash == _shader_hashes.end())
+			return false;
+
+		inputs.push_back(hash->second);
+	}
+
+	// the attach order does not change the program
+	std::sort(inputs.begin(), inputs.end());
+
+	// bindings sorted by name : the call order does not matter either
+	uint64_t attribs = 0;
+	Map<String,GLuint>::Iterator attrib;
+	for (attrib = iter->second.attribs.begin();
+		attrib != iter->second.attribs.end(); ++attrib)
+	{
+		attribs = hash64(attrib->first.data(), attrib->first.size(),
+			attribs + attrib->second);
+	}
+	inputs.push_back(attribs);
+
+	// a driver update invalidates the binaries
+	if (!_program_binary_driver)
+	{
+		const GLenum names[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+		String driver;
+
+		for (uint i = 0; i < 3; ++i)
+		{
+			const GLubyte* name = gl_GetString(names[i]);
+			if (name)
+				driver << reinterpret_cast<const char*>(name);
+		}
+
+		_program_binary_driver = Simd::hash(driver.data(), driver.size());
+	}
+
+	return true;
+}
+
+String gl::getProgramBinaryPath(const Vector<uint64_t>& inputs)
+{
+	// only picks the file : the header holds the full inputs
+	const uint32_t key = Simd::hash(&inputs[0],
+		inputs.size() * sizeof(uint64_t), _program_binary_driver);
+
+	return format("%s/%08x.bin", _program_binary_dir.c_str(), key);
+}
+
+bool gl::readProgramBinaryHeader(FILE* fp, ProgramBinaryHeader_t& header,
+	Vector<uint64_t>& inputs)
+{
+	// a few shaders and the attribute bindings
+	const bool valid = fread(&header, sizeof(header), 1, fp) == 1 &&
+		header.magic == PROGRAM_BINARY_MAGIC &&
+		header.version == PROGRAM_BINARY_VERSION &&
+		header.driver == _program_binary_driver &&
+		header.inputs && header.inputs <= 64;
+
+	if (!valid)
+		return false;
+
+	inputs.resize(header.inputs);
+	return fread(&inputs[0], sizeof(uint64_t), header.inputs, fp) ==
+		header.inputs;
+}
+
+bool gl::loadProgramBinary(uint program, const Vector<uint64_t>& inputs,
+	uint64_t& time)
+{
+	const String path = getProgramBinaryPath(inputs);
+	FILE* fp = fopen(path.c_str(), "rb");
+
+	if (!fp)
+	{
+		++_program_binary_misses;
+		return false;
+	}
+
+	ProgramBinaryHeader_t header;
+	Vector<uint64_t> stored;
+	Vector<uchar> binary;
+
+	const bool known = readProgramBinaryHeader(fp, header, stored);
+
+	// same file name is not enough : another program may collide, its
+	// file is left as it is
+	if (!known || stored != inputs)
+	{
+		fclose(fp);
+
+		if (known)
+			++_program_binary_collisions;
+
+		++_program_binary_misses;
+		return false;
+	}
+
+	// the length comes from the disk : not past the end of the file
+	const long position = ftell(fp);
+	fseek(fp, 0, SEEK_END);
+	const long end = ftell(fp);
+
+	bool valid = header.length && position >= 0 && end >= position &&
+		static_cast<uint64_t>(end - position) >= header.length;
+
+	if (valid)
+	{
+		fseek(fp, position, SEEK_SET);
+		binary.resize(header.length);
+		valid = fread(&binary[0], 1, header.length, fp) == header.length;
+	}
+
+	fclose(fp);
+
+	// truncated file : linked and stored again
+	if (!valid)
+	{
+		++_program_binary_rejects;
+		return false;
+	}
+
+	GLint status = GL_FALSE;
+	const uint64_t start = Core::now();
+
+	gl_ProgramBinaryOES(program, header.format, &binary[0],
+		header.length);
+
+	// a rejected binary only fails the link status
+	get_last_error();
+	gl_GetProgramiv(program, GL_LINK_STATUS, &status);
+
+	time = Core::now() - start;
+
+	// same inputs but the driver does not take it : link and store it
+	// again
+	if (status != GL_TRUE)
+	{
+		remove(path.c_str());
+		++_program_binary_rejects;
+		return false;
+	}
+
+	++_program_binary_hits;
+	return true;
+}
+
+void gl::saveProgramBinary(uint program, const Vector<uint64_t>& inputs)
+{
+	const String path = getProgramBinaryPath(inputs);
+
+	// the file of other link inputs (name collision) stays to its program
+	FILE* fp = fopen(path.c_str(), "rb");
+
+	if (fp)
+	{
+		ProgramBinaryHeader_t header;
+		Vector<uint64_t> stored;
+
+		const bool other = readProgramBinaryHeader(fp, header, stored) &&
+			stored != inputs;
+		fclose(fp);
+
+		if (other)
+			return;
+	}
+
+	GLint length = 0;
+	gl_GetProgramiv(program, GL_PROGRAM_BINARY_LENGTH_OES, &length);
+
+	if (length <= 0)
+		return;
+
+	Vector<uchar> binary(length);
+	GLsizei written = 0;
+	GLenum binaryFormat = GL_NONE;
+
+	gl_GetProgramBinaryOES(program, length, &written, &binaryFormat,
+		&binary[0]);
+
+	if (get_last_error() || written <= 0)
+		return;
+
+	fp = fopen(path.c_str(), "wb");
+
+	if (!fp)
+	{
+		breakOnWarning(false,
+			format("program binary cache : can't write %s", path.c_str()));
+		return;
+	}
+
+	ProgramBinaryHeader_t header;
+	header.magic = PROGRAM_BINARY_MAGIC;
+	header.version = PROGRAM_BINARY_VERSION;
+	header.driver = _program_binary_driver;
+	header.inputs = static_cast<uint32_t>(inputs.size());
+	header.format = binaryFormat;
+	header.length = static_cast<uint32_t>(written);
+
+	fwrite(&header, sizeof(header), 1, fp);
+	fwrite(&inputs[0], sizeof(uint64_t), inputs.size(), fp);
+	fwrite(&binary[0], 1, written, fp);
+	fclose(fp);
+}
+
+// call timings --------------------------------------------------------
+bool gl::isSyncCall(const char* name)
+{
+	// the queries answered from the driver state are not listed
+	static const char* names[] = {
+		"Finish", "Flush"
+	};
+	// with their vendor/type suffixes
+	static const char* prefixes[] = {
+		"ReadPixels", "ReadnPixels", "GetError", "GetQueryObject",
+		"GetProgramBinary", "GetProgramiv", "GetShaderiv",
+		"ClientWaitSync", "MapBuffer", "TestFence", "FinishFence"
+	};
+
+	for (uint i = 0; i < sizeof(names) / sizeof(names[0]); ++i)
+	{
+		if (!strcmp(name, names[i]))
+			return true;
+	}
+
+	for (uint i = 0; i < sizeof(prefixes) / sizeof(prefixes[0]); ++i)
+	{
+		if (!strncmp(name, prefixes[i], strlen(prefixes[i])))
+			return true;
+	}
+	return false;
+}
+
+uint gl::getCallCategory(const char* name)
+{
+	static const char* draws[] = {
+		"DrawArrays", "DrawElements", "DrawRangeElements", "MultiDraw"
+	};
+	static const char* states[] = {
+		"Bind", "Enable", "Disable", "UseProgram", "Blend", "Depth",
+		"Cull", "FrontFace", "Stencil", "Viewport", "Scissor", "ColorMask",
+		"PolygonOffset", "LineWidth", "ActiveTexture", "VertexAttrib",
+		"PixelStore", "TexParameter", "SampleCoverage", "ClearColor",
+		"ClearDepth", "ClearStencil", "Uniform"
+	};
+
+	for (uint i = 0; i < sizeof(draws) / sizeof(draws[0]); ++i)
+	{
+		if (!strncmp(name, draws[i], strlen(draws[i])))
+			return CALL_DRAW;
+	}
+
+	for (uint i = 0; i < sizeof(states) / sizeof(states[0]); ++i)
+	{
+		if (!strncmp(name, states[i], strlen(states[i])))
+			return CALL_STATE;
+	}
+	return CALL_OTHER;
+}
+
+void gl::addCallTime(const char* api, const char* name, uint64_t time,
+	const char* file, int line)
+{
+	CallTiming_t& timing = _call_timings[name];
+
+	if (!timing.calls)
+	{
+		timing.api = api;
+		timing.name = name;
+		timing.sync = isSyncCall(name);
+		// the egl entry points are neither draws nor state changes
+		timing.category = api == egl::_api ? CALL_OTHER :
+			getCallCategory(name);
+		timing.mean = static_cast<double>(time);
+	}
+
+	// far above the usual duration of this entry point
+	const double baseline = timing.mean + 4.0 * timing.deviation;
+	const bool outlier = timing.calls >= CALL_TIMING_WARMUP &&
+		time > baseline;
+
+	if (outlier)
+		++timing.outliers;
+
+	// rolling mean and mean deviation (1/16 weight)
+	const double delta = static_cast<double>(time) - timing.mean;
+	timing.mean += delta / 16.0;
+	timing.deviation += ((delta < 0 ? -delta : delta) - timing.deviation) / 16.0;
+
+	++timing.calls;
+	timing.total += time;
+	addZoneCall(timing, time);
+	if (time > timing.max)
+		timing.max = time;
+
+	// no baseline during the warmup
+	if (_stall_threshold && time >= _stall_threshold)
+		addStall(timing, time, timing.calls > CALL_TIMING_WARMUP ?
+			static_cast<uint64_t>(baseline) : 0, file, line);
+}
+
+void gl::addStall(const CallTiming_t& timing, uint64_t time,
+	uint64_t baseline, const char* file, int line)
+{
+	Stall_t stall;
+	stall.frame = frame;
+	stall.call = format("%s%s", timing.api, timing.name);
+	stall.site = getCallSite(file, line);
+	stall.time = time;
+	stall.baseline = baseline;
+	stall.sync = timing.sync;
+
+	// the calls of the frame before the stall (oldest first)
+	const uint size = _call_history.size();
+	const uint first = size > STALL_WINDOW ? size - STALL_WINDOW : 0;
+
+	for (uint i = first; i < size; ++i)
+	{
+		const History_t& entry = _call_history(i);
+		stall.history.push_back(format("%s (%s@%d)%s%s", entry.call.c_str(),
+			get_path(entry.file.c_str()).c_str(), entry.line,
+			entry.result.empty() ? "" : " : ", entry.result.c_str()));
+	}
+
+	const String message = format(
+		"%s : %s stalled %.2fms (baseline %.3fms)%s in frame %u",
+		getCallSiteName(stall.site).c_str(), stall.call.c_str(), time / 1e6,
+		baseline / 1e6, stall.sync ? " [sync]" : "", frame);
+
+	if (_stalls.size() >= RESERVED_STALLS)
+		_stalls.erase(_stalls.begin());
+
+	_stalls.push_back(stall);
+	++_stall_count;
+
+	breakOnWarning(false, message);
+}
+
+static bool sortCallTimings(
+	const std::pair<const char*,uint64_t>& a,
+	const std::pair<const char*,uint64_t>& b)
+{
+	return a.second > b.second;
+}
+
+const String gl::getCallTimingReport(uint top)
+{
+	String report;
+
+	report << format("call timings: %u entry points, %u stalls\n",
+		static_cast<uint>(_call_timings.size()), _stall_count);
+
+	// most time spent first
+	Vector<std::pair<const char*,uint64_t> > entries;
+	CallTiming_m::Iterator iter;
+	foreach(_call_timings)
+		entries.push_back(std::make_pair(iter->first, iter->second.total));
+
+	std::sort(entries.begin(), entries.end(), sortCallTimings);
+
+	for (size_t i = 0; i < entries.size() && i < top; ++i)
+	{
+		const CallTiming_t& timing = _call_timings[entries[i].first];
+
+		const String name = format("%s%s", timing.api, timing.name);
+
+		report << format("  %-30s%s calls:%-8u total:%.2fms "
+			"baseline:%.2fus max:%.2fus outliers:%u\n", name.c_str(),
+			timing.sync ? " [sync]" : "       ",
+			static_cast<uint>(timing.calls), timing.total / 1e6,
+			timing.mean / 1e3, timing.max / 1e3, timing.outliers);
+	}
+
+	return report;
+}
+
+const String gl::getStallReport()
+{
+	String report;
+
+	report << format("stalls: %u since init, threshold %.2fms\n",
+		_stall_count, _stall_threshold / 1e6);
+
+	for (size_t i = 0; i < _stalls.size(); ++i)
+	{
+		const Stall_t& stall = _stalls[i];
+
+		report << format("  frame %u %s %s %.2fms (baseline %.3fms)%s\n",
+			stall.frame, getCallSiteName(stall.site).c_str(),
+			stall.call.c_str(), stall.time / 1e6, stall.baseline / 1e6,
+			stall.sync ? " [sync]" : "");
+
+		for (size_t j = 0; j < stall.history.size(); ++j)
+			report << "    " << stall.history[j] << "\n";
+	}
+
+	return report;
+}
+
+// gpu profiling -------------------------------------------------------
+void gl::setGpuProfiling(uint level)
+{
+	if (level > GPU_PROFILING_DRAW)
+		level = GPU_PROFILING_DRAW;
+
+	if (level != GPU_PROFILING_OFF && !(gl_GenQueriesEXT &&
+		gl_QueryCounterEXT && gl_BeginQueryEXT && gl_EndQueryEXT &&
+		gl_GetQueryObjectuivEXT && gl_GetQueryObjectui64vEXT &&
+		Extensions::has("GL_EXT_disjoint_timer_query")))
+	{
+		breakOnWarning(false,
+			"gpu profiling : GL_EXT_disjoint_timer_query not supported");
+		level = GPU_PROFILING_OFF;
+	}
+
+	if (level != GPU_PROFILING_OFF)
+	{
+		// some drivers only support GL_TIME_ELAPSED_EXT
+		GLint bits = 0;
+		if (gl_GetQueryivEXT)
+			gl_GetQueryivEXT(GL_TIMESTAMP_EXT, GL_QUERY_COUNTER_BITS_EXT,
+				&bits);
+		get_last_error();
+
+		_gpu_timestamps = bits > 0;
+
+		// elapsed queries can't be nested : whole frames only
+		if (!_gpu_timestamps && level > GPU_PROFILING_FRAME)
+		{
+			breakOnWarning(false,
+				"gpu profiling : no timestamp queries, frames only");
+			level = GPU_PROFILING_FRAME;
+		}
+	}
+
+	// the open timings are not closed, the pending ones are still read
+	if (level == GPU_PROFILING_OFF)
+	{
+		for (size_t i = 0; i < _gpu_groups.size(); ++i)
+			releaseGpuQuery(_gpu_groups[i]);
+
+		if (!_gpu_timestamps && _gpu_frame.begin)
+			gl_EndQueryEXT(GL_TIME_ELAPSED_EXT);
+
+		releaseGpuQuery(_gpu_frame);
+		_gpu_groups.clear();
+	}
+
+	_gpu_profiling = level;
+}
+
+bool gl::getGpuFrameTime(uint frame, uint64_t& ns)
+{
+	const GpuFrame_t& entry = _gpu_frames[frame % GPU_FRAMES];
+
+	if (entry.frame != frame || !entry.time)
+		return false;
+
+	ns = entry.time;
+	return true;
+}
+
+uint gl::getGpuQuery()
+{
+	if (_gpu_queries.empty())
+	{
+		// the gpu does not answer : don't grow forever
+		if (_gpu_query_count >= GPU_QUERIES)
+		{
+			++_gpu_dropped;
+			return 0;
+		}
+
+		GLuint ids[GPU_QUERY_BATCH] = {0};
+		gl_GenQueriesEXT(GPU_QUERY_BATCH, ids);
+
+		for (uint i = GPU_QUERY_BATCH; i > 0; --i)
+		{
+			if (ids[i - 1])
+				_gpu_queries.push_back(ids[i - 1]);
+		}
+
+		_gpu_query_count += GPU_QUERY_BATCH;
+
+		if (_gpu_queries.empty())
+			return 0;
+	}
+
+	const uint id = _gpu_queries.back();
+	_gpu_queries.pop_back();
+	return id;
+}
+
+gl::GpuQuery_t gl::beginGpuQuery(uint level, hash_t key,
+	const String& name)
+{
+	GpuQuery_t query;
+	query.frame = frame;
+	query.key = key;
+
+	// first timing of this key
+	GpuSite_t& site = _gpu_sites[key];
+	if (!site.level)
+	{
+		site.level = level;
+		site.name = name;
+	}
+
+	// the application may use its own elapsed query
+	if (!_gpu_timestamps && _gpu_app_elapsed)
+		return query;
+
+	query.begin = getGpuQuery();
+	if (!query.begin)
+		return query;
+
+	if (_gpu_timestamps)
+		gl_QueryCounterEXT(query.begin, GL_TIMESTAMP_EXT);
+	else
+		gl_BeginQueryEXT(GL_TIME_ELAPSED_EXT, query.begin);
+
+	return query;
+}
+
+void gl::endGpuQuery(GpuQuery_t& query)
+{
+	if (!query.begin)
+		return;
+
+	if (_gpu_timestamps)
+	{
+		query.end = getGpuQuery();
+
+		if (!query.end)
+		{
+			releaseGpuQuery(query);
+			return;
+		}
+
+		gl_QueryCounterEXT(query.end, GL_TIMESTAMP_EXT);
+	}
+	else
+	{
+		gl_EndQueryEXT(GL_TIME_ELAPSED_EXT);
+	}
+
+	_gpu_pending.push_back(query);
+	query = GpuQuery_t();
+}
+
+void gl::releaseGpuQuery(GpuQuery_t& query)
+{
+	if (query.begin)
+		_gpu_queries.push_back(query.begin);
+
+	if (query.end)
+		_gpu_queries.push_back(query.end);
+
+	query = GpuQuery_t();
+}
+
+gl::GpuQuery_t gl::beginGpuDraw(const char* call, const char* file,
+	int line)
+{
+	if (_gpu_profiling < GPU_PROFILING_DRAW)
+		return GpuQuery_t();
+
+	const hash_t site = getCallSite(file, line);
+	const hash_t key = site * 33 + GPU_PROFILING_DRAW;
+
+	// the name is only built for a new call site
+	if (_gpu_sites.find(key) == _gpu_sites.end())
+	{
+		return beginGpuQuery(GPU_PROFILING_DRAW, key,
+			format("%s %s", getCallSiteName(site).c_str(), call));
+	}
+
+	return beginGpuQuery(GPU_PROFILING_DRAW, key, String());
+}
+
+void gl::pushGpuGroup(GLsizei length, const GLchar* message)
+{
+	if (_gpu_profiling < GPU_PROFILING_GROUP)
+		return;
+
+	// length <= 0 : null terminated
+	String name;
+	if (message)
+		name = length > 0 ? String(message, length) : String(message);
+
+	const hash_t key = Core::hash(name.c_str()) * 33 + GPU_PROFILING_GROUP;
+
+	_gpu_groups.push_back(beginGpuQuery(GPU_PROFILING_GROUP, key, name));
+}
+
+void gl::popGpuGroup()
+{
+	// groups pushed before the profiling started
+	if (_gpu_groups.empty())
+		return;
+
+	endGpuQuery(_gpu_groups.back());
+	releaseGpuQuery(_gpu_groups.back());
+	_gpu_groups.pop_back();
+}
+
+void gl::addGpuTime(const GpuQuery_t& query, uint64_t time)
+{
+	GpuSite_t& site = _gpu_sites[query.key];
+
+	++site.count;
+	site.total += time;
+	if (time > site.max)
+		site.max = time;
+
+	if (site.frame != query.frame)
+	{
+		site.frame = query.frame;
+		site.frameTime = 0;
+	}
+	site.frameTime += time;
+
+	GpuFrame_t& entry = _gpu_frames[query.frame % GPU_FRAMES];
+
+	if (entry.frame != query.frame)
+		entry = GpuFrame_t();
+
+	entry.frame = query.frame;
+
+	if (site.level == GPU_PROFILING_FRAME)
+	{
+		entry.time = time;
+		_gpu_last_frame_time = time;
+	}
+	else if (site.level == GPU_PROFILING_DRAW)
+	{
+		entry.draws += time;
+	}
+}
+
+void gl::endFrameGpu()
+{
+	if (_gpu_profiling != GPU_PROFILING_OFF)
+		endGpuQuery(_gpu_frame);
+
+	if (!_gpu_pending.empty())
+	{
+		// the timings in flight are not reliable (power state, ...)
+		GLint disjoint = GL_FALSE;
+		gl_GetIntegerv(GL_GPU_DISJOINT_EXT, &disjoint);
+
+		size_t done = 0;
+
+		if (disjoint)
+		{
+			++_gpu_disjoint;
+			done = _gpu_pending.size();
+
+			for (size_t i = 0; i < done; ++i)
+				releaseGpuQuery(_gpu_pending[i]);
+		}
+
+		// oldest first : stop at the first one not ready
+		for (; done < _gpu_pending.size(); ++done)
+		{
+			GpuQuery_t& query = _gpu_pending[done];
+
+			if (query.frame + GPU_READBACK_FRAMES > frame)
+				break;
+
+			const uint last = query.end ? query.end : query.begin;
+			GLuint available = GL_FALSE;
+			gl_GetQueryObjectuivEXT(last, GL_QUERY_RESULT_AVAILABLE_EXT,
+				&available);
+
+			if (!available)
+				break;
+
+			GLuint64 begin = 0, end = 0;
+			gl_GetQueryObjectui64vEXT(query.begin, GL_QUERY_RESULT_EXT,
+				&begin);
+
+			if (query.end)
+			{
+				gl_GetQueryObjectui64vEXT(query.end, GL_QUERY_RESULT_EXT,
+					&end);
+				addGpuTime(query, end > begin ? end - begin : 0);
+			}
+			else
+			{
+				addGpuTime(query, begin);
+			}
+
+			releaseGpuQuery(query);
+		}
+
+		_gpu_pending.erase(_gpu_pending.begin(),
+			_gpu_pending.begin() + done);
+
+		// not an error of the application
+		get_last_error();
+	}
+
+	// timing of the next frame
+	if (_gpu_profiling != GPU_PROFILING_OFF)
+	{
+		_gpu_frame = beginGpuQuery(GPU_PROFILING_FRAME, GPU_PROFILING_FRAME,
+			"frame");
+		_gpu_frame.frame = frame + 1;
+	}
+}
+
+static bool sortGpuSites(
+	const std::pair<hash_t,uint64_t>& a,
+	const std::pair<hash_t,uint64_t>& b)
+{
+	return a.second > b.second;
+}
+
+const String gl::getGpuReport(uint top)
+{
+	static const char* levels[] = { "off", "frame", "group", "draw" };
+
+	String report;
+
+	report << format("gpu profiling: %s (%s), %u pending, %u queries, "
+		"%u disjoint, %u dropped\n", levels[_gpu_profiling],
+		_gpu_timestamps ? "timestamps" : "elapsed",
+		static_cast<uint>(_gpu_pending.size()), _gpu_query_count,
+		_gpu_disjoint, _gpu_dropped);
+
+	// last frames read back
+	for (uint i = 0; i < GPU_FRAMES; ++i)
+	{
+		const uint id = frame >= i ? frame - i : 0;
+		const GpuFrame_t& entry = _gpu_frames[id % GPU_FRAMES];
+
+		if (entry.frame != id || !entry.time)
+			continue;
+
+		report << format("  last frame %u : %.3fms (draws %.3fms)\n",
+			entry.frame, entry.time / 1e6, entry.draws / 1e6);
+		break;
+	}
+
+	// most time spent first
+	Vector<std::pair<hash_t,uint64_t> > entries;
+	GpuSite_m::Iterator iter;
+	foreach(_gpu_sites)
+		entries.push_back(std::make_pair(iter->first, iter->second.total));
+
+	std::sort(entries.begin(), entries.end(), sortGpuSites);
+
+	for (size_t i = 0; i < entries.size() && i < top; ++i)
+	{
+		const GpuSite_t& site = _gpu_sites[entries[i].first];
+
+		if (!site.count)
+			continue;
+
+		report << format("  [%-5s] %s count:%-8u total:%.2fms avg:%.2fus "
+			"max:%.2fus frame %u:%.2fus\n", levels[site.level],
+			site.name.c_str(), static_cast<uint>(site.count),
+			site.total / 1e6, site.total / 1e3 / site.count,
+			site.max / 1e3, site.frame, site.frameTime / 1e3);
+	}
+
+	return report;
+}
+
+// debug output --------------------------------------------------------
+void gl::setDebugOutput(bool enable, bool skipGetError)
+{
+	if (!enable)
+	{
+		if (!_debug_output)
+			return;
+
+		_debug_output = false;
+		_debug_errors = false;
+
+		// back to the application callback and states
+		gl_DebugMessageCallbackKHR(_app_debug_callback, _app_debug_param);
+
+		if (!is_cap_enabled(GL_DEBUG_OUTPUT_SYNCHRONOUS_KHR))
+			gl_Disable(GL_DEBUG_OUTPUT_SYNCHRONOUS_KHR);
+		if (!is_cap_enabled(GL_DEBUG_OUTPUT_KHR))
+			gl_Disable(GL_DEBUG_OUTPUT_KHR);
+
+		get_last_error();
+		return;
+	}
+
+	if (!gl_DebugMessageCallbackKHR || !Extensions::has("GL_KHR_debug"))
+	{
+		breakOnWarning(false, "debug output : GL_KHR_debug not supported");
+		return;
+	}
+
+	// the messages must arrive during the call that caused them
+	gl_DebugMessageCallbackKHR(debugCallback, nullptr);
+	gl_Enable(GL_DEBUG_OUTPUT_KHR);
+	gl_Enable(GL_DEBUG_OUTPUT_SYNCHRONOUS_KHR);
+
+	_debug_output = false;
+	_debug_errors = false;
+	get_last_error();
+	_debug_has_error = false;
+
+	// does the driver report the errors ? (GL_INVALID_ENUM)
+	if (skipGetError)
+	{
+		gl_Enable(GL_NONE);
+
+		_debug_errors = _debug_has_error;
+		_debug_has_error = false;
+		gl_GetError();
+	}
+
+	_debug_output = true;
+}
+
+void GL_APIENTRY gl::debugCallback(GLenum source, GLenum type, GLuint id,
+	GLenum severity, GLsizei length, const GLchar* message,
+	const void* /*userParam*/)
+{
+	String text;
+	if (message)
+		text = length > 0 ? String(message, length) : String(message);
+
+	// first error of the call in progress (see get_last_error())
+	if (type == GL_DEBUG_TYPE_ERROR_KHR && !_debug_has_error)
+	{
+		_debug_error = text;
+		_debug_has_error = true;
+	}
+
+	// error probe of setDebugOutput()
+	if (!_debug_output)
+		return;
+
+	addDebugMessage(source, type, id, severity, text);
+
+	if (_app_debug_callback)
+	{
+		_app_debug_callback(source, type, id, severity, length, message,
+			_app_debug_param);
+	}
+}
+
+void gl::addDebugMessage(GLenum source, GLenum type, GLuint id,
+	GLenum severity, const String& message)
+{
+	++_debug_message_count;
+
+	const uint64_t key = (static_cast<uint64_t>(source) << 32) | id;
+	DebugMessage_t& entry = _debug_messages[key];
+
+	if (!entry.count)
+	{
+		entry.source = source;
+		entry.type = type;
+		entry.severity = severity;
+		entry.id = id;
+	}
+
+	++entry.count;
+	entry.site = getCallSite(_call_file, _call_line);
+	entry.text = message;
+
+	if (entry.frame != frame)
+	{
+		entry.frame = frame;
+		entry.frameCount = 0;
+	}
+
+	// already reported by the wrapped call (get_last_error())
+	if (type == GL_DEBUG_TYPE_ERROR_KHR && _debug_errors)
+		return;
+
+	// same id : only the first ones of each frame
+	if (++entry.frameCount > DEBUG_MESSAGES_PER_FRAME)
+	{
+		++entry.suppressed;
+		++_debug_suppressed;
+		return;
+	}
+
+	const char* sType = is_define_khr_debug(type);
+	const char* sSeverity = is_define_khr_debug(severity);
+	const char* file = _call_file ? _call_file : "";
+
+	const String call = format("[debug %s %s #%u]", sType ? sType : "?",
+		sSeverity ? sSeverity : "?", id);
+
+	_call_history.append(
+		History_t(_call_history.size(), message.c_str(), call.c_str(),
+			file, _call_line)
+	);
+
+	const String entry_log = format("%d %s (%s@%d) : %s", frame,
+		call.c_str(), get_path(file).c_str(), _call_line, message.c_str());
+
+	if (_append_to_log_calls)
+	{
+		TRACE_WARNING(entry_log.c_str());
+	}
+
+	appendConsole(entry_log);
+}
+
+static bool sortDebugMessages(
+	const std::pair<uint64_t,uint64_t>& a,
+	const std::pair<uint64_t,uint64_t>& b)
+{
+	return a.second > b.second;
+}
+
+const String gl::getDebugMessageReport(uint top)
+{
+	String report;
+
+	report << format("debug messages: %u received, %u rate limited, "
+		"errors %s\n", _debug_message_count, _debug_suppressed,
+		_debug_errors ? "from messages" : "from glGetError");
+
+	// most frequent first
+	Vector<std::pair<uint64_t,uint64_t> > entries;
+	DebugMessage_m::Iterator iter;
+	foreach(_debug_messages)
+		entries.push_back(std::make_pair(iter->first, iter->second.count));
+
+	std::sort(entries.begin(), entries.end(), sortDebugMessages);
+
+	for (size_t i = 0; i < entries.size() && i < top; ++i)
+	{
+		const DebugMessage_t& entry = _debug_messages[entries[i].first];
+		const char* sSource = is_define_khr_debug(entry.source);
+		const char* sType = is_define_khr_debug(entry.type);
+
+		report << format("  #%u %s %s count:%u limited:%u %s : %s\n",
+			entry.id, sSource ? sSource : "?", sType ? sType : "?",
+			static_cast<uint>(entry.count),
+			static_cast<uint>(entry.suppressed),
+			getCallSiteName(entry.site).c_str(), entry.text.c_str());
+	}
+
+	return report;
+}
+
+// zones ---------------------------------------------------------------
+void gl::pushZone(GLsizei length, const GLchar* name, bool marker)
+{
+	String zone;
+	if (name)
+		zone = length > 0 ? String(name, length) : String(name);
+
+	// same name under the same parent : same zone
+	const hash_t key = ((Core::hash(zone.c_str()) * 33 + _zone_current) << 1) |
+		(marker ? 1 : 0);
+
+	Map<hash_t,uint>::iterator iter = _zone_children.find(key);
+	uint index;
+
+	if (iter == _zone_children.end())
+	{
+		Zone_t entry;
+		entry.name = zone;
+		entry.parent = _zone_current;
+		entry.depth = _zones[_zone_current].depth + 1;
+		entry.marker = marker;
+
+		index = static_cast<uint>(_zones.size());
+		_zones.push_back(entry);
+		_zone_children[key] = index;
+	}
+	else
+	{
+		index = iter->second;
+	}
+
+	Zone_t& entry = _zones[index];
+	++entry.count;
+
+	// a marker has no duration
+	if (marker)
+		return;
+
+	entry.start = Core::now();
+	_zone_current = index;
+}
+
+void gl::popZone()
+{
+	// groups pushed before gl::init() or unbalanced
+	if (!_zone_current)
+		return;
+
+	Zone_t& entry = _zones[_zone_current];
+	entry.time += Core::now() - entry.start;
+	_zone_current = entry.parent;
+}
+
+void gl::addZoneCall(const CallTiming_t& timing, uint64_t time)
+{
+	Zone_t& zone = _zones[_zone_current];
+
+	++zone.calls;
+	zone.callTime += time;
+
+	if (timing.category == CALL_DRAW)
+		++zone.draws;
+	else if (timing.category == CALL_STATE)
+		++zone.states;
+}
+
+void gl::endFrameZones()
+{
+	const uint64_t now = Core::now();
+
+	// zones still open : closed with the frame, reopened in the next one
+	Vector<uint> open;
+	for (uint i = _zone_current; i; i = _zones[i].parent)
+	{
+		_zones[i].time += now - _zones[i].start;
+		open.push_back(i);
+	}
+
+	Zone_t& root = _zones[0];
+	root.count = 1;
+	root.time = root.start ? now - root.start : 0;
+
+	// self time : children removed (children are after their parent)
+	Vector<uint64_t> self(_zones.size());
+	for (size_t i = 0; i < _zones.size(); ++i)
+		self[i] = _zones[i].time;
+
+	for (size_t i = _zones.size() - 1; i > 0; --i)
+	{
+		uint64_t& parent = self[_zones[i].parent];
+		parent -= parent > _zones[i].time ? _zones[i].time : parent;
+	}
+
+	// folded stacks : ';' separates the zones
+	Vector<String> paths(_zones.size());
+	paths[0] = "frame";
+
+	for (size_t i = 1; i < _zones.size(); ++i)
+	{
+		String name = _zones[i].name.empty() ? String("?") : _zones[i].name;
+		std::replace(name.begin(), name.end(), ';', ',');
+
+		paths[i] = paths[_zones[i].parent];
+		paths[i] << ";" << name;
+	}
+
+	for (size_t i = 0; i < _zones.size(); ++i)
+	{
+		if (!_zones[i].marker && self[i])
+			_zone_folded[paths[i]] += self[i];
+	}
+
+	_zones_last_frame.swap(_zones);
+
+	_zones.clear();
+	_zones.push_back(Zone_t());
+	_zones[0].start = now;
+	_zone_children.clear();
+	_zone_current = 0;
+
+	for (size_t i = open.size(); i > 0; --i)
+	{
+		const Zone_t& entry = _zones_last_frame[open[i - 1]];
+		pushZone(static_cast<GLsizei>(entry.name.size()), entry.name.data(),
+			false);
+		_zones[_zone_current].count = 0;
+	}
+}
+
+const String gl::getZoneReport()
+{
+	String report;
+
+	const Zone_v& zones = _zones_last_frame;
+
+	if (zones.empty())
+		return report;
+
+	// children included (children are after their parent)
+	Vector<Zone_t> totals(zones);
+	Vector<Vector<uint> > children(zones.size());
+
+	for (size_t i = zones.size() - 1; i > 0; --i)
+	{
+		Zone_t& parent = totals[zones[i].parent];
+		parent.calls += totals[i].calls;
+		parent.callTime += totals[i].callTime;
+		parent.draws += totals[i].draws;
+		parent.states += totals[i].states;
+		parent.bytes += totals[i].bytes;
+	}
+
+	for (size_t i = 1; i < zones.size(); ++i)
+		children[zones[i].parent].push_back(static_cast<uint>(i));
+
+	report << format("zones: frame %u, %u zones\n", frame ? frame - 1 : 0,
+		static_cast<uint>(zones.size() - 1));
+
+	// depth first, in push order
+	Vector<uint> stack(1, 0);
+
+	while (!stack.empty())
+	{
+		const uint index = stack.back();
+		stack.pop_back();
+
+		for (size_t i = children[index].size(); i > 0; --i)
+			stack.push_back(children[index][i - 1]);
+
+		const Zone_t& zone = zones[index];
+		const Zone_t& total = totals[index];
+		const String indent(2 + zone.depth * 2, ' ');
+		const char* name = index ? zone.name.c_str() : "frame";
+
+		if (zone.marker)
+		{
+			report << indent << format("* %s x%u\n", name, zone.count);
+			continue;
+		}
+
+		report << indent << format("%s x%u %.3fms calls:%u (%.3fms) "
+			"draws:%u states:%u uploads:%s\n", name, zone.count,
+			zone.time / 1e6, total.calls, total.callTime / 1e6, total.draws,
+			total.states, formatBytes(total.bytes).c_str());
+	}
+
+	return report;
+}
+
+const String gl::getFoldedStacks()
+{
+	String report;
+
+	Map<String,uint64_t>::Iterator iter;
+	foreach(_zone_folded)
+	{
+		report << iter->first << format(" %llu\n",
+			static_cast<unsigned long long>(iter->second));
+	}
+
+	return report;
+}
+
+// draw stream ---------------------------------------------------------
+/** glEnable caps of the render state (bit order of RenderState_t::caps) */
+static const GLenum render_caps[] = {
+	GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE, GL_STENCIL_TEST,
+	GL_SCISSOR_TEST, GL_POLYGON_OFFSET_FILL
+};
+
+/** faces of a glStencilXXXSeparate call (front : 0, back : 1) */
+static void stencil_faces(GLenum face, uint& first, uint& last)
+{
+	first = (face == GL_BACK) ? 1 : 0;
+	last = (face == GL_FRONT) ? 0 : 1;
+}
+
+uint32_t gl::getRenderStateHash()
+{
+	if (!_render_state_dirty)
+		return _render_state_hash;
+
+	_render_state.caps = 0;
+	for (uint i = 0; i < sizeof(render_caps) / sizeof(render_caps[0]); ++i)
+	{
+		if (is_cap_enabled(render_caps[i]))
+			_render_state.caps |= 1u << i;
+	}
+
+	_render_state_hash = Simd::hash(&_render_state, sizeof(_render_state));
+	_render_state_dirty = false;
+	return _render_state_hash;
+}
+
+uint32_t gl::getTextureSetHash()
+{
+	if (!_texture_set_dirty)
+		return _texture_set_hash;
+
+	_texture_set_hash = Simd::hash(_bound_texture, sizeof(_bound_texture));
+	_texture_set_dirty = false;
+	return _texture_set_hash;
+}
+
+void gl::addDraw(GLenum mode, GLenum type, uint64_t offset, GLsizei count,
+	const char* file, int line)
+{
+	// uniform calls between two draws : not a plain merge
+	const uint64_t uniforms = _uniform_total.calls - _draw_uniform_calls;
+	_draw_uniform_calls = _uniform_total.calls;
+
+	if (_draws.size() >= RESERVED_DRAWS)
+	{
+		++_draws_dropped;
+		return;
+	}
+
+	// vertex layout without the offsets, offsets apart (kept with the
+	// vertex array until its attributes change)
+	if (_vertex_array.layoutDirty)
+	{
+		uint32_t layout[VERTEX_ATTRIBS * 5];
+		const void* pointers[VERTEX_ATTRIBS];
+		uint attribs = 0;
+
+		for (uint i = 0; i < VERTEX_ATTRIBS; ++i)
+		{
+			const VertexAttrib_t& attrib = _vertex_array.attribs[i];
+
+			if (!attrib.enabled)
+				continue;
+
+			layout[attribs * 5 + 0] = i | (attrib.normalized << 8);
+			layout[attribs * 5 + 1] = attrib.size;
+			layout[attribs * 5 + 2] = attrib.type;
+			layout[attribs * 5 + 3] = attrib.stride;
+			layout[attribs * 5 + 4] = attrib.buffer;
+			pointers[attribs] = attrib.pointer;
+			++attribs;
+		}
+
+		_vertex_array.layout = Simd::hash(layout,
+			attribs * 5 * sizeof(uint32_t));
+		_vertex_array.pointers = Simd::hash(pointers,
+			attribs * sizeof(pointers[0]));
+		_vertex_array.layoutDirty = 0;
+	}
+
+	Draw_t draw;
+	draw.site = getCallSite(file, line);
+	draw.program = _program_bound == INVALID_BOUND ? 0 : _program_bound;
+	draw.framebuffer = _bound_framebuffer;
+	draw.textures = getTextureSetHash();
+	draw.state = getRenderStateHash();
+	draw.layout = _vertex_array.layout;
+	draw.pointers = _vertex_array.pointers;
+	draw.elementBuffer = type && elementArrayBuffer() ?
+		elementArrayBuffer()->id : 0;
+	draw.mode = mode;
+	draw.type = type;
+	draw.count = count > 0 ? count : 0;
+	draw.offset = offset;
+	draw.uniforms = static_cast<uint>(uniforms);
+	draw.blend = (_render_state.caps & 1) != 0;
+
+	_draws.push_back(draw);
+}
+
+uint gl::getBatchKind(const Draw_v& draws, uint first, uint last)
+{
+	const Draw_t& head = draws[first];
+
+	bool same_geometry = true;
+	bool contiguous = true;
+	bool same_pointers = true;
+
+	// strips and fans can't be appended to each other
+	const bool lists = head.mode == GL_TRIANGLES || head.mode == GL_LINES ||
+		head.mode == GL_POINTS;
+
+	const uint64_t index_size = head.type ?
+		GetTypeInfo(head.type).bytes : 1;
+
+	for (uint i = first + 1; i < last; ++i)
+	{
+		const Draw_t& prev = draws[i - 1];
+		const Draw_t& draw = draws[i];
+
+		if (draw.pointers != head.pointers)
+			same_pointers = false;
+
+		if (draw.count != head.count || draw.offset != head.offset ||
+			draw.pointers != head.pointers)
+			same_geometry = false;
+
+		if (draw.uniforms || draw.pointers != prev.pointers ||
+			draw.offset != prev.offset + prev.count * index_size)
+			contiguous = false;
+	}
+
+	if (same_geometry)
+		return BATCH_INSTANCING;
+	if (contiguous && lists)
+		return BATCH_MERGE;
+	if (!same_pointers)
+		return BATCH_BASE_VERTEX;
+	return BATCH_MULTI_DRAW;
+}
+
+void gl::endFrameDraws()
+{
+	_draws_last_frame.swap(_draws);
+	_draws.clear();
+	_batch_runs.clear();
+	_batch_saved_last_frame = 0;
+
+	const Draw_v& draws = _draws_last_frame;
+
+	for (uint first = 0; first < draws.size(); )
+	{
+		uint last = first + 1;
+
+		while (last < draws.size() && draws[last].sameBatch(draws[first]))
+			++last;
+
+		if (last - first > 1)
+		{
+			BatchRun_t run;
+			run.first = first;
+			run.draws = last - first;
+			run.kind = getBatchKind(draws, first, last);
+
+			_batch_runs.push_back(run);
+			_batch_saved_last_frame += run.draws - 1;
+		}
+
+		first = last;
+	}
+}
+
+static bool sortBatchRuns(
+	const std::pair<uint,uint>& a,
+	const std::pair<uint,uint>& b)
+{
+	return a.second > b.second;
+}
+
+const String gl::getBatchingReport(uint top)
+{
+	static const char* kinds[] = {
+		"merge into one draw",
+		"instancing (ANGLE/EXT_instanced_arrays)",
+		"base vertex (OES/EXT_draw_elements_base_vertex)",
+		"multi draw / shared buffer ranges"
+	};
+
+	String report;
+
+	report << format("batching: frame %u, %u draws, %u runs, %u draws "
+		"savable, %u draws not recorded since init\n",
+		frame ? frame - 1 : 0, static_cast<uint>(_draws_last_frame.size()),
+		static_cast<uint>(_batch_runs.size()), _batch_saved_last_frame,
+		_draws_dropped);
+
+	// longest runs first
+	Vector<std::pair<uint,uint> > entries;
+	for (size_t i = 0; i < _batch_runs.size(); ++i)
+	{
+		entries.push_back(std::make_pair(static_cast<uint>(i),
+			_batch_runs[i].draws));
+	}
+
+	std::sort(entries.begin(), entries.end(), sortBatchRuns);
+
+	for (size_t i = 0; i < entries.size() && i < top; ++i)
+	{
+		const BatchRun_t& run = _batch_runs[entries[i].first];
+		const Draw_t& head = _draws_last_frame[run.first];
+
+		report << format("  draws %u-%u (%u, saves %u) program %u : %s\n",
+			run.first, run.first + run.draws - 1, run.draws, run.draws - 1,
+			head.program, kinds[run.kind]);
+
+		// call sites of the run, in order
+		Vector<hash_t> sites;
+		for (uint j = run.first; j < run.first + run.draws; ++j)
+		{
+			const hash_t site = _draws_last_frame[j].site;
+
+			if (std::find(sites.begin(), sites.end(), site) == sites.end())
+				sites.push_back(site);
+		}
+
+		for (size_t j = 0; j < sites.size() && j < 4; ++j)
+			report << "    " << getCallSiteName(sites[j]) << "\n";
+
+		if (sites.size() > 4)
+		{
+			report << format("    ... %u more call sites\n",
+				static_cast<uint>(sites.size() - 4));
+		}
+	}
+
+	return report;
+}
+
+// state sort ----------------------------------------------------------
+void gl::countStateChanges(const Draw_v& draws, const Vector<uint>& order,
+	uint changes[STATE_SIZE])
+{
+	for (uint i = 0; i < STATE_SIZE; ++i)
+		changes[i] = 0;
+
+	for (size_t i = 1; i < order.size(); ++i)
+	{
+		const Draw_t& prev = draws[order[i - 1]];
+		const Draw_t& draw = draws[order[i]];
+
+		changes[STATE_FRAMEBUFFER] += draw.framebuffer != prev.framebuffer;
+		changes[STATE_PROGRAM] += draw.program != prev.program;
+		changes[STATE_TEXTURES] += draw.textures != prev.textures;
+		changes[STATE_RENDER] += draw.state != prev.state;
+	}
+}
+
+/** sort key of an opaque draw, most expensive dimension first */
+struct StateSortKey_t {
+	uint64_t key[3];
+	uint index;
+
+	inline bool operator<(const StateSortKey_t& rhs) const
+	{
+		for (uint i = 0; i < 3; ++i)
+		{
+			if (key[i] != rhs.key[i])
+				return key[i] < rhs.key[i];
+		}
+		return index < rhs.index;
+	}
+};
+
+const String gl::getStateSortReport()
+{
+	static const char* names[] = {
+		"framebuffer", "program", "textures", "render state"
+	};
+
+	const Draw_v& draws = _draws_last_frame;
+
+	// dimensions a sort can change, most expensive first
+	uint dimensions[3] = { STATE_PROGRAM, STATE_TEXTURES, STATE_RENDER };
+	for (uint i = 0; i < 3; ++i)
+	{
+		for (uint j = i + 1; j < 3; ++j)
+		{
+			if (_state_costs[dimensions[j]] > _state_costs[dimensions[i]])
+				std::swap(dimensions[i], dimensions[j]);
+		}
+	}
+
+	// framebuffer changes are kept : the draws are sorted per target,
+	// opaque ones first, blended ones in submission order after them
+	Vector<uint> submitted(draws.size());
+	Vector<uint> sorted;
+	sorted.reserve(draws.size());
+
+	for (uint first = 0; first < draws.size(); )
+	{
+		uint last = first;
+		Vector<StateSortKey_t> opaque;
+
+		for (; last < draws.size() &&
+			draws[last].framebuffer == draws[first].framebuffer; ++last)
+		{
+			submitted[last] = last;
+
+			if (draws[last].blend)
+				continue;
+
+			StateSortKey_t entry;
+			entry.index = last;
+
+			for (uint i = 0; i < 3; ++i)
+			{
+				const Draw_t& draw = draws[last];
+				entry.key[i] = dimensions[i] == STATE_PROGRAM ? draw.program :
+					dimensions[i] == STATE_TEXTURES ? draw.textures :
+					draw.state;
+			}
+			opaque.push_back(entry);
+		}
+
+		std::sort(opaque.begin(), opaque.end());
+
+		for (size_t i = 0; i < opaque.size(); ++i)
+			sorted.push_back(opaque[i].index);
+
+		for (uint i = first; i < last; ++i)
+		{
+			if (draws[i].blend)
+				sorted.push_back(i);
+		}
+
+		first = last;
+	}
+
+	uint current[STATE_SIZE];
+	uint best[STATE_SIZE];
+	countStateChanges(draws, submitted, current);
+	countStateChanges(draws, sorted, best);
+
+	uint64_t currentCost = 0, bestCost = 0;
+	uint dominant = 0;
+
+	for (uint i = 0; i < STATE_SIZE; ++i)
+	{
+		currentCost += static_cast<uint64_t>(current[i]) * _state_costs[i];
+		bestCost += static_cast<uint64_t>(best[i]) * _state_costs[i];
+
+		if (static_cast<uint64_t>(current[i]) * _state_costs[i] >
+			static_cast<uint64_t>(current[dominant]) * _state_costs[dominant])
+			dominant = i;
+	}
+
+	// the sort is greedy per dimension : it may cost more than the
+	// submitted order, which is then the best one
+	if (bestCost > currentCost)
+	{
+		bestCost = currentCost;
+		memcpy(best, current, sizeof(best));
+	}
+
+	String report;
+
+	report << format("state sort: frame %u, %u draws, cost %llu, sorted "
+		"%llu (%.1f%% saved), dominant: %s\n", frame ? frame - 1 : 0,
+		static_cast<uint>(draws.size()),
+		static_cast<unsigned long long>(currentCost),
+		static_cast<unsigned long long>(bestCost),
+		currentCost ? 100.0 * (currentCost - bestCost) / currentCost : 0.0,
+		currentCost ? names[dominant] : "none");
+
+	for (uint i = 0; i < STATE_SIZE; ++i)
+	{
+		report << format("  %-14s cost:%-4u changes:%-6u sorted:%-6u "
+			"weighted:%llu\n", names[i], _state_costs[i], current[i],
+			best[i], static_cast<unsigned long long>(current[i]) *
+			_state_costs[i]);
+	}
+
+	return report;
+}
+
+// textures ------------------------------------------------------------
+gl::Texture_t* gl::getTexture(uint id)
+{
+	if (id == 0)
+		return nullptr;
+
+	Texture_v::iterator iter;
+	foreach(_textures)
+	{
+		if (iter->id == id)
+			return &(*iter);
+	}
+	return nullptr;
+}
+
+gl::Texture_t* gl::getBoundTexture(GLenum target)
+{
+	const uint ltarget = getTextureTarget(target);
+
+	if (ltarget >= TEXTURE_TARGET_SIZE)
+		return nullptr;
+
+	return getTexture(_bound_texture[_active_texture][ltarget]);
+}
+
+uint gl::getTextureTarget(GLenum target)
+{
+	switch (target)
+	{
+		case GL_TEXTURE_2D:
+			return TEXTURE_2D;
+		case GL_TEXTURE_CUBE_MAP:
+		case GL_TEXTURE_CUBE_MAP_POSITIVE_X:
+		case GL_TEXTURE_CUBE_MAP_NEGATIVE_X:
+		case GL_TEXTURE_CUBE_MAP_POSITIVE_Y:
+		case GL_TEXTURE_CUBE_MAP_NEGATIVE_Y:
+		case GL_TEXTURE_CUBE_MAP_POSITIVE_Z:
+		case GL_TEXTURE_CUBE_MAP_NEGATIVE_Z:
+			return TEXTURE_CUBE_MAP;
+		case GL_TEXTURE_3D_OES:
+			return TEXTURE_3D;
+	}
+	return TEXTURE_TARGET_SIZE;
+}
+
+uint gl::getTextureFace(GLenum target)
+{
+	if (target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X &&
+		target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z)
+	{
+		return target - GL_TEXTURE_CUBE_MAP_POSITIVE_X;
+	}
+	return 0;
+}
+
+uint gl::getFormatComponents(GLenum format)
+{
+	switch (format)
+	{
+		case GL_LUMINANCE_ALPHA: return 2;
+		case GL_RGB: return 3;
+		case GL_RGBA: return 4;
+		case GL_BGRA_EXT: return 4;
+	}
+	// GL_ALPHA, GL_LUMINANCE, GL_DEPTH_COMPONENT, ...
+	return 1;
+}
+
+uint64_t gl::getTexelSize(GLenum internalformat, GLenum type)
+{
+	const Type& typeInfo = GetTypeInfo(type);
+
+	// unsized format : size given by the type
+	if (typeInfo.bytes)
+	{
+		// packed types (565, 4444, ...) store a whole texel
+		if (typeInfo.specialInterpretation)
+			return typeInfo.bytes;
+
+		return getFormatComponents(internalformat) * typeInfo.bytes;
+	}
+
+	// sized format (glTexStorage, glRenderbufferStorage)
+	switch (internalformat)
+	{
+		case GL_STENCIL_INDEX8:
+		case GL_ALPHA8_EXT:
+		case GL_LUMINANCE8_EXT:
+		case GL_R8_EXT:
+			return 1;
+		case GL_RGBA4:
+		case GL_RGB5_A1:
+		case GL_RGB565:
+		case GL_DEPTH_COMPONENT16:
+		case GL_LUMINANCE8_ALPHA8_EXT:
+		case GL_RG8_EXT:
+			return 2;
+		case GL_RGB8_OES:
+			return 3;
+		case GL_RGBA8_OES:
+		case GL_BGRA8_EXT:
+		case GL_RGB10_A2_EXT:
+		// most drivers pad 24 bits depth to 32 bits
+		case GL_DEPTH_COMPONENT24_OES:
+		case GL_DEPTH_COMPONENT32_OES:
+		case GL_DEPTH24_STENCIL8_OES:
+			return 4;
+		case GL_RGB16F_EXT:
+			return 6;
+		case GL_RGBA16F_EXT:
+			return 8;
+		case GL_RGB32F_EXT:
+			return 12;
+		case GL_RGBA32F_EXT:
+			return 16;
+	}
+	return 0;
+}
+
+uint64_t gl::getCompressedSize(GLenum internalformat,
+	GLsizei width, GLsizei height, GLsizei depth)
+{
+	if (width <= 0 || height <= 0 || depth <= 0)
+		return 0;
+
+	uint64_t blockWidth = 4;
+	uint64_t blockHeight = 4;
+	uint64_t blockBytes = 0;
+
+	switch (internalformat)
+	{
+		// 4x4 blocks, 64 bits
+		case GL_ETC1_RGB8_OES:
+		case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+		case GL_ATC_RGB_AMD:
+#if defined(GL_COMPRESSED_RGB8_ETC2)
+		case GL_COMPRESSED_RGB8_ETC2:
+		case GL_COMPRESSED_SRGB8_ETC2:
+		case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+		case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+		case GL_COMPRESSED_R11_EAC:
+		case GL_COMPRESSED_SIGNED_R11_EAC:
+#endif // GL_COMPRESSED_RGB8_ETC2
+			blockBytes = 8;
+			break;
+
+		// 4x4 blocks, 128 bits
+		case GL_COMPRESSED_RGBA_S3TC_DXT3_ANGLE:
+		case GL_COMPRESSED_RGBA_S3TC_DXT5_ANGLE:
+		case GL_ATC_RGBA_EXPLICIT_ALPHA_AMD:
+		case GL_ATC_RGBA_INTERPOLATED_ALPHA_AMD:
+#if defined(GL_COMPRESSED_RGBA8_ETC2_EAC)
+		case GL_COMPRESSED_RGBA8_ETC2_EAC:
+		case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
+		case GL_COMPRESSED_RG11_EAC:
+		case GL_COMPRESSED_SIGNED_RG11_EAC:
+#endif // GL_COMPRESSED_RGBA8_ETC2_EAC
+			blockBytes = 16;
+			break;
+
+		// pvrtc : 8x8 (4bpp) or 16x8 (2bpp) minimum
+		case GL_COMPRESSED_RGB_PVRTC_4BPPV1_IMG:
+		case GL_COMPRESSED_RGBA_PVRTC_4BPPV1_IMG:
+			return (static_cast<uint64_t>(width < 8 ? 8 : width) *
+				(height < 8 ? 8 : height) * 4 / 8) * depth;
+		case GL_COMPRESSED_RGB_PVRTC_2BPPV1_IMG:
+		case GL_COMPRESSED_RGBA_PVRTC_2BPPV1_IMG:
+			return (static_cast<uint64_t>(width < 16 ? 16 : width) *
+				(height < 8 ? 8 : height) * 2 / 8) * depth;
+
+		default:
+		{
+			// astc : 128 bits blocks of variable footprint
+			static const uchar astc[][2] = {
+				{4,4}, {5,4}, {5,5}, {6,5}, {6,6}, {8,5}, {8,6},
+				{8,8}, {10,5}, {10,6}, {10,8}, {10,10}, {12,10}, {12,12}
+			};
+			static const uint astc_size = sizeof(astc) / sizeof(astc[0]);
+
+			uint index = astc_size;
+			if (internalformat >= GL_COMPRESSED_RGBA_ASTC_4x4_KHR &&
+				internalformat < GL_COMPRESSED_RGBA_ASTC_4x4_KHR + astc_size)
+			{
+				index = internalformat - GL_COMPRESSED_RGBA_ASTC_4x4_KHR;
+			}
+			else if (
+				internalformat >= GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR &&
+				internalformat < GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR + astc_size)
+			{
+				index = internalformat - GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR;
+			}
+
+			if (index >= astc_size)
+				return 0;
+
+			blockWidth = astc[index][0];
+			blockHeight = astc[index][1];
+			blockBytes = 16;
+		}
+	}
+
+	const uint64_t blocksX = (width + blockWidth - 1) / blockWidth;
+	const uint64_t blocksY = (height + blockHeight - 1) / blockHeight;
+	return blocksX * blocksY * blockBytes * depth;
+}
+
+uint64_t gl::getLevelSize(GLenum internalformat, GLenum type,
+	GLsizei width, GLsizei height, GLsizei depth)
+{
+	if (width <= 0 || height <= 0 || depth <= 0)
+		return 0;
+
+	const uint64_t compressed =
+		getCompressedSize(internalformat, width, height, depth);
+
+	if (compressed)
+		return compressed;
+
+	return getTexelSize(internalformat, type) * width * height * depth;
+}
+
+void gl::setTextureLevel(GLenum target, GLint level, GLenum internalformat,
+	GLenum type, GLsizei width, GLsizei height, GLsizei depth,
+	uint64_t bytes)
+{
+	Texture_t* texture = getBoundTexture(target);
+
+	if (!texture || level < 0 || level >= TEXTURE_LEVELS)
+		return;
+
+	const uint face = getTextureFace(target);
+
+	setFramebuffersDirty(GL_TEXTURE, texture->id);
+
+	if (level == 0)
+	{
+		texture->internalformat = internalformat;
+		texture->type = type;
+		texture->width = width;
+		texture->height = height;
+		texture->depth = depth;
+	}
+
+	uint64_t& size = texture->levelSize[face][level];
+	addMemory(MEMORY_TEXTURE, static_cast<int64_t>(bytes - size));
+	texture->memory += bytes - size;
+	size = bytes;
+}
+
+void gl::setTextureStorage(GLenum target, GLsizei levels,
+	GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+	const uint faces = (target == GL_TEXTURE_CUBE_MAP) ? TEXTURE_FACES : 1;
+	const bool is_3d = (target == GL_TEXTURE_3D_OES);
+
+	for (GLsizei level = 0; level < levels && level < TEXTURE_LEVELS; ++level)
+	{
+		const GLsizei w = (width >> level) ? (width >> level) : 1;
+		const GLsizei h = (height >> level) ? (height >> level) : 1;
+		const GLsizei d = is_3d ? ((depth >> level) ? (depth >> level) : 1)
+			: depth;
+
+		const uint64_t bytes = getLevelSize(internalformat, GL_NONE, w, h, d);
+
+		for (uint face = 0; face < faces; ++face)
+		{
+			setTextureLevel(
+				faces > 1 ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + face : target,
+				level, internalformat, GL_NONE, w, h, d, bytes
+			);
+		}
+	}
+}
+
+void gl::setTextureMipmaps(GLenum target)
+{
+	Texture_t* texture = getBoundTexture(target);
+
+	if (!texture)
+		return;
+
+	const uint faces = (target == GL_TEXTURE_CUBE_MAP) ? TEXTURE_FACES : 1;
+	const bool is_3d = (target == GL_TEXTURE_3D_OES);
+
+	const GLenum internalformat = texture->internalformat;
+	const GLenum type = texture->type;
+	GLsizei w = texture->width;
+	GLsizei h = texture->height;
+	GLsizei d = is_3d ? texture->depth : 1;
+
+	for (GLint level = 1; level < TEXTURE_LEVELS && (w > 1 || h > 1 ||
+		d > 1); ++level)
+	{
+		w = (w >> 1) ? (w >> 1) : 1;
+		h = (h >> 1) ? (h >> 1) : 1;
+		d = (d >> 1) ? (d >> 1) : 1;
+
+		const uint64_t bytes = getLevelSize(internalformat, type, w, h, d);
+
+		for (uint face = 0; face < faces; ++face)
+		{
+			// only the faces defined by the application
+			if (!texture->levelSize[face][0])
+				continue;
+
+			setTextureLevel(
+				faces > 1 ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + face : target,
+				level, internalformat, type, w, h, d, bytes
+			);
+		}
+	}
+}
+
+// (un)register renderbuffers ------------------------------------------
+bool gl::register_renderbuffer(uint id)
+{
+	if (getRenderbuffer(id))
+		return false;
+
+	Renderbuffer_t o;
+	o.id = id;
+	_renderbuffers.push_back(o);
+
+	return true;
+}
+
+bool gl::unregister_renderbuffer(uint id)
+{
+	Renderbuffer_v::iterator iter;
+	foreach(_renderbuffers)
+	{
+		if (iter->id == id)
+		{
+			addMemory(MEMORY_RENDERBUFFER, -static_cast<int64_t>(iter->memory));
+			_renderbuffers.erase(iter);
+
+			if (_bound_renderbuffer == id)
+				_bound_renderbuffer = 0;
+
+			return true;
+		}
+	}
+	return false;
+}
+
+gl::Renderbuffer_t* gl::getRenderbuffer(uint id)
+{
+	if (id == 0)
+		return nullptr;
+
+	Renderbuffer_v::iterator iter;
+	foreach(_renderbuffers)
+	{
+		if (iter->id == id)
+			return &(*iter);
+	}
+	return nullptr;
+}
+
+void gl::setRenderbufferStorage(GLenum internalformat, GLsizei samples,
+	GLsizei width, GLsizei height)
+{
+	Renderbuffer_t* renderbuffer = getRenderbuffer(_bound_renderbuffer);
+
+	if (!renderbuffer)
+		return;
+
+	const uint64_t bytes = getTexelSize(internalformat, GL_NONE) *
+		(width > 0 ? width : 0) * (height > 0 ? height : 0) *
+		(samples > 1 ? samples : 1);
+
+	addMemory(MEMORY_RENDERBUFFER,
+		static_cast<int64_t>(bytes - renderbuffer->memory));
+
+	renderbuffer->internalformat = internalformat;
+	renderbuffer->width = width;
+	renderbuffer->height = height;
+	renderbuffer->samples = samples;
+	renderbuffer->memory = bytes;
+
+	setFramebuffersDirty(GL_RENDERBUFFER, renderbuffer->id);
+}
+
+// (un)register framebuffers -------------------------------------------
+bool gl::register_framebuffer(uint id)
+{
+	if (id == 0 || getFramebuffer(id))
+		return false;
+
+	Framebuffer_t o;
+	o.id = id;
+	_framebuffers.push_back(o);
+
+	return true;
+}
+
+bool gl::unregister_framebuffer(uint id)
+{
+	Framebuffer_v::iterator iter;
+	foreach(_framebuffers)
+	{
+		if (iter->id == id)
+		{
+			_framebuffers.erase(iter);
+			return true;
+		}
+	}
+	return false;
+}
+
+gl::Framebuffer_t* gl::getFramebuffer(uint id)
+{
+	if (id == 0)
+		return nullptr;
+
+	Framebuffer_v::iterator iter;
+	foreach(_framebuffers)
+	{
+		if (iter->id == id)
+			return &(*iter);
+	}
+	return nullptr;
+}
+
+uint gl::getAttachmentIndex(GLenum attachment)
+{
+	switch (attachment)
+	{
+		case GL_COLOR_ATTACHMENT0: return ATTACHMENT_COLOR0;
+		case GL_DEPTH_ATTACHMENT: return ATTACHMENT_DEPTH;
+		case GL_STENCIL_ATTACHMENT: return ATTACHMENT_STENCIL;
+	}
+	return ATTACHMENT_SIZE;
+}
+
+void gl::setAttachment(GLenum attachment, GLenum kind, uint id,
+	GLint level, GLenum textarget)
+{
+	Framebuffer_t* framebuffer = getFramebuffer(_bound_framebuffer);
+	const uint index = getAttachmentIndex(attachment);
+
+	if (!framebuffer || index >= ATTACHMENT_SIZE)
+		return;
+
+	// other attachments : other pass
+	endPass();
+
+	Attachment_t& entry = framebuffer->attachments[index];
+	entry = Attachment_t();
+	framebuffer->dirty = true;
+
+	if (id)
+	{
+		entry.kind = kind;
+		entry.id = id;
+		entry.level = level;
+		entry.textarget = textarget;
+	}
+}
+
+void gl::detachObject(GLenum kind, uint id)
+{
+	// the other framebuffers keep a dangling attachment
+	setFramebuffersDirty(kind, id);
+	_pass_stored.erase((static_cast<uint64_t>(kind) << 32) | id);
+	_pass_pending.erase((static_cast<uint64_t>(kind) << 32) | id);
+
+	// only the bound framebuffer loses its attachments
+	Framebuffer_t* framebuffer = getFramebuffer(_bound_framebuffer);
+
+	if (!framebuffer || !id)
+		return;
+
+	for (uint i = 0; i < ATTACHMENT_SIZE; ++i)
+	{
+		Attachment_t& entry = framebuffer->attachments[i];
+
+		if (entry.kind == kind && entry.id == id)
+			entry = Attachment_t();
+	}
+}
+
+void gl::setFramebuffersDirty(GLenum kind, uint id)
+{
+	if (!id)
+		return;
+
+	Framebuffer_v::iterator iter;
+	foreach(_framebuffers)
+	{
+		for (uint i = 0; i < ATTACHMENT_SIZE; ++i)
+		{
+			const Attachment_t& entry = iter->attachments[i];
+
+			if (entry.kind == kind && entry.id == id)
+				iter->dirty = true;
+		}
+	}
+}
+
+bool gl::getAttachmentImage(const Attachment_t& attachment, GLenum& format,
+	GLsizei& width, GLsizei& height)
+{
+	if (attachment.kind == GL_RENDERBUFFER)
+	{
+		const Renderbuffer_t* renderbuffer = getRenderbuffer(attachment.id);
+
+		if (!renderbuffer)
+			return false;
+
+		format = renderbuffer->internalformat;
+		width = renderbuffer->width;
+		height = renderbuffer->height;
+		return true;
+	}
+
+	if (attachment.kind == GL_TEXTURE)
+	{
+		const Texture_t* texture = getTexture(attachment.id);
+
+		if (!texture)
+			return false;
+
+		// only the level 0 size is known
+		const GLint level = attachment.level > 0 && attachment.level < 31 ?
+			attachment.level : 0;
+
+		format = texture->internalformat;
+		width = texture->width >> level;
+		height = texture->height >> level;
+
+		if (level && texture->width)
+			width = width ? width : 1;
+		if (level && texture->height)
+			height = height ? height : 1;
+		return true;
+	}
+
+	return false;
+}
+
+GLenum gl::getFramebufferStatus(Framebuffer_t& framebuffer)
+{
+	// same attachments : nothing to rebuild
+	if (!framebuffer.dirty && framebuffer.status)
+	{
+		++_framebuffer_status_hits;
+		return framebuffer.status;
+	}
+
+	// configuration : kind, format, size and samples of each attachment
+	uint32_t config[ATTACHMENT_SIZE * 5];
+	bool known = true;
+
+	framebuffer.width = 0;
+	framebuffer.height = 0;
+
+	for (uint i = 0; i < ATTACHMENT_SIZE; ++i)
+	{
+		const Attachment_t& attachment = framebuffer.attachments[i];
+		GLenum format = GL_NONE;
+		GLsizei width = 0, height = 0;
+
+		uint32_t* entry = &config[i * 5];
+		entry[0] = attachment.kind;
+		entry[1] = entry[2] = entry[3] = entry[4] = 0;
+
+		if (attachment.kind == GL_NONE)
+			continue;
+
+		// deleted but still attached to another framebuffer, or an
+		// image the debugger can't see (EGLImage...) : driver only
+		if (!getAttachmentImage(attachment, format, width, height) ||
+			!format || width <= 0 || height <= 0)
+		{
+			known = false;
+			entry[1] = attachment.id;
+			continue;
+		}
+
+		const Renderbuffer_t* renderbuffer =
+			attachment.kind == GL_RENDERBUFFER ?
+				getRenderbuffer(attachment.id) : nullptr;
+
+		entry[1] = format;
+		entry[2] = width;
+		entry[3] = height;
+		entry[4] = renderbuffer ? renderbuffer->samples : 0;
+
+		// render size : the smallest attachment
+		if (!framebuffer.width || width < framebuffer.width)
+			framebuffer.width = width;
+		if (!framebuffer.height || height < framebuffer.height)
+			framebuffer.height = height;
+	}
+
+	const uint32_t key = Simd::hash(config, sizeof(config));
+
+	if (framebuffer.status && framebuffer.statusKey == key)
+	{
+		framebuffer.dirty = false;
+		++_framebuffer_status_hits;
+		return framebuffer.status;
+	}
+
+	// same configuration already checked by the driver
+	GLenum status = 0;
+	Map<uint32_t,GLenum>::iterator iter = _framebuffer_status.find(key);
+
+	if (known && iter != _framebuffer_status.end())
+	{
+		++_framebuffer_status_hits;
+		status = iter->second;
+	}
+
+	// completeness rules depend on the context version and the formats
+	// support : only the driver knows (bound framebuffer only)
+	if (!status && framebuffer.id == _bound_framebuffer)
+	{
+		++_framebuffer_status_queries;
+		status = gl_CheckFramebufferStatus(GL_FRAMEBUFFER);
+
+		// an unknown image may change behind the same key
+		if (status && known)
+			_framebuffer_status[key] = status;
+	}
+
+	framebuffer.dirty = !status;
+	framebuffer.status = status;
+	framebuffer.statusKey = key;
+	return status;
+}
+
+const char* gl::checkFramebuffer()
+{
+	Framebuffer_t* framebuffer = getFramebuffer(_bound_framebuffer);
+
+	if (!framebuffer)
+		return nullptr;
+
+	const GLenum status = getFramebufferStatus(*framebuffer);
+
+	if (!status || status == GL_FRAMEBUFFER_COMPLETE)
+		return nullptr;
+
+	const char* name = getDefineName(status);
+	return name ? name : "framebuffer incomplete";
+}
+
+const String gl::getFramebufferReport()
+{
+	static const char* attachments[] = { "color0", "depth", "stencil" };
+
+	String report;
+
+	report << format("framebuffers: %u, bound %u, %u driver checks, "
+		"%u cached answers\n", static_cast<uint>(_framebuffers.size()),
+		_bound_framebuffer, _framebuffer_status_queries,
+		_framebuffer_status_hits);
+
+	Framebuffer_v::iterator iter;
+	foreach(_framebuffers)
+	{
+		const GLenum status = getFramebufferStatus(*iter);
+		const char* name = status ? getDefineName(status) : "unknown";
+
+		report << format("  %u %dx%d %s\n", iter->id, iter->width,
+			iter->height, name ? name : "?");
+
+		for (uint i = 0; i < ATTACHMENT_SIZE; ++i)
+		{
+			const Attachment_t& attachment = iter->attachments[i];
+			GLenum internalformat = GL_NONE;
+			GLsizei width = 0, height = 0;
+
+			if (attachment.kind == GL_NONE)
+				continue;
+
+			const bool known = getAttachmentImage(attachment,
+				internalformat, width, height);
+			const char* sFormat = getDefineName(internalformat);
+
+			report << format("    %-7s %s %u level %d : %s %dx%d\n",
+				attachments[i], attachment.kind == GL_TEXTURE ?
+				"texture" : "renderbuffer", attachment.id, attachment.level,
+				known ? (sFormat ? sFormat : "?") : "deleted", width,
+				height);
+		}
+	}
+
+	return report;
+}
+
+// render passes -------------------------------------------------------
+/** glStartTilingQCOM/glEndTilingQCOM preserve bit per Attachment_id */
+static const GLbitfield pass_preserve_bits[] = {
+	GL_COLOR_BUFFER_BIT0_QCOM, GL_DEPTH_BUFFER_BIT0_QCOM,
+	GL_STENCIL_BUFFER_BIT0_QCOM
+};
+
+void gl::setDefaultFramebuffer(GLsizei width, GLsizei height,
+	uint colorBytes, uint depthBytes, uint stencilBytes)
+{
+	_default_width = width;
+	_default_height = height;
+	_default_texel[ATTACHMENT_COLOR0] = colorBytes;
+	_default_texel[ATTACHMENT_DEPTH] = depthBytes;
+	_default_texel[ATTACHMENT_STENCIL] = stencilBytes;
+	_default_size_set = true;
+}
+
+uint64_t gl::getAttachmentBytes(const Attachment_t& attachment)
+{
+	GLenum internalformat = GL_NONE;
+	GLsizei width = 0, height = 0;
+
+	if (!getAttachmentImage(attachment, internalformat, width, height))
+		return 0;
+
+	GLenum type = GL_NONE;
+	GLsizei samples = 1;
+
+	if (attachment.kind == GL_TEXTURE)
+		type = getTexture(attachment.id)->type;
+	else if (getRenderbuffer(attachment.id)->samples > 1)
+		samples = getRenderbuffer(attachment.id)->samples;
+
+	return getTexelSize(internalformat, type) *
+		(width > 0 ? width : 0) * (height > 0 ? height : 0) * samples;
+}
+
+gl::RenderPass_t& gl::getPass()
+{
+	if (_pass_open)
+		return _pass;
+
+	_pass = RenderPass_t();
+	_pass.framebuffer = _bound_framebuffer;
+	_pass_open = true;
+
+	if (!_bound_framebuffer)
+	{
+		_pass.width = _default_width;
+		_pass.height = _default_height;
+
+		for (uint i = 0; i < ATTACHMENT_SIZE; ++i)
+		{
+			PassAttachment_t& entry = _pass.attachments[i];
+
+			entry.image = (static_cast<uint64_t>(GL_FRAMEBUFFER) << 32) | i;
+			entry.bytes = static_cast<uint64_t>(_default_texel[i]) *
+				_default_width * _default_height;
+			// presented
+			entry.keep = i == ATTACHMENT_COLOR0;
+		}
+		return _pass;
+	}
+
+	Framebuffer_t* framebuffer = getFramebuffer(_bound_framebuffer);
+
+	if (!framebuffer)
+		return _pass;
+
+	getFramebufferStatus(*framebuffer);
+	_pass.width = framebuffer->width;
+	_pass.height = framebuffer->height;
+
+	for (uint i = 0; i < ATTACHMENT_SIZE; ++i)
+	{
+		const Attachment_t& attachment = framebuffer->attachments[i];
+		PassAttachment_t& entry = _pass.attachments[i];
+
+		if (attachment.kind == GL_NONE)
+			continue;
+
+		// packed depth/stencil : counted once on depth
+		if (i == ATTACHMENT_STENCIL &&
+			attachment.kind == framebuffer->attachments[ATTACHMENT_DEPTH].kind &&
+			attachment.id == framebuffer->attachments[ATTACHMENT_DEPTH].id)
+		{
+			_pass.packedStencil = true;
+			continue;
+		}
+
+		entry.image = (static_cast<uint64_t>(attachment.kind) << 32) |
+			attachment.id;
+		entry.bytes = getAttachmentBytes(attachment);
+		// can be sampled later
+		entry.keep = attachment.kind == GL_TEXTURE;
+	}
+	return _pass;
+}
+
+void gl::endPass()
+{
+	if (!_pass_open)
+		return;
+
+	_pass_open = false;
+
+	// bound and unbound without any work
+	if (!_pass.draws && !_pass.clears && !_pass.tiling)
+		return;
+
+	for (uint i = 0; i < ATTACHMENT_SIZE; ++i)
+	{
+		PassAttachment_t& entry = _pass.attachments[i];
+		const bool touched = entry.cleared || entry.drawn;
+
+		if (!entry.image)
+			continue;
+
+		entry.load = entry.drawn && !entry.cleared && !entry.invalidated;
+		entry.store = touched && !entry.discarded;
+
+		// the preserve masks decide
+		if (_pass.tiling)
+			entry.load = (_pass.startMask & pass_preserve_bits[i]) != 0;
+		if (_pass.tilingEnd)
+			entry.store = (_pass.endMask & pass_preserve_bits[i]) != 0;
+
+		_pass.bytes += (entry.load ? entry.bytes : 0) +
+			(entry.store ? entry.bytes : 0);
+	}
+
+	_passes.push_back(_pass);
+}
+
+void gl::addPassClear(GLbitfield mask)
+{
+	RenderPass_t& pass = getPass();
+	++pass.clears;
+
+	// a scissored or masked clear only writes a part of the tile
+	const bool scissor = is_cap_enabled(GL_SCISSOR_TEST);
+	const bool full[ATTACHMENT_SIZE] = {
+		!scissor && _render_state.colorMask == 0xF,
+		!scissor && _render_state.depthMask,
+		!scissor
+	};
+	const GLbitfield bits[ATTACHMENT_SIZE] = {
+		GL_COLOR_BUFFER_BIT, GL_DEPTH_BUFFER_BIT, GL_STENCIL_BUFFER_BIT
+	};
+
+	for (uint i = 0; i < ATTACHMENT_SIZE; ++i)
+	{
+		uint index = i;
+		bool whole = full[i];
+
+		// packed depth/stencil : the whole image only with the depth
+		if (i == ATTACHMENT_STENCIL && pass.packedStencil)
+		{
+			index = ATTACHMENT_DEPTH;
+			whole = whole && (mask & GL_DEPTH_BUFFER_BIT) &&
+				full[ATTACHMENT_DEPTH];
+		}
+
+		PassAttachment_t& target = pass.attachments[index];
+
+		if (!(mask & bits[i]) || !target.image)
+			continue;
+
+		target.discarded = false;
+
+		if (!whole)
+			target.drawn = true;
+		else if (target.drawn)
+			target.lateClear = true;
+		else
+			target.cleared = true;
+	}
+}
+
+void gl::addPassDraw()
+{
+	RenderPass_t& pass = getPass();
+	++pass.draws;
+
+	for (uint i = 0; i < ATTACHMENT_SIZE; ++i)
+	{
+		pass.attachments[i].drawn = true;
+		pass.attachments[i].discarded = false;
+	}
+}
+
+void gl::addPassDiscard(GLsizei count, const GLenum* attachments)
+{
+	if (!attachments)
+		return;
+
+	RenderPass_t& pass = getPass();
+
+	for (GLsizei n = 0; n < count; ++n)
+	{
+		uint index = ATTACHMENT_SIZE;
+
+		switch (attachments[n])
+		{
+			case GL_COLOR_EXT:
+			case GL_COLOR_ATTACHMENT0:
+				index = ATTACHMENT_COLOR0; break;
+			case GL_DEPTH_EXT:
+			case GL_DEPTH_ATTACHMENT:
+				index = ATTACHMENT_DEPTH; break;
+			case GL_STENCIL_EXT:
+			case GL_STENCIL_ATTACHMENT:
+				index = ATTACHMENT_STENCIL; break;
+		}
+
+		if (index >= ATTACHMENT_SIZE)
+			continue;
+
+		// packed depth/stencil : both have to be discarded
+		if (index == ATTACHMENT_STENCIL && !pass.attachments[index].image)
+			continue;
+
+		PassAttachment_t& entry = pass.attachments[index];
+
+		// discarded before any write : the old content is not needed
+		if (!entry.drawn && !entry.cleared)
+			entry.invalidated = true;
+		else
+			entry.discarded = true;
+	}
+}
+
+void gl::startPassTiling(GLbitfield preserveMask)
+{
+	endPass();
+
+	RenderPass_t& pass = getPass();
+	pass.tiling = true;
+	pass.startMask = preserveMask;
+}
+
+void gl::endPassTiling(GLbitfield preserveMask)
+{
+	RenderPass_t& pass = getPass();
+	pass.tilingEnd = true;
+	pass.endMask = preserveMask;
+
+	endPass();
+}
+
+void gl::endFramePasses()
+{
+	endPass();
+
+	_passes_last_frame.swap(_passes);
+	_passes.clear();
+	_pass_bytes_last_frame = 0;
+	_pass_needless_last_frame = 0;
+	_pass_carried_last_frame = 0;
+
+	RenderPass_v& passes = _passes_last_frame;
+
+	// a load needs a content stored earlier in the frame, or in an
+	// earlier frame for the render targets kept across frames (the
+	// default framebuffer is undefined after a swap)
+	Map<uint64_t,bool>& stored = _pass_stored;
+
+	for (uint i = 0; i < ATTACHMENT_SIZE; ++i)
+		stored.erase((static_cast<uint64_t>(GL_FRAMEBUFFER) << 32) | i);
+
+	for (uint p = 0; p < passes.size(); ++p)
+	{
+		for (uint i = 0; i < ATTACHMENT_SIZE; ++i)
+		{
+			PassAttachment_t& entry = passes[p].attachments[i];
+
+			if (!entry.image)
+				continue;
+
+			if (entry.load)
+			{
+				Map<uint64_t,bool>::iterator iter = stored.find(entry.image);
+
+				entry.needlessLoad = entry.lateClear ||
+					iter == stored.end() || !iter->second;
+			}
+
+			if (!entry.load && !entry.cleared && !entry.drawn)
+				continue;
+
+			stored[entry.image] = entry.store;
+
+			// first use of a store left pending by the last frame
+			Map<uint64_t,uint64_t>::iterator pending =
+				_pass_pending.find(entry.image);
+
+			if (pending != _pass_pending.end())
+			{
+				if (!entry.load)
+					_pass_carried_last_frame += pending->second;
+
+				_pass_pending.erase(pending);
+			}
+		}
+	}
+
+	// a store needs a later load (or to be sampled / presented)
+	Map<uint64_t,bool> loaded;
+
+	for (uint p = static_cast<uint>(passes.size()); p > 0; --p)
+	{
+		RenderPass_t& pass = passes[p - 1];
+
+		for (uint i = 0; i < ATTACHMENT_SIZE; ++i)
+		{
+			PassAttachment_t& entry = pass.attachments[i];
+
+			if (!entry.image)
+				continue;
+
+			if (entry.store && !entry.keep)
+			{
+				Map<uint64_t,bool>::iterator iter = loaded.find(entry.image);
+
+				// last use of the frame : the next frame may load it
+				// (the default framebuffer is undefined after a swap)
+				entry.pendingStore = iter == loaded.end() &&
+					(entry.image >> 32) != GL_FRAMEBUFFER;
+				entry.needlessStore = !entry.pendingStore &&
+					(iter == loaded.end() || !iter->second);
+
+				if (entry.pendingStore)
+					_pass_pending[entry.image] = entry.bytes;
+			}
+
+			if (entry.load || entry.cleared || entry.drawn)
+				loaded[entry.image] = entry.load;
+
+			pass.needless += (entry.needlessLoad ? entry.bytes : 0) +
+				(entry.needlessStore ? entry.bytes : 0);
+		}
+
+		_pass_bytes_last_frame += pass.bytes;
+		_pass_needless_last_frame += pass.needless;
+	}
+
+	_pass_needless_last_frame += _pass_carried_last_frame;
+}
+
+const String gl::getRenderPassReport()
+{
+	static const char* attachments[] = { "color0", "depth", "stencil" };
+
+	String report;
+
+	report << format("render passes: %u last frame, %s of tile memory "
+		"traffic, %s needless (%s by stores of the frame before) "
+		"(load/store per attachment, '!' : needless, '?' : used or not "
+		"by the next frame)\n",
+		static_cast<uint>(_passes_last_frame.size()),
+		formatBytes(_pass_bytes_last_frame).c_str(),
+		formatBytes(_pass_needless_last_frame).c_str(),
+		formatBytes(_pass_carried_last_frame).c_str());
+
+	for (uint p = 0; p < _passes_last_frame.size(); ++p)
+	{
+		const RenderPass_t& pass = _passes_last_frame[p];
+
+		report << format("  %2u fb %u %dx%d%s, %u draws, %u clears :", p,
+			pass.framebuffer, pass.width, pass.height,
+			pass.tiling ? " tiled" : "", pass.draws, pass.clears);
+
+		for (uint i = 0; i < ATTACHMENT_SIZE; ++i)
+		{
+			const PassAttachment_t& entry = pass.attachments[i];
+
+			if (!entry.image)
+				continue;
+
+			const char* load = entry.load ? "load" :
+				(entry.cleared ? "clear" : "-");
+			const char* store = entry.store ? "store" :
+				(entry.discarded || entry.invalidated ? "discard" : "-");
+
+			report << format(" %s %s%s/%s%s", attachments[i], load,
+				entry.needlessLoad ? "!" : "", store,
+				entry.needlessStore ? "!" : (entry.pendingStore ? "?" : ""));
+		}
+
+		report << format(" : %s", formatBytes(pass.bytes).c_str());
+
+		if (pass.needless)
+			report << format(" (%s needless)",
+				formatBytes(pass.needless).c_str());
+
+		report << "\n";
+	}
+
+	return report;
+}
+
+// damage --------------------------------------------------------------
+uint64_t gl::getRectsArea(const Rect_v& rects, GLsizei width,
+	GLsizei height)
+{
+	// coordinates of the edges clipped to the surface
+	Vector<GLint> xs, ys;
+
+	for (uint i = 0; i < rects.size(); ++i)
+	{
+		const Rect_t& rect = rects[i];
+
+		xs.push_back(std::min(std::max(rect.x, 0), width));
+		xs.push_back(std::min(std::max(rect.x + rect.width, 0), width));
+		ys.push_back(std::min(std::max(rect.y, 0), height));
+		ys.push_back(std::min(std::max(rect.y + rect.height, 0), height));
+	}
+
+	std::sort(xs.begin(), xs.end());
+	std::sort(ys.begin(), ys.end());
+	xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+	ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+
+	// union : cells of the grid covered by any rect
+	uint64_t area = 0;
+
+	for (uint x = 1; x < xs.size(); ++x)
+	{
+		for (uint y = 1; y < ys.size(); ++y)
+		{
+			for (uint i = 0; i < rects.size(); ++i)
+			{
+				const Rect_t& rect = rects[i];
+
+				if (rect.x <= xs[x - 1] && rect.x + rect.width >= xs[x] &&
+					rect.y <= ys[y - 1] && rect.y + rect.height >= ys[y])
+				{
+					area += static_cast<uint64_t>(xs[x] - xs[x - 1]) *
+						(ys[y] - ys[y - 1]);
+					break;
+				}
+			}
+		}
+	}
+	return area;
+}
+
+void gl::addRenderedRect(bool clear)
+{
+	if (_bound_framebuffer)
+		return;
+
+	Rect_t rect = clear ? Rect_t(0, 0, DAMAGE_MAX_SIZE, DAMAGE_MAX_SIZE) :
+		_viewport;
+
+	// the scissor box cuts the viewport (and clears)
+	if (is_cap_enabled(GL_SCISSOR_TEST))
+	{
+		const GLint x0 = std::max(rect.x, _scissor.x);
+		const GLint y0 = std::max(rect.y, _scissor.y);
+		const GLint x1 = std::min(rect.x + rect.width,
+			_scissor.x + _scissor.width);
+		const GLint y1 = std::min(rect.y + rect.height,
+			_scissor.y + _scissor.height);
+
+		rect = Rect_t(x0, y0, std::max(x1 - x0, 0), std::max(y1 - y0, 0));
+	}
+
+	if (rect.width <= 0 || rect.height <= 0)
+		return;
+
+	if (!_damage_rendered.empty() && _damage_rendered.back() == rect)
+		return;
+
+	// too many : their bounding box
+	if (_damage_rendered.size() >= DAMAGE_RECTS)
+	{
+		Rect_t& box = _damage_rendered.front();
+
+		for (uint i = 1; i < _damage_rendered.size(); ++i)
+			box.merge(_damage_rendered[i]);
+
+		box.merge(rect);
+		_damage_rendered.resize(1);
+		return;
+	}
+
+	_damage_rendered.push_back(rect);
+}
+
+void gl::getRects(const EGLint* rects, EGLint count, Rect_v& out)
+{
+	out.clear();
+
+	for (EGLint i = 0; rects && i < count; ++i)
+	{
+		const EGLint* rect = &rects[i * 4];
+
+		if (rect[2] > 0 && rect[3] > 0)
+			out.push_back(Rect_t(rect[0], rect[1], rect[2], rect[3]));
+	}
+}
+
+void gl::setDamageRegion(const EGLint* rects, EGLint count)
+{
+	getRects(rects, count, _damage_region);
+	_damage_region_set = count > 0;
+}
+
+void gl::addDamage(EGLDisplay dpy, EGLSurface surface, const EGLint* rects,
+	EGLint count)
+{
+	EGLint width = 0, height = 0, age = -1;
+
+	if (!eglQuerySurface(dpy, surface, EGL_WIDTH, &width) ||
+		!eglQuerySurface(dpy, surface, EGL_HEIGHT, &height) ||
+		width <= 0 || height <= 0)
+		return;
+
+	// age of the back buffer being presented (0 : undefined content)
+	if (Extensions::has(hash_EGL_EXT_buffer_age) ||
+		Extensions::has(hash_EGL_KHR_partial_update))
+	{
+		if (!eglQuerySurface(dpy, surface, EGL_BUFFER_AGE_EXT, &age))
+			age = -1;
+	}
+
+	// the render pass estimates use the real surface size
+	if (!_default_size_set)
+	{
+		_default_width = width;
+		_default_height = height;
+	}
+
+	DamageFrame_t entry;
+	entry.frame = frame;
+	entry.age = age;
+	entry.surface = static_cast<uint64_t>(width) * height;
+
+	Rect_v damage;
+	getRects(rects, count, damage);
+
+	// no rect : the whole surface
+	if (damage.empty())
+		damage.push_back(Rect_t(0, 0, width, height));
+
+	entry.damage = getRectsArea(damage, width, height);
+	entry.rendered = getRectsArea(_damage_rendered, width, height);
+
+	// rendered outside the declared damage : wasted (or missing damage)
+	Rect_v both(damage);
+	both.insert(both.end(), _damage_rendered.begin(),
+		_damage_rendered.end());
+	entry.undeclared = getRectsArea(both, width, height) - entry.damage;
+
+	// rendered outside eglSetDamageRegionKHR : undefined content
+	if (_damage_region_set)
+	{
+		Rect_v region(_damage_region);
+		region.insert(region.end(), _damage_rendered.begin(),
+			_damage_rendered.end());
+
+		if (getRectsArea(region, width, height) >
+			getRectsArea(_damage_region, width, height))
+			entry.flags |= DAMAGE_OUTSIDE_REGION;
+	}
+
+	// an "age" frames old buffer misses the damage of the "age - 1"
+	// previous swaps : all of it has to be rendered again
+	if (age >= 0)
+	{
+		Rect_v needed;
+
+		if (age == 0 || static_cast<uint>(age) > DAMAGE_AGES)
+			needed.push_back(Rect_t(0, 0, width, height));
+		else
+		{
+			needed = damage;
+
+			for (EGLint i = 1; i < age; ++i)
+			{
+				const Rect_v& old = _damage_history[
+					(_damage_history_index + DAMAGE_AGES - i) % DAMAGE_AGES];
+				needed.insert(needed.end(), old.begin(), old.end());
+			}
+		}
+
+		Rect_v covered(_damage_rendered);
+		covered.insert(covered.end(), needed.begin(), needed.end());
+
+		if (getRectsArea(covered, width, height) > entry.rendered)
+			entry.flags |= DAMAGE_STALE;
+	}
+
+	if (entry.undeclared)
+		entry.flags |= DAMAGE_UNDECLARED;
+
+	_damage_history[_damage_history_index] = damage;
+	_damage_history_index = (_damage_history_index + 1) % DAMAGE_AGES;
+
+	if (_damage_frames.size() >= DAMAGE_FRAMES)
+		_damage_frames.erase(_damage_frames.begin());
+	_damage_frames.push_back(entry);
+
+	++_damage_swaps;
+	if (entry.flags & DAMAGE_STALE)
+		++_damage_stale;
+	if (entry.flags & DAMAGE_OUTSIDE_REGION)
+		++_damage_outside_region;
+	if (entry.flags & DAMAGE_UNDECLARED)
+		++_damage_undeclared;
+
+	// next frame
+	endFrameDamage();
+}
+
+void gl::endFrameDamage()
+{
+	_damage_rendered.clear();
+	_damage_region.clear();
+	_damage_region_set = false;
+}
+
+const String gl::getDamageReport()
+{
+	String report;
+
+	report << format("damage: %u swaps, %u stale, %u outside the damage "
+		"region, %u rendered outside the damage\n", _damage_swaps,
+		_damage_stale, _damage_outside_region, _damage_undeclared);
+
+	if (_damage_frames.empty())
+		return report;
+
+	double damage = 0.0, rendered = 0.0;
+
+	for (uint i = 0; i < _damage_frames.size(); ++i)
+	{
+		const DamageFrame_t& entry = _damage_frames[i];
+
+		damage += static_cast<double>(entry.damage) / entry.surface;
+		rendered += static_cast<double>(entry.rendered) / entry.surface;
+	}
+
+	report << format("last %u swaps : %.1f%% damaged, %.1f%% rendered "
+		"(of the surface)\n", static_cast<uint>(_damage_frames.size()),
+		100.0 * damage / _damage_frames.size(),
+		100.0 * rendered / _damage_frames.size());
+
+	for (uint i = 0; i < _damage_frames.size(); ++i)
+	{
+		const DamageFrame_t& entry = _damage_frames[i];
+
+		report << format("  frame %5u age %2d : %5.1f%% damaged, %5.1f%% "
+			"rendered, %5.1f%% outside%s%s\n", entry.frame, entry.age,
+			100.0 * entry.damage / entry.surface,
+			100.0 * entry.rendered / entry.surface,
+			100.0 * entry.undeclared / entry.surface,
+			entry.flags & DAMAGE_STALE ? ", stale" : "",
+			entry.flags & DAMAGE_OUTSIDE_REGION ?
+				", outside region" : "");
+	}
+
+	return report;
+}
+
+// memory --------------------------------------------------------------
+void gl::addMemory(uint kind, int64_t bytes)
+{
+	if (kind >= MEMORY_SIZE) ne_assert(!"invalid memory kind");
+
+	// never go below zero if something was missed
+	if (bytes < 0 && static_cast<uint64_t>(-bytes) > _memory[kind])
+		_memory[kind] = 0;
+	else
+		_memory[kind] += bytes;
+}
+
+const char* gl::getMemoryName(uint kind)
+{
+	switch (kind)
+	{
+		case MEMORY_TEXTURE: return "texture";
+		case MEMORY_BUFFER: return "buffer";
+		case MEMORY_RENDERBUFFER: return "renderbuffer";
+	}
+	return "unknown";
+}
+
+void gl::endFrameMemory()
+{
+	for (uint i = 0; i < MEMORY_SIZE; ++i)
+	{
+		_memory_last_delta[i] =
+			static_cast<int64_t>(_memory[i] - _memory_frame_start[i]);
+		_memory_frame_start[i] = _memory[i];
+	}
+}
+
+uint64_t gl::getMemoryTotal()
+{
+	uint64_t total = 0;
+	for (uint i = 0; i < MEMORY_SIZE; ++i)
+		total += _memory[i];
+	return total;
+}
+
+int64_t gl::getMemoryDeltaLastFrame()
+{
+	int64_t delta = 0;
+	for (uint i = 0; i < MEMORY_SIZE; ++i)
+		delta += _memory_last_delta[i];
+	return delta;
+}
+
+struct MemoryObject_t {
+	MemoryObject_t(uint kind, uint id, uint64_t bytes) :
+		kind(kind), id(id), bytes(bytes) {}
+
+	uint kind;
+	uint id;
+	uint64_t bytes;
+};
+
+static bool sortMemoryObjects(const MemoryObject_t& a, const MemoryObject_t& b)
+{
+	return a.bytes > b.bytes;
+}
+
+const String gl::getMemoryReport(uint top)
+{
+	String report;
+
+	const int64_t delta = getMemoryDeltaLastFrame();
+
+	report << "memory: " << formatBytes(getMemoryTotal())
+		<< ", last frame " << (delta < 0 ? "-" : "+")
+		<< formatBytes(delta < 0 ? -delta : delta) << "\n";
+
+	for (uint i = 0; i < MEMORY_SIZE; ++i)
+	{
+		const int64_t d = _memory_last_delta[i];
+
+		report << format("  %-14s %-10s last frame:%s%s\n",
+			getMemoryName(i), formatBytes(_memory[i]).c_str(),
+			d < 0 ? "-" : "+", formatBytes(d < 0 ? -d : d).c_str());
+	}
+
+	// biggest objects first
+	Vector<MemoryObject_t> objects;
+
+	{
+		Texture_v::Iterator iter;
+		foreach(_textures)
+		{
+			if (iter->memory)
+				objects.push_back(
+					MemoryObject_t(MEMORY_TEXTURE, iter->id, iter->memory));
+		}
+	}
+	{
+		Buffer_v::Iterator iter;
+		foreach(_buffers)
+		{
+			if (iter->size)
+				objects.push_back(
+					MemoryObject_t(MEMORY_BUFFER, iter->id, iter->size));
+		}
+	}
+	{
+		Renderbuffer_v::Iterator iter;
+		foreach(_renderbuffers)
+		{
+			if (iter->memory)
+				objects.push_back(MemoryObject_t(
+					MEMORY_RENDERBUFFER, iter->id, iter->memory));
+		}
+	}
+
+	std::sort(objects.begin(), objects.end(), sortMemoryObjects);
+
+	for (size_t i = 0; i < objects.size() && i < top; ++i)
+	{
+		report << format("  %s %u : %s\n", getMemoryName(objects[i].kind),
+			objects[i].id, formatBytes(objects[i].bytes).c_str());
+	}
+
+	return report;
+}
+
+// shadow store --------------------------------------------------------
+void gl::setShadowing(bool enable, uint64_t budget)
+{
+	_shadowing = enable;
+	_shadow.budget(budget);
+
+	if (!enable)
+	{
+		_shadow.clear();
+		_shadow_rows.clear();
+		_index_ranges.clear();
+	}
+}
+
+ShadowStore::Key gl::getShadowKey(uint kind, uint id, uint face, uint level)
+{
+	return (static_cast<ShadowStore::Key>(kind & 0xFF) << 56) |
+		(static_cast<ShadowStore::Key>(id) << 16) |
+		((face & 0xFF) << 8) | (level & 0xFF);
+}
+
+void gl::shadowBufferData(uint id, uint64_t size, const void* data)
+{
+	if (!_shadowing || id == INVALID_BOUND)
+		return;
+
+	const ShadowStore::Key key = getShadowKey(SHADOW_BUFFER, id);
+
+	invalidateIndexRanges(id);
+	_shadow.resize(key, size);
+
+	if (data)
+		_shadow.write(key, 0, data, size);
+}
+
+void gl::shadowBufferSubData(uint id, uint64_t offset, uint64_t size,
+	const void* data)
+{
+	if (!_shadowing || id == INVALID_BOUND)
+		return;
+
+	const ShadowStore::Key key = getShadowKey(SHADOW_BUFFER, id);
+
+	invalidateIndexRanges(id);
+
+	// out of range / unknown content : the copy is no longer valid
+	if (!_shadow.write(key, offset, data, size))
+		_shadow.release(key);
+}
+
+void gl::shadowTexImage(GLenum target, GLint level, GLsizei width,
+	GLsizei height, GLenum format, GLenum type, const void* pixels)
+{
+	if (!_shadowing)
+		return;
+
+	const Texture_t* texture = getBoundTexture(target);
+
+	if (!texture || width <= 0 || height <= 0)
+		return;
+
+	const ShadowStore::Key key = getShadowKey(SHADOW_TEXTURE, texture->id,
+		getTextureFace(target), level);
+
+	const uint64_t row = getImageSize(width, 1, 1, format, type);
+
+	_shadow.resize(key, row * height);
+	_shadow_rows[key] = row;
+
+	if (!pixels)
+		return;
+
+	// client rows are padded to GL_UNPACK_ALIGNMENT
+	const uint64_t pitch = (getImageSize(width, 2, 1, format, type) - row);
+	const uchar* src = static_cast<const uchar*>(pixels);
+
+	for (GLsizei y = 0; y < height; ++y)
+		_shadow.write(key, y * row, src + y * pitch, row);
+}
+
+void gl::shadowTexSubImage(GLenum target, GLint level, GLint xoffset,
+	GLint yoffset, GLsizei width, GLsizei height, GLenum format,
+	GLenum type, const void* pixels)
+{
+	if (!_shadowing)
+		return;
+
+	const Texture_t* texture = getBoundTexture(target);
+
+	if (!texture || width <= 0 || height <= 0)
+		return;
+
+	const ShadowStore::Key key = getShadowKey(SHADOW_TEXTURE, texture->id,
+		getTextureFace(target), level);
+
+	Map<ShadowStore::Key,uint64_t>::Iterator iter = _shadow_rows.find(key);
+
+	if (iter == _shadow_rows.end() || !_shadow.has(key))
+		return;
+
+	const uint64_t levelRow = iter->second;
+	const uint64_t row = getImageSize(width, 1, 1, format, type);
+	const uint64_t pitch = (getImageSize(width, 2, 1, format, type) - row);
+	const uint64_t texel = row / width;
+	const uchar* src = static_cast<const uchar*>(pixels);
+
+	for (GLsizei y = 0; y < height && pixels; ++y)
+	{
+		const uint64_t offset = (yoffset + y) * levelRow + xoffset * texel;
+
+		if (!_shadow.write(key, offset, src + y * pitch, row))
+		{
+			_shadow.release(key);
+			return;
+		}
+	}
+}
+
+void gl::releaseShadowTexture(uint id)
+{
+	const ShadowStore::Key first = getShadowKey(SHADOW_TEXTURE, id, 0, 0);
+	const ShadowStore::Key last = getShadowKey(SHADOW_TEXTURE, id, 0xFF, 0xFF);
+
+	_shadow.release(first, last);
+	_shadow_rows.erase(
+		_shadow_rows.lower_bound(first), _shadow_rows.upper_bound(last));
+}
+
+bool gl::readShadowBuffer(uint id, uint64_t offset, void* dst,
+	uint64_t size)
+{
+	return _shadow.read(getShadowKey(SHADOW_BUFFER, id), offset, dst, size);
+}
+
+bool gl::readShadowTexture(uint id, GLenum target, GLint level, void* dst,
+	uint64_t size)
+{
+	return _shadow.read(
+		getShadowKey(SHADOW_TEXTURE, id, getTextureFace(target), level),
+		0, dst, size);
+}
+
+uint gl::snapshotShadowBuffer(uint id)
+{
+	const uint snapshot = ++_shadow_snapshot;
+
+	if (!_shadow.clone(getShadowKey(SHADOW_BUFFER, id),
+		getShadowKey(SHADOW_SNAPSHOT, snapshot)))
+	{
+		return 0;
+	}
+	return snapshot;
+}
+
+bool gl::readShadowSnapshot(uint snapshot, uint64_t offset, void* dst,
+	uint64_t size)
+{
+	return _shadow.read(
+		getShadowKey(SHADOW_SNAPSHOT, snapshot), offset, dst, size);
+}
+
+void gl::releaseShadowSnapshot(uint snapshot)
+{
+	_shadow.release(getShadowKey(SHADOW_SNAPSHOT, snapshot));
+}
+
+const String gl::getShadowReport()
+{
+	return format("shadow: %s, entries:%u used:%s peak:%s reserved:%s "
+		"budget:%s dropped:%u\n",
+		_shadowing ? "enabled" : "disabled",
+		static_cast<uint>(_shadow.size()),
+		formatBytes(_shadow.used()).c_str(),
+		formatBytes(_shadow.peak()).c_str(),
+		formatBytes(_shadow.reserved()).c_str(),
+		formatBytes(_shadow.budget()).c_str(),
+		static_cast<uint>(_shadow.evicted()));
+}
+
+// index ranges --------------------------------------------------------
+uint64_t gl::getBufferSize(uint id)
+{
+	Buffer_v::Iterator iter;
+	foreach(_buffers)
+	{
+		if (iter->id == id)
+			return iter->size;
+	}
+	return 0;
+}
+
+bool gl::getMaxIndex(uint buffer, GLenum type, uint64_t offset,
+	GLsizei count, uint& maxIndex)
+{
+	const IndexRange_t range(buffer, type, offset, count);
+
+	IndexRange_m::Iterator iter = _index_ranges.find(range);
+
+	if (iter != _index_ranges.end())
+	{
+		maxIndex = iter->second;
+		return true;
+	}
+
+	const uint bytes = GetTypeInfo(type).bytes;
+	const ShadowStore::Key key = getShadowKey(SHADOW_BUFFER, buffer);
+
+	if (!_shadowing || !bytes || count <= 0 || !_shadow.has(key))
+		return false;
+
+	// read the indices once, the scan is then cached
+	static Vector<uchar> indices;
+	indices.resize(static_cast<size_t>(count) * bytes);
+
+	if (!_shadow.read(key, offset, &indices[0], indices.size()))
+		return false;
+
+	maxIndex = Simd::maxIndex(&indices[0], count, bytes);
+
+	// many different ranges : start again
+	if (_index_ranges.size() >= RESERVED_INDEX_RANGES)
+		_index_ranges.clear();
+
+	_index_ranges[range] = maxIndex;
+	return true;
+}
+
+void gl::invalidateIndexRanges(uint buffer)
+{
+	_index_ranges.erase(
+		_index_ranges.lower_bound(IndexRange_t(buffer, 0, 0, 0)),
+		_index_ranges.lower_bound(IndexRange_t(buffer + 1, 0, 0, 0))
+	);
+}
+
+bool gl::checkVertexAttribs(uint maxIndex)
+{
+	updateVertexLimits();
+
+	if (static_cast<int64_t>(maxIndex) <= _vertex_array.maxVertex)
+		return true;
+
+	const uint i = _vertex_array.limitAttrib;
+	const VertexAttrib_t& attrib = _vertex_array.attribs[i];
+
+	const String message = format(
+		"vertex attrib %u : vertex %u reads past the end of buffer %u "
+		"(size:%u, last vertex:%d)", i, maxIndex, attrib.buffer,
+		static_cast<uint>(getBufferSize(attrib.buffer)),
+		static_cast<int>(attrib.maxVertex)
+	);
+	breakOnError(false, message);
+	return false;
+}
+
+void gl::updateVertexLimits()
+{
+	if (!_vertex_array.dirty)
+		return;
+
+	_vertex_array.dirty = 0;
+	_vertex_array.generation = _vertex_buffer_generation;
+	_vertex_array.maxVertex = std::numeric_limits<int64_t>::max();
+	_vertex_array.limitAttrib = VERTEX_ATTRIBS;
+
+	for (uint i = 0; i < VERTEX_ATTRIBS; ++i)
+	{
+		VertexAttrib_t& attrib = _vertex_array.attribs[i];
+
+		// client memory can't be checked
+		if (!attrib.enabled || !attrib.buffer)
+			continue;
+
+		const int64_t bytes = attrib.size * (attrib.type == GL_FIXED ?
+			4 : GetTypeInfo(attrib.type).bytes);
+		const int64_t stride = attrib.stride ? attrib.stride : bytes;
+		const int64_t offset = reinterpret_cast<int64_t>(attrib.pointer);
+		const int64_t size = getBufferSize(attrib.buffer);
+
+		// the last vertex must be read completely
+		attrib.maxVertex = (stride <= 0 || size < offset + bytes) ? -1 :
+			(size - offset - bytes) / stride;
+
+		if (attrib.maxVertex < _vertex_array.maxVertex)
+		{
+			_vertex_array.maxVertex = attrib.maxVertex;
+			_vertex_array.limitAttrib = i;
+		}
+	}
+}
+
+void gl::setVertexBufferDirty(uint buffer)
+{
+	_vertex_buffer_generations[buffer] = ++_vertex_buffer_generation;
+
+	for (uint i = 0; i < VERTEX_ATTRIBS; ++i)
+	{
+		if (_vertex_array.attribs[i].buffer == buffer)
+		{
+			_vertex_array.dirty = 1;
+			return;
+		}
+	}
+}
+
+void gl::bindVertexArray(uint array)
+{
+	if (array == _bound_vertex_array)
+		return;
+
+	// the bound state goes back to its slot, the other one comes in
+	std::swap(_vertex_array, _vertex_arrays[_bound_vertex_array]);
+	std::swap(_vertex_array, _vertex_arrays[array]);
+	_bound_vertex_array = array;
+
+	// its buffers resized while the array was not bound
+	for (uint i = 0; i < VERTEX_ATTRIBS && !_vertex_array.dirty; ++i)
+	{
+		const VertexAttrib_t& attrib = _vertex_array.attribs[i];
+
+		if (!attrib.enabled || !attrib.buffer)
+			continue;
+
+		Map<uint,uint>::Iterator iter =
+			_vertex_buffer_generations.find(attrib.buffer);
+
+		if (iter != _vertex_buffer_generations.end() &&
+			iter->second > _vertex_array.generation)
+			_vertex_array.dirty = 1;
+	}
+
+	_bound_buffer[ELEMENT_ARRAY_BUFFER] = _vertex_array.elementBuffer ?
+		getBuffer(ELEMENT_ARRAY_BUFFER, _vertex_array.elementBuffer) :
+		nullptr;
 }
 
-uint gl::getBoundBufferId(uint target)
+GLint gl::getMaxVertexAttribs()
 {
-	if (target >= BUFFER_SIZE) ne_assert(!"local target only");
-	if (!_bound_buffer[target]) return INVALID_BOUND;
-	return _bound_buffer[target]->id;
+	if (!_max_vertex_attribs)
+	{
+		GLint value = 0;
+		gl_GetIntegerv(GL_MAX_VERTEX_ATTRIBS, &value);
+
+		// minimum required by the specification
+		_max_vertex_attribs = value > 0 ? value : 8;
+	}
+	return _max_vertex_attribs;
 }
 
 // ---------------------------------------------------------------------
@@ -675,14 +5825,19 @@ void gl::ActiveTexture  (GLenum texture, const char* file, int line)
 {
 	TRACE_FUNCTION("glActiveTexture(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_ActiveTexture( texture );
+	TRACE_CALL(gl_ActiveTexture)( texture );
 
 	const char* result = get_last_error();
 
 	String sTexture;
 
 	if (texture >= GL_TEXTURE0 && texture <= GL_TEXTURE31)
+	{
 		sTexture = format("GL_TEXTURE%d", (texture - GL_TEXTURE0));
+
+		if (!result)
+			_active_texture = texture - GL_TEXTURE0;
+	}
 	else
 		breakOnError(!"invalid texture unit");
 
@@ -701,10 +5856,17 @@ void gl::AttachShader(GLuint program, GLuint shader, const char* file, int line)
 	bool p_is_valid = is_registered_program(program);
 	bool s_is_valid = is_registered_shader(shader);
 
-	gl_AttachShader(program,shader);
+	TRACE_CALL(gl_AttachShader)(program,shader);
 
 	const char* result = get_last_error();
 
+	if (!result)
+	{
+		Vector<uint>& shaders = _program_inputs[program].shaders;
+		if (std::find(shaders.begin(), shaders.end(), shader) == shaders.end())
+			shaders.push_back(shader);
+	}
+
 	// add function to call list
 	addCall(result,
 		format("glAttachShader( program(valid:%s, id:%d), shader(valid:%s, id:%d) )",
@@ -727,10 +5889,15 @@ void gl::BindAttribLocation  (GLuint program, GLuint index, const GLchar *name,
 
 	breakOnError( is_valid, "Invalid program" );
 
-	gl_BindAttribLocation(program,index,name);
+	TRACE_CALL(gl_BindAttribLocation)(program,index,name);
 
 	const char* result = get_last_error();
 
+	if (!result && name)
+	{
+		_program_inputs[program].attribs[name] = index;
+	}
+
 	addCall(result,format("glBindAttribLocation(%d)",program),file,line);
 
 	breakOnError( !result, result );
@@ -747,7 +5914,7 @@ void gl::BindBuffer  (GLenum target, GLuint buffer, const char* file, int line)
 
 	const GLuint b = buffer;
 
-	gl_BindBuffer( target, buffer );
+	TRACE_CALL(gl_BindBuffer)( target, buffer );
 
 	const bool is_valid = (0 == buffer) ?
 							true : is_registered_buffer(buffer);
@@ -756,10 +5923,17 @@ void gl::BindBuffer  (GLenum target, GLuint buffer, const char* file, int line)
 	const uint ltarget = target == GL_ARRAY_BUFFER ?
 						ARRAY_BUFFER : ELEMENT_ARRAY_BUFFER;
 
-	setBoundBuffer( ltarget, buffer );
-
 	const char* result = get_last_error();
 
+	if (!result)
+	{
+		setBoundBuffer( ltarget, buffer );
+
+		// the element array buffer binding belongs to the vertex array
+		if (ltarget == ELEMENT_ARRAY_BUFFER)
+			_vertex_array.elementBuffer = buffer;
+	}
+
 	// add function to call list
 	addCall(result,
 		format("glBindBuffer( target:%s, buffer:%d )",
@@ -776,10 +5950,20 @@ PFNGLBINDFRAMEBUFFERPROC gl::gl_BindFramebuffer INIT_POINTER;
 void gl::BindFramebuffer  (GLenum target, GLuint framebuffer, const char* file, int line)
 {
 	TRACE_FUNCTION("glBindFramebuffer(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BindFramebuffer(
+	TRACE_CALL(gl_BindFramebuffer)(
 		target,
 		framebuffer);
 	const char* result = get_last_error();
+
+	/** a name not generated by glGenFramebuffers is valid too */
+	if (!result)
+	{
+		if (framebuffer != _bound_framebuffer)
+			endPass();
+
+		_bound_framebuffer = framebuffer;
+		register_framebuffer(framebuffer);
+	}
 	breakOnError( !result, result );
 }
 
@@ -787,10 +5971,13 @@ PFNGLBINDRENDERBUFFERPROC gl::gl_BindRenderbuffer INIT_POINTER;
 void gl::BindRenderbuffer  (GLenum target, GLuint renderbuffer, const char* file, int line)
 {
 	TRACE_FUNCTION("glBindRenderbuffer(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BindRenderbuffer(
+	TRACE_CALL(gl_BindRenderbuffer)(
 		target,
 		renderbuffer);
 	const char* result = get_last_error();
+
+	if (!result)
+		_bound_renderbuffer = renderbuffer;
 	breakOnError( !result, result );
 }
 
@@ -804,10 +5991,22 @@ void gl::BindTexture  (GLenum target, GLuint texture, const char* file, int line
 
 	bool is_valid = texture == 0 ? true : is_registered_texture( texture );
                     
-	gl_BindTexture( target, texture );
+	TRACE_CALL(gl_BindTexture)( target, texture );
 	
 	const char* result = get_last_error();
 
+	const uint ltarget = getTextureTarget(target);
+
+	if (!result && ltarget < TEXTURE_TARGET_SIZE)
+	{
+		_bound_texture[_active_texture][ltarget] = texture;
+		_texture_set_dirty = true;
+
+		Texture_t* o = getTexture(texture);
+		if (o)
+			o->target = ltarget;
+	}
+
 	// add function to call list
 	addCall(result,
 		format("glBindTexture( target:%s, texture:%d )",
@@ -824,7 +6023,7 @@ PFNGLBLENDCOLORPROC gl::gl_BlendColor INIT_POINTER;
 void gl::BlendColor  (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha, const char* file, int line)
 {
 	TRACE_FUNCTION("glBlendColor(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BlendColor(
+	TRACE_CALL(gl_BlendColor)(
 		red,
 		green,
 		blue,
@@ -837,9 +6036,16 @@ PFNGLBLENDEQUATIONPROC gl::gl_BlendEquation INIT_POINTER;
 void gl::BlendEquation  (GLenum mode, const char* file, int line)
 {
 	TRACE_FUNCTION("glBlendEquation(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BlendEquation(
+	TRACE_CALL(gl_BlendEquation)(
 		mode);
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		_render_state.blendModeRGB = mode;
+		_render_state.blendModeAlpha = mode;
+		_render_state_dirty = true;
+	}
 	breakOnError( !result, result );
 }
 
@@ -847,10 +6053,17 @@ PFNGLBLENDEQUATIONSEPARATEPROC gl::gl_BlendEquationSeparate INIT_POINTER;
 void gl::BlendEquationSeparate  (GLenum modeRGB, GLenum modeAlpha, const char* file, int line)
 {
 	TRACE_FUNCTION("glBlendEquationSeparate(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BlendEquationSeparate(
+	TRACE_CALL(gl_BlendEquationSeparate)(
 		modeRGB,
 		modeAlpha);
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		_render_state.blendModeRGB = modeRGB;
+		_render_state.blendModeAlpha = modeAlpha;
+		_render_state_dirty = true;
+	}
 	breakOnError( !result, result );
 }
 
@@ -858,10 +6071,19 @@ PFNGLBLENDFUNCPROC gl::gl_BlendFunc INIT_POINTER;
 void gl::BlendFunc  (GLenum sfactor, GLenum dfactor, const char* file, int line)
 {
 	TRACE_FUNCTION("glBlendFunc(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BlendFunc(
+	TRACE_CALL(gl_BlendFunc)(
 		sfactor,
 		dfactor);
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		_render_state.blendSrcRGB = sfactor;
+		_render_state.blendDstRGB = dfactor;
+		_render_state.blendSrcAlpha = sfactor;
+		_render_state.blendDstAlpha = dfactor;
+		_render_state_dirty = true;
+	}
 	breakOnError( !result, result );
 }
 
@@ -869,12 +6091,21 @@ PFNGLBLENDFUNCSEPARATEPROC gl::gl_BlendFuncSeparate INIT_POINTER;
 void gl::BlendFuncSeparate  (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha, const char* file, int line)
 {
 	TRACE_FUNCTION("glBlendFuncSeparate(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BlendFuncSeparate(
+	TRACE_CALL(gl_BlendFuncSeparate)(
 		sfactorRGB,
 		dfactorRGB,
 		sfactorAlpha,
 		dfactorAlpha);
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		_render_state.blendSrcRGB = sfactorRGB;
+		_render_state.blendDstRGB = dfactorRGB;
+		_render_state.blendSrcAlpha = sfactorAlpha;
+		_render_state.blendDstAlpha = dfactorAlpha;
+		_render_state_dirty = true;
+	}
 	breakOnError( !result, result );
 }
 
@@ -901,13 +6132,25 @@ void gl::BufferData  (GLenum target, GLsizeiptr size, const void *data, GLenum u
 	breakOnError( bound_id != INVALID_BOUND, "no buffer bound" );
 
 	/** set to opengl */
-	gl_BufferData(target,size,data,usage);
-
-	// set locally
-	setBoundBufferData(ltarget, size, data);
+	TRACE_CALL(gl_BufferData)(target,size,data,usage);
 
 	const char* result = get_last_error();
 
+	if (!result)
+	{
+		if (data)
+			addUpload(UPLOAD_BUFFER_DATA, size, file, line);
+
+		shadowBufferData(bound_id, size, data);
+		checkRedundantUpload(UPLOAD_BUFFER_DATA,
+			UploadRange_t(SHADOW_BUFFER, bound_id, 0, 0, 0, size, 1),
+			data, size, file, line);
+		addBufferData(bound_id, usage, file, line);
+
+		// set locally
+		setBoundBufferData(ltarget, size, data);
+	}
+
 	// add function to call list
 	addCall(result,
 		format(
@@ -932,13 +6175,30 @@ PFNGLBUFFERSUBDATAPROC gl::gl_BufferSubData INIT_POINTER;
 void gl::BufferSubData  (GLenum target, GLintptr offset, GLsizeiptr size, const void *data, const char* file, int line)
 {
 	TRACE_FUNCTION("glBufferSubData(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BufferSubData(
+	TRACE_CALL(gl_BufferSubData)(
 		target,
 		offset,
 		size,
 		data);
-	
+
 	const char* result = get_last_error();
+
+	if (!result && data)
+		addUpload(UPLOAD_BUFFER_SUB_DATA, size, file, line);
+
+	if (!result && (target == GL_ARRAY_BUFFER ||
+		target == GL_ELEMENT_ARRAY_BUFFER))
+	{
+		const uint id = getBoundBufferId(target == GL_ARRAY_BUFFER ?
+			ARRAY_BUFFER : ELEMENT_ARRAY_BUFFER);
+
+		shadowBufferSubData(id, offset, size, data);
+		addBufferSubData(id, file, line);
+		checkRedundantUpload(UPLOAD_BUFFER_SUB_DATA,
+			UploadRange_t(SHADOW_BUFFER, id, 0, offset, 0, size, 1),
+			data, size, file, line);
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -946,7 +6206,8 @@ PFNGLCHECKFRAMEBUFFERSTATUSPROC gl::gl_CheckFramebufferStatus INIT_POINTER;
 GLenum gl::CheckFramebufferStatus  (GLenum target, const char* file, int line)
 {
 	TRACE_FUNCTION("glCheckFramebufferStatus(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_CheckFramebufferStatus(
+
+	return TRACE_CALL(gl_CheckFramebufferStatus)(
 		target);
 }
 
@@ -955,10 +6216,16 @@ void gl::Clear  (GLbitfield mask, const char* file, int line)
 {
 	TRACE_FUNCTION("glClear(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_Clear(mask);
+	TRACE_CALL(gl_Clear)(mask);
 	
 	const char* result = get_last_error();
 
+	if (!result)
+	{
+		addPassClear(mask);
+		addRenderedRect(true);
+	}
+
 	String sMask;
 
 	if ( mask & GL_COLOR_BUFFER_BIT )
@@ -993,7 +6260,7 @@ void gl::ClearColor  (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha, c
 {
 	TRACE_FUNCTION("glClearColor(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_ClearColor( red, green, blue, alpha);
+	TRACE_CALL(gl_ClearColor)( red, green, blue, alpha);
 	
 	const char* result = get_last_error();
 
@@ -1011,7 +6278,7 @@ void gl::ClearDepthf  (GLfloat d, const char* file, int line)
 {
 	TRACE_FUNCTION("glClearDepthf(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_ClearDepthf(d);
+	TRACE_CALL(gl_ClearDepthf)(d);
 	
 	const char* result = get_last_error();
 
@@ -1029,7 +6296,7 @@ void gl::ClearStencil  (GLint s, const char* file, int line)
 {
 	TRACE_FUNCTION("glClearStencil(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_ClearStencil( s );
+	TRACE_CALL(gl_ClearStencil)( s );
 	
 	const char* result = get_last_error();
 
@@ -1047,10 +6314,17 @@ void gl::ColorMask  (GLboolean red, GLboolean green, GLboolean blue, GLboolean a
 {
 	TRACE_FUNCTION("glColorMask(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_ColorMask(red,green,blue,alpha);
+	TRACE_CALL(gl_ColorMask)(red,green,blue,alpha);
 	
 	const char* result = get_last_error();
 
+	if (!result)
+	{
+		_render_state.colorMask = (red ? 1 : 0) | (green ? 2 : 0) |
+			(blue ? 4 : 0) | (alpha ? 8 : 0);
+		_render_state_dirty = true;
+	}
+
 	// add function to call list
 	addCall(result,
 		format("glColorMask( %d, %d, %d, %d )",red,green,blue,alpha),
@@ -1065,14 +6339,52 @@ void gl::CompileShader  (GLuint shader, const char* file, int line)
 {
 	TRACE_FUNCTION("glCompileShader(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_CompileShader( shader );
+	const uint64_t start = Core::now();
+
+	TRACE_CALL(gl_CompileShader)( shader );
+
+	const uint64_t time = Core::now() - start;
+	addShaderTime(time);
+
+	const char* result = get_last_error();
+
+	// add function to call list
+	addCall(result, format("glCompileShader( shader:%d )", shader),
+		file, line);
+
+	/** same source compiled again */
+	Map<uint,uint64_t>::Iterator hash = _shader_hashes.find(shader);
+
+	if (!result && hash != _shader_hashes.end())
+	{
+		ShaderSource_t& source = _shader_sources[hash->second];
+
+		if (!source.compiles)
+		{
+			source.hash = hash->second;
+			source.site = getCallSite(file, line);
+		}
+		else if (source.compiles == 1)
+		{
+			const String message = format(
+				"%s : shader %d has the same source as the one compiled at %s",
+				getCallSiteName(getCallSite(file, line)).c_str(), shader,
+				getCallSiteName(source.site).c_str());
+			breakOnWarning(false, message);
+		}
+
+		++source.compiles;
+		source.time += time;
+	}
+
+	breakOnError( !result, result );
 }
 
 PFNGLCOMPRESSEDTEXIMAGE2DPROC gl::gl_CompressedTexImage2D INIT_POINTER;
 void gl::CompressedTexImage2D  (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data, const char* file, int line)
 {
 	TRACE_FUNCTION("glCompressedTexImage2D(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CompressedTexImage2D(
+	TRACE_CALL(gl_CompressedTexImage2D)(
 		target,
 		level,
 		internalformat,
@@ -1081,13 +6393,33 @@ void gl::CompressedTexImage2D  (GLenum target, GLint level, GLenum internalforma
 		border,
 		imageSize,
 		data);
+
+	const char* result = get_last_error();
+
+	if (!result)
+	{
+		if (data)
+			addUpload(UPLOAD_COMPRESSED_TEX_IMAGE_2D, imageSize, file, line);
+
+		setTextureLevel(target, level, internalformat, GL_NONE, width,
+			height, 1, imageSize > 0 ? imageSize :
+			getCompressedSize(internalformat, width, height, 1));
+
+		if (const Texture_t* texture = getBoundTexture(target))
+			checkRedundantUpload(UPLOAD_COMPRESSED_TEX_IMAGE_2D,
+				UploadRange_t(SHADOW_TEXTURE, texture->id,
+					(getTextureFace(target) << 8) | level, 0, 0, width, height),
+				data, imageSize, file, line);
+	}
+
+	breakOnError(!result, result);
 }
 
 PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC gl::gl_CompressedTexSubImage2D INIT_POINTER;
 void gl::CompressedTexSubImage2D  (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data, const char* file, int line)
 {
 	TRACE_FUNCTION("glCompressedTexSubImage2D(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CompressedTexSubImage2D(
+	TRACE_CALL(gl_CompressedTexSubImage2D)(
 		target,
 		level,
 		xoffset,
@@ -1097,13 +6429,20 @@ void gl::CompressedTexSubImage2D  (GLenum target, GLint level, GLint xoffset, GL
 		format,
 		imageSize,
 		data);
+
+	const char* result = get_last_error();
+
+	if (!result && data)
+		addUpload(UPLOAD_COMPRESSED_TEX_SUB_IMAGE_2D, imageSize, file, line);
+
+	breakOnError(!result, result);
 }
 
 PFNGLCOPYTEXIMAGE2DPROC gl::gl_CopyTexImage2D INIT_POINTER;
 void gl::CopyTexImage2D  (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border, const char* file, int line)
 {
 	TRACE_FUNCTION("glCopyTexImage2D(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CopyTexImage2D(
+	TRACE_CALL(gl_CopyTexImage2D)(
 		target,
 		level,
 		internalformat,
@@ -1112,13 +6451,29 @@ void gl::CopyTexImage2D  (GLenum target, GLint level, GLenum internalformat, GLi
 		width,
 		height,
 		border);
+
+	const char* result = get_last_error();
+
+	if (!result)
+	{
+		// the framebuffer is read as GL_UNSIGNED_BYTE per component
+		setTextureLevel(target, level, internalformat, GL_UNSIGNED_BYTE,
+			width, height, 1,
+			getLevelSize(internalformat, GL_UNSIGNED_BYTE, width, height, 1));
+
+		// content written by the gpu : unknown
+		if (const Texture_t* texture = getBoundTexture(target))
+			invalidateUploadHashes(SHADOW_TEXTURE, texture->id);
+	}
+
+	breakOnError(!result, result);
 }
 
 PFNGLCOPYTEXSUBIMAGE2DPROC gl::gl_CopyTexSubImage2D INIT_POINTER;
 void gl::CopyTexSubImage2D  (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height, const char* file, int line)
 {
 	TRACE_FUNCTION("glCopyTexSubImage2D(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CopyTexSubImage2D(
+	TRACE_CALL(gl_CopyTexSubImage2D)(
 		target,
 		level,
 		xoffset,
@@ -1134,7 +6489,7 @@ GLuint gl::CreateProgram  (const char* file, int line)
 {
 	TRACE_FUNCTION("glCreateProgram(...) called from " << get_path(file) << '(' << line << ')');
 
-	GLuint ret = gl_CreateProgram();
+	GLuint ret = TRACE_CALL(gl_CreateProgram)();
 
 	const char* result = get_last_error();
 
@@ -1144,6 +6499,9 @@ GLuint gl::CreateProgram  (const char* file, int line)
 	/** register program */
 	bool valid = register_program(ret);
 
+	if (valid)
+		addObject(OBJECT_PROGRAM, ret, file, line);
+
 	breakOnError(valid, "Invalid program / register" );
 
 	breakOnError( !result, result );
@@ -1156,7 +6514,7 @@ GLuint gl::CreateShader  (GLenum type, const char* file, int line)
 {
 	TRACE_FUNCTION("glCreateShader(...) called from " << get_path(file) << '(' << line << ')');
 	
-	GLuint ret = gl_CreateShader(type);
+	GLuint ret = TRACE_CALL(gl_CreateShader)(type);
 
 	const char* result = get_last_error();
 
@@ -1180,6 +6538,9 @@ GLuint gl::CreateShader  (GLenum type, const char* file, int line)
 	/** register shaders */
 	bool valid = register_shader(ret);
 
+	if (valid)
+		addObject(OBJECT_SHADER, ret, file, line);
+
 	breakOnError(valid, "Invalid shader / register");
 
 	breakOnError(!result, result);
@@ -1191,7 +6552,16 @@ PFNGLCULLFACEPROC gl::gl_CullFace INIT_POINTER;
 void gl::CullFace  (GLenum mode, const char* file, int line)
 {
 	TRACE_FUNCTION("glCullFace(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CullFace(mode);
+	TRACE_CALL(gl_CullFace)(mode);
+
+	const char* result = get_last_error();
+
+	if (!result)
+	{
+		_render_state.cullFace = mode;
+		_render_state_dirty = true;
+	}
+	breakOnError(!result, result);
 }
 
 PFNGLDELETEBUFFERSPROC gl::gl_DeleteBuffers INIT_POINTER;
@@ -1199,7 +6569,7 @@ void gl::DeleteBuffers  (GLsizei n, const GLuint *buffers, const char* file, int
 {
 	TRACE_FUNCTION("glDeleteBuffers(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_DeleteBuffers(n,buffers);
+	TRACE_CALL(gl_DeleteBuffers)(n,buffers);
 
 	bool is_valid = n == 1 ? is_registered_buffer(*buffers) : true;
 
@@ -1208,12 +6578,17 @@ void gl::DeleteBuffers  (GLsizei n, const GLuint *buffers, const char* file, int
 	// add function to call list
 	addCall(result, format("glDeleteBuffers(%d)", n), file, line);
 
+	// unregister all of them (memory accounting)
 	bool found = false;
 	for (int x = 0; x < n; ++x)
 	{
-		found = unregister_buffer(buffers[x]);
-		if (found)
-			break;
+		if (unregister_buffer(buffers[x]))
+			found = true;
+
+		removeObject(OBJECT_BUFFER, buffers[x], file, line);
+
+		// deleting a mapped buffer unmaps it
+		_mappings.erase(buffers[x]);
 	}
 
 	breakOnError( found, "buffers not found/unregistered" );
@@ -1224,7 +6599,19 @@ PFNGLDELETEFRAMEBUFFERSPROC gl::gl_DeleteFramebuffers INIT_POINTER;
 void gl::DeleteFramebuffers  (GLsizei n, const GLuint *framebuffers, const char* file, int line)
 {
 	TRACE_FUNCTION("glDeleteFramebuffers(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DeleteFramebuffers(n,framebuffers);
+	TRACE_CALL(gl_DeleteFramebuffers)(n,framebuffers);
+
+	for (int x = 0; x < n; ++x)
+	{
+		unregister_framebuffer(framebuffers[x]);
+		removeObject(OBJECT_FRAMEBUFFER, framebuffers[x], file, line);
+
+		if (framebuffers[x] && framebuffers[x] == _bound_framebuffer)
+		{
+			endPass();
+			_bound_framebuffer = 0;
+		}
+	}
 }
 
 PFNGLDELETEPROGRAMPROC gl::gl_DeleteProgram INIT_POINTER;
@@ -1233,7 +6620,7 @@ void gl::DeleteProgram  (GLuint program, const char* file, int line)
 	TRACE_FUNCTION("glDeleteProgram(...) called from " << get_path(file) << '(' << line << ')');
 
 	const GLuint p = program;
-	gl_DeleteProgram( program );
+	TRACE_CALL(gl_DeleteProgram)( program );
 
 	bool is_valid = is_registered_program(p);
 
@@ -1245,6 +6632,10 @@ void gl::DeleteProgram  (GLuint program, const char* file, int line)
 	/** unregister program */
 	
 	bool found = unregister_program(p);
+	removeObject(OBJECT_PROGRAM, p, file, line);
+	releaseUniforms(p);
+	_program_preps.erase(p);
+	_program_inputs.erase(p);
 
 	breakOnError(found);
 	breakOnError(is_valid);
@@ -1256,7 +6647,14 @@ void gl::DeleteRenderbuffers  (GLsizei n, const GLuint *renderbuffers, const cha
 {
 	TRACE_FUNCTION("glDeleteRenderbuffers(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_DeleteRenderbuffers(n,renderbuffers);
+	TRACE_CALL(gl_DeleteRenderbuffers)(n,renderbuffers);
+
+	for (int x = 0; x < n; ++x)
+	{
+		unregister_renderbuffer(renderbuffers[x]);
+		removeObject(OBJECT_RENDERBUFFER, renderbuffers[x], file, line);
+		detachObject(GL_RENDERBUFFER, renderbuffers[x]);
+	}
 }
 
 PFNGLDELETESHADERPROC gl::gl_DeleteShader INIT_POINTER;
@@ -1265,7 +6663,7 @@ void gl::DeleteShader  (GLuint shader, const char* file, int line)
 	TRACE_FUNCTION("glDeleteShader(...) called from " << get_path(file) << '(' << line << ')');
 
 	const GLuint s = shader;
-	gl_DeleteShader(shader);
+	TRACE_CALL(gl_DeleteShader)(shader);
 
 	const char* result = get_last_error();
 
@@ -1274,6 +6672,8 @@ void gl::DeleteShader  (GLuint shader, const char* file, int line)
 
 	/** unregister shader */
 	bool valid = unregister_shader(s);
+	removeObject(OBJECT_SHADER, s, file, line);
+	_shader_hashes.erase(s);
 
 	breakOnError(valid, "Invalid shader / unregister");
 
@@ -1290,7 +6690,7 @@ void gl::DeleteTextures  (GLsizei n, const GLuint *textures, const char* file, i
 	breakOnError( n >= 1, "n : Invalid value (n<=0)" );
 
 	/** send it to opengl */
-	gl_DeleteTextures(n,textures);
+	TRACE_CALL(gl_DeleteTextures)(n,textures);
 
 	const char* result = get_last_error();
 
@@ -1307,12 +6707,15 @@ void gl::DeleteTextures  (GLsizei n, const GLuint *textures, const char* file, i
 		file, line
 	);
 
+	// unregister all of them (memory accounting)
 	bool found = false;
 	for (x = 0; x < n; ++x)
 	{
-		found = unregister_texture(textures[x]);
-		if (found)
-			break;
+		if (unregister_texture(textures[x]))
+			found = true;
+
+		removeObject(OBJECT_TEXTURE, textures[x], file, line);
+		detachObject(GL_TEXTURE, textures[x]);
 	}
 
 	breakOnError(found, "unregistered texture / invalid");
@@ -1350,11 +6753,17 @@ void gl::DepthFunc  (GLenum func, const char* file, int line)
 		"or GL_ALWAYS"
 	);
 
-	gl_DepthFunc(func);
+	TRACE_CALL(gl_DepthFunc)(func);
 	
 	/** check for opengl error */
 	const char* result = get_last_error();
 
+	if (!result)
+	{
+		_render_state.depthFunc = func;
+		_render_state_dirty = true;
+	}
+
 	// add function to call list
 	addCall(result,
 		format( "glDepthFunc( func:%s )", 
@@ -1375,11 +6784,17 @@ void gl::DepthMask  (GLboolean flag, const char* file, int line)
 		"flag : Invalid flag passed, must be GL_TRUE or GL_FALSE."
 	);
 
-	gl_DepthMask(flag);
+	TRACE_CALL(gl_DepthMask)(flag);
 
 	/** check for opengl error */
 	const char* result = get_last_error();
 
+	if (!result)
+	{
+		_render_state.depthMask = flag;
+		_render_state_dirty = true;
+	}
+
 	// add function to call list
 	addCall(result,
 		format("glDepthMask( flag:%s )",
@@ -1395,7 +6810,7 @@ void gl::DepthRangef  (GLfloat n, GLfloat f, const char* file, int line)
 {
 	TRACE_FUNCTION("glDepthRangef(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_DepthRangef(n,f);
+	TRACE_CALL(gl_DepthRangef)(n,f);
 
 	/** check for opengl error */
 	const char* result = get_last_error();
@@ -1421,11 +6836,18 @@ void gl::DetachShader  (GLuint program, GLuint shader, const char* file, int lin
 	breakOnError( s_is_valid, "Invalid shader" );
 
 	/** send it to opengl */
-	gl_DetachShader(program,shader);
+	TRACE_CALL(gl_DetachShader)(program,shader);
 
 	/** check for opengl error */
 	const char* result = get_last_error();
 
+	if (!result)
+	{
+		Vector<uint>& shaders = _program_inputs[program].shaders;
+		shaders.erase(std::remove(shaders.begin(), shaders.end(), shader),
+			shaders.end());
+	}
+
 	// add function to call list
 	addCall(result,
 		format("glDetachShader( program:%d shader:%d )",program,shader),
@@ -1449,8 +6871,12 @@ void gl::Disable  (GLenum cap, const char* file, int line)
 	/** local disable */
 	disableStates( cap );
 
+	/** no more error messages : back to glGetError */
+	if (cap == GL_DEBUG_OUTPUT_KHR || cap == GL_DEBUG_OUTPUT_SYNCHRONOUS_KHR)
+		_debug_errors = false;
+
 	/** send it to opengl */
-	gl_Disable(cap);
+	TRACE_CALL(gl_Disable)(cap);
 
 	/** check for opengl error */
 	const char* result = get_last_error();
@@ -1471,11 +6897,19 @@ void gl::DisableVertexAttribArray  (GLuint index, const char* file, int line)
 	TRACE_FUNCTION("glDisableVertexAttribArray(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_DisableVertexAttribArray(index);
+	TRACE_CALL(gl_DisableVertexAttribArray)(index);
 
 	/** check for opengl error */
 	const char* result = get_last_error();
 
+	if (!result && index < VERTEX_ATTRIBS &&
+		_vertex_array.attribs[index].enabled)
+	{
+		_vertex_array.attribs[index].enabled = 0;
+		_vertex_array.dirty = 1;
+		_vertex_array.layoutDirty = 1;
+	}
+
 	// add function to call list
 	addCall(result,
 		format("glDisableVertexAttribArray( index:%d )",index),
@@ -1516,12 +6950,47 @@ void gl::DrawArrays  (GLenum mode, GLint first, GLsizei count, const char* file,
 	);
 
 	breakOnError( count >= 1, "count <= 0" );
+	breakOnError( first >= 0, "first : Invalid value (< 0)" );
+
+	/** the bound framebuffer must be complete (cached) */
+	const char* incomplete = checkFramebuffer();
+	breakOnError( !incomplete, incomplete );
+
+	const char* mapped = checkMappedBuffers(false);
+	breakOnError( !mapped, mapped );
+
+	/** check the vertices against the vertex buffers */
+	if (first >= 0 && count >= 1)
+	{
+		checkVertexAttribs(static_cast<uint>(first) + count - 1);
+
+		/** client vertex arrays are copied by the driver on each draw */
+		addClientArray(UPLOAD_CLIENT_VERTICES, getClientArraySize(count),
+			file, line);
+	}
+
+	/** the driver may finish compiling/linking on the first draw */
+	ProgramPrep_t* prep = getFirstUseProgram();
+	const uint64_t start = prep ? Core::now() : 0;
 
-	gl_DrawArrays(mode,first,count);
+	GpuQuery_t gpu = beginGpuDraw("glDrawArrays", file, line);
+	TRACE_CALL(gl_DrawArrays)(mode,first,count);
+	endGpuQuery(gpu);
+
+	if (prep)
+		setFirstUse(prep, Core::now() - start);
+	setBuffersDrawn(false);
 	
 	/** check for opengl error */
 	const char* result = get_last_error();
 
+	if (!result)
+	{
+		addDraw(mode, 0, first, count, file, line);
+		addPassDraw();
+		addRenderedRect(false);
+	}
+
 	// add function to call list
 	addCall(result,
 		format("glDrawArrays( mode:%s first:%d count:%d )",
@@ -1559,6 +7028,17 @@ void gl::DrawElements  (GLenum mode, GLsizei count, GLenum type, const void *ind
 
 	breakOnError( (count >= 1), "count: <= 0" );
 
+	/** the bound framebuffer must be complete (cached) */
+	const char* incomplete = checkFramebuffer();
+	breakOnError( !incomplete, incomplete );
+
+	const char* mapped = checkMappedBuffers(true);
+	breakOnError( !mapped, mapped );
+
+	/** biggest index of the draw (if known) */
+	uint maxIndex = 0;
+	bool has_max_index = false;
+
 	/** check for element array buffer */
 	if (!indices && !elementArrayBuffer())
 	{
@@ -1616,16 +7096,68 @@ void gl::DrawElements  (GLenum mode, GLsizei count, GLenum type, const void *ind
 			{
 				breakOnError(0, "count : Invalid value");
 			}
+			else
+			{
+				/** verify indices data (shadow copy) */
+				has_max_index = getMaxIndex(elementArrayBuffer()->id, type,
+					offset, count, maxIndex);
+
+				if (has_max_index)
+					checkVertexAttribs(maxIndex);
+			}
+		}
+	}
+	else
+	{
+		/** verify indices data (client memory) */
+		const gl::Type &typeInfo = gl::GetTypeInfo(type);
+
+		if (typeInfo.bytes && count > 0)
+		{
+			maxIndex = Simd::maxIndex(indices, count, typeInfo.bytes);
+			has_max_index = true;
+
+			checkVertexAttribs(maxIndex);
+
+			/** client indices are copied by the driver on each draw */
+			addClientArray(UPLOAD_CLIENT_INDICES,
+				static_cast<uint64_t>(count) * typeInfo.bytes, file, line);
 		}
 	}
-	// todo verify indices data
+
+	/** client vertex arrays : the driver copies all the vertices
+	 * referenced (count if the indices are unknown) */
+	if (count > 0)
+	{
+		addClientArray(UPLOAD_CLIENT_VERTICES,
+			getClientArraySize(has_max_index ? maxIndex + 1 : count),
+			file, line);
+	}
 
 	/** send it to opengl */
-	gl_DrawElements( mode, count, type, indices );
+	/** the driver may finish compiling/linking on the first draw */
+	ProgramPrep_t* prep = getFirstUseProgram();
+	const uint64_t start = prep ? Core::now() : 0;
+
+	GpuQuery_t gpu = beginGpuDraw("glDrawElements", file, line);
+	TRACE_CALL(gl_DrawElements)( mode, count, type, indices );
+	endGpuQuery(gpu);
+
+	if (prep)
+		setFirstUse(prep, Core::now() - start);
+	setBuffersDrawn(true);
 
 	/** check for opengl error */
 	const char* result = get_last_error();
 
+	if (!result)
+	{
+		addDraw(mode, type, reinterpret_cast<uint64_t>(indices), count,
+			file, line);
+		addPassDraw();
+		addRenderedRect(false);
+	}
+
 	/** formated output */
 	const char* sMode;
 
@@ -1666,7 +7198,7 @@ void gl::Enable  (GLenum cap, const char* file, int line)
 	breakOnWarning( !is_active, "capability already enabled" );
 
 	/** opengl state */
-	gl_Enable( cap );
+	TRACE_CALL(gl_Enable)( cap );
 
 	/** local enable */
 	enableStates( cap );
@@ -1691,13 +7223,21 @@ void gl::EnableVertexAttribArray  (GLuint index, const char* file, int line)
 	TRACE_FUNCTION("glEnableVertexAttribArray(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	breakOnError( index < GL_MAX_VERTEX_ATTRIBS ,
-		"Invalid vertex attrib" );
+	breakOnError( static_cast<GLint>(index) < getMaxVertexAttribs(),
+		"index : Invalid value (>= GL_MAX_VERTEX_ATTRIBS)" );
 
-	gl_EnableVertexAttribArray( index );
+	TRACE_CALL(gl_EnableVertexAttribArray)( index );
 
 	const char* result = get_last_error();
 
+	if (!result && index < VERTEX_ATTRIBS &&
+		!_vertex_array.attribs[index].enabled)
+	{
+		_vertex_array.attribs[index].enabled = 1;
+		_vertex_array.dirty = 1;
+		_vertex_array.layoutDirty = 1;
+	}
+
 	// add function to call list
 	addCall(result,
 		format("glEnableVertexAttribArray( index:%d )",index),
@@ -1713,7 +7253,7 @@ void gl::Finish  (const char* file, int line)
 	TRACE_FUNCTION("glFinish(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Finish();
+	TRACE_CALL(gl_Finish)();
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -1725,7 +7265,7 @@ void gl::Flush  (const char* file, int line)
 	TRACE_FUNCTION("glFlush(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Flush();
+	TRACE_CALL(gl_Flush)();
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -1737,9 +7277,12 @@ void gl::FramebufferRenderbuffer  (GLenum target, GLenum attachment, GLenum rend
 	TRACE_FUNCTION("glFramebufferRenderbuffer(...) called from " <<
 		get_path(file) << '(' << line << ')');
 
-	gl_FramebufferRenderbuffer(target,attachment,renderbuffertarget,renderbuffer);
+	TRACE_CALL(gl_FramebufferRenderbuffer)(target,attachment,renderbuffertarget,renderbuffer);
 
 	const char* result = get_last_error();
+
+	if (!result)
+		setAttachment(attachment, GL_RENDERBUFFER, renderbuffer, 0, 0);
 	breakOnError(!result, result);
 }
 
@@ -1749,9 +7292,12 @@ void gl::FramebufferTexture2D  (GLenum target, GLenum attachment, GLenum textarg
 	TRACE_FUNCTION("glFramebufferTexture2D(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_FramebufferTexture2D(target,attachment,textarget,texture,level);
+	TRACE_CALL(gl_FramebufferTexture2D)(target,attachment,textarget,texture,level);
 
 	const char* result = get_last_error();
+
+	if (!result)
+		setAttachment(attachment, GL_TEXTURE, texture, level, textarget);
 	breakOnError(!result, result);
 }
 
@@ -1761,9 +7307,15 @@ void gl::FrontFace  (GLenum mode, const char* file, int line)
 	TRACE_FUNCTION("glFrontFace(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_FrontFace(mode);
+	TRACE_CALL(gl_FrontFace)(mode);
 
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		_render_state.frontFace = mode;
+		_render_state_dirty = true;
+	}
 	breakOnError(!result, result);
 }
 
@@ -1777,7 +7329,7 @@ void gl::GenBuffers  (GLsizei n, GLuint *buffers, const char* file, int line)
 
 	breakOnError( n != 0 || !buffers );
 
-	gl_GenBuffers( n, buffers );
+	TRACE_CALL(gl_GenBuffers)( n, buffers );
 
 	const char* result = get_last_error();
 
@@ -1803,6 +7355,8 @@ void gl::GenBuffers  (GLsizei n, GLuint *buffers, const char* file, int line)
 			register_buffer(buffers[i]),
 			"Buffer already registered / Invalid buffer"
 		);
+
+		addObject(OBJECT_BUFFER, buffers[i], file, line);
 	}
 
 	breakOnError( !result, result );
@@ -1817,9 +7371,16 @@ void gl::GenFramebuffers  (GLsizei n, GLuint *framebuffers, const char* file, in
 	breakOnError( n >= 1, "Invalid size requested n <= 0" );
 	breakOnError( !framebuffers, "Invalid / empty destination pointer" );
 
-	gl_GenFramebuffers(n,framebuffers);
+	TRACE_CALL(gl_GenFramebuffers)(n,framebuffers);
 
 	const char* result = get_last_error();
+
+	for (int i = 0; !result && i < n; ++i)
+	{
+		register_framebuffer(framebuffers[i]);
+		addObject(OBJECT_FRAMEBUFFER, framebuffers[i], file, line);
+	}
+
 	breakOnError(!result, result);
 }
 
@@ -1831,9 +7392,17 @@ void gl::GenRenderbuffers  (GLsizei n, GLuint *renderbuffers, const char* file,
 
 	breakOnError(n != 0 || !renderbuffers);
 
-	gl_GenRenderbuffers(n,renderbuffers);
+	TRACE_CALL(gl_GenRenderbuffers)(n,renderbuffers);
 
 	const char* result = get_last_error();
+
+	/** add renderbuffer to registered */
+	for (int i = 0; !result && i < n; ++i)
+	{
+		register_renderbuffer(renderbuffers[i]);
+		addObject(OBJECT_RENDERBUFFER, renderbuffers[i], file, line);
+	}
+
 	breakOnError(!result, result);
 }
 
@@ -1847,7 +7416,7 @@ void gl::GenTextures  (GLsizei n, GLuint *textures, const char* file, int line)
 	breakOnError(MakeBool(textures), "textures : Invalid pointer" );
 
 	/** send it to opengl */
-	gl_GenTextures(n, textures);
+	TRACE_CALL(gl_GenTextures)(n, textures);
 	
 	const char* result = get_last_error();
 
@@ -1869,6 +7438,7 @@ void gl::GenTextures  (GLsizei n, GLuint *textures, const char* file, int line)
 	for (int i = 0; i < n; ++i)
 	{
 		register_texture(textures[i]);
+		addObject(OBJECT_TEXTURE, textures[i], file, line);
 	}
 	
 	breakOnError( !result, result );
@@ -1887,10 +7457,13 @@ void gl::GenerateMipmap  (GLenum target, const char* file, int line)
 		"GL_TEXTURE_CUBE_MAP"
 	);
 
-	gl_GenerateMipmap(target);
+	TRACE_CALL(gl_GenerateMipmap)(target);
 
 	const char* result = get_last_error();
 
+	if (!result)
+		setTextureMipmaps(target);
+
 	// add function to call list
 	addCall(result,
 		format("glGenerateMipmap( target:%s, buffers:%s)",
@@ -1908,7 +7481,7 @@ void gl::GetActiveAttrib  (GLuint program, GLuint index, GLsizei bufSize, GLsize
 	TRACE_FUNCTION("glGetActiveAttrib(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_GetActiveAttrib(program,index,bufSize,length,size,type,name);
+	TRACE_CALL(gl_GetActiveAttrib)(program,index,bufSize,length,size,type,name);
 
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -1920,7 +7493,7 @@ void gl::GetActiveUniform  (GLuint program, GLuint index, GLsizei bufSize, GLsiz
 	TRACE_FUNCTION("glGetActiveUniform(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_GetActiveUniform(program,index,bufSize,length,size,type,name);
+	TRACE_CALL(gl_GetActiveUniform)(program,index,bufSize,length,size,type,name);
 	
 	const char* result = get_last_error();
 
@@ -1933,7 +7506,7 @@ void gl::GetAttachedShaders  (GLuint program, GLsizei maxCount, GLsizei *count,
 	TRACE_FUNCTION("glGetAttachedShaders(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_GetAttachedShaders( program,maxCount,count,shaders );
+	TRACE_CALL(gl_GetAttachedShaders)( program,maxCount,count,shaders );
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -1945,7 +7518,7 @@ GLint gl::GetAttribLocation  (GLuint program, const GLchar *name, const char* fi
 	TRACE_FUNCTION("glGetAttribLocation(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	GLint r =  gl_GetAttribLocation(program,name);
+	GLint r =  TRACE_CALL(gl_GetAttribLocation)(program,name);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -1965,7 +7538,7 @@ void gl::GetBooleanv  (GLenum pname, GLboolean *data, const char* file, int line
 
 	breakOnError( MakeBool(data), "data : Invalid pointer" );
 
-	gl_GetBooleanv(pname,data);
+	TRACE_CALL(gl_GetBooleanv)(pname,data);
 
 	const char* result = get_last_error();
 
@@ -1986,7 +7559,7 @@ void gl::GetBufferParameteriv  (GLenum target, GLenum pname, GLint *params, cons
 	TRACE_FUNCTION("glGetBufferParameteriv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_GetBufferParameteriv(target,pname,params);
+	TRACE_CALL(gl_GetBufferParameteriv)(target,pname,params);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -1998,7 +7571,7 @@ GLenum gl::GetError  (const char* file, int line)
 	TRACE_FUNCTION("glGetError(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	GLenum r = gl_GetError();
+	GLenum r = TRACE_CALL(gl_GetError)();
 	
 	return r;
 }
@@ -2015,7 +7588,7 @@ void gl::GetFloatv  (GLenum pname, GLfloat *data, const char* file, int line)
 
 	breakOnError(MakeBool(data), "data : Invalid pointer" );
 
-	gl_GetFloatv(pname,data);
+	TRACE_CALL(gl_GetFloatv)(pname,data);
 
 	const char* result = get_last_error();
 
@@ -2036,7 +7609,7 @@ void gl::GetFramebufferAttachmentParameteriv  (GLenum target, GLenum attachment,
 	TRACE_FUNCTION("glGetFramebufferAttachmentParameteriv(...)"
 		" called from " << get_path(file) << '(' << line << ')');
 
-	gl_GetFramebufferAttachmentParameteriv(target,attachment,pname,
+	TRACE_CALL(gl_GetFramebufferAttachmentParameteriv)(target,attachment,pname,
 		params);
 	
 	const char* result = get_last_error();
@@ -4494,7 +10067,7 @@ void gl::GetIntegerv  (GLenum pname, GLint *data, const char* file, int line)
 	breakOnError(MakeBool(data), "data : Invalid pointer" );
 
 	/** send it to opengl */
-	gl_GetIntegerv(pname,data);
+	TRACE_CALL(gl_GetIntegerv)(pname,data);
 
 	const char* result = get_last_error();
 
@@ -4515,7 +10088,7 @@ void gl::GetProgramInfoLog  (GLuint program, GLsizei bufSize, GLsizei *length, G
 	TRACE_FUNCTION("glGetProgramInfoLog(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_GetProgramInfoLog( program, bufSize, length, infoLog );
+	TRACE_CALL(gl_GetProgramInfoLog)( program, bufSize, length, infoLog );
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4531,7 +10104,7 @@ void gl::GetProgramiv  (GLuint program, GLenum pname, GLint *params, const char*
 
 	breakOnError(is_valid, "Invalid program");
 
-	gl_GetProgramiv(program,pname,params);
+	TRACE_CALL(gl_GetProgramiv)(program,pname,params);
 
 	const char* result = get_last_error();
 
@@ -4551,7 +10124,7 @@ void gl::GetRenderbufferParameteriv  (GLenum target, GLenum pname, GLint *params
 	TRACE_FUNCTION("glGetRenderbufferParameteriv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_GetRenderbufferParameteriv(target,pname,params);
+	TRACE_CALL(gl_GetRenderbufferParameteriv)(target,pname,params);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4562,7 +10135,7 @@ void gl::GetShaderInfoLog  (GLuint shader, GLsizei bufSize, GLsizei *length, GLc
 {
 	TRACE_FUNCTION("glGetShaderInfoLog(...) called from " << 
 		get_path(file) << '(' << line << ')');
-	gl_GetShaderInfoLog(
+	TRACE_CALL(gl_GetShaderInfoLog)(
 		shader,
 		bufSize,
 		length,
@@ -4577,7 +10150,7 @@ void gl::GetShaderPrecisionFormat  (GLenum shadertype, GLenum precisiontype, GLi
 {
 	TRACE_FUNCTION("glGetShaderPrecisionFormat(...) called from " << 
 		get_path(file) << '(' << line << ')');
-	gl_GetShaderPrecisionFormat(
+	TRACE_CALL(gl_GetShaderPrecisionFormat)(
 		shadertype,
 		precisiontype,
 		range,
@@ -4592,7 +10165,7 @@ void gl::GetShaderSource  (GLuint shader, GLsizei bufSize, GLsizei *length, GLch
 {
 	TRACE_FUNCTION("glGetShaderSource(...) called from " << 
 		get_path(file) << '(' << line << ')');
-	gl_GetShaderSource(
+	TRACE_CALL(gl_GetShaderSource)(
 		shader,
 		bufSize,
 		length,
@@ -4608,7 +10181,7 @@ void gl::GetShaderiv  (GLuint shader, GLenum pname, GLint *params, const char* f
 	TRACE_FUNCTION("glGetShaderiv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_GetShaderiv(shader,pname,params);
+	TRACE_CALL(gl_GetShaderiv)(shader,pname,params);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4620,7 +10193,7 @@ const GLubyte* gl::GetString (GLenum name, const char* file, int line)
 	TRACE_FUNCTION("glGetString(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	const GLubyte* r = gl_GetString(name);
+	const GLubyte* r = TRACE_CALL(gl_GetString)(name);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4634,7 +10207,7 @@ void gl::GetTexParameterfv  (GLenum target, GLenum pname, GLfloat *params, const
 	TRACE_FUNCTION("glGetTexParameterfv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_GetTexParameterfv(target,pname,params);
+	TRACE_CALL(gl_GetTexParameterfv)(target,pname,params);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4646,7 +10219,7 @@ void gl::GetTexParameteriv  (GLenum target, GLenum pname, GLint *params, const c
 	TRACE_FUNCTION("glGetTexParameteriv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_GetTexParameteriv(target,pname,params);
+	TRACE_CALL(gl_GetTexParameteriv)(target,pname,params);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4662,9 +10235,38 @@ GLint gl::GetUniformLocation  (GLuint program, const GLchar *name, const char* f
 
 	breakOnError(is_valid, "Invalid program");
 
-	GLint r = gl_GetUniformLocation(program,name);
+	const uint64_t start = Core::now();
 
-	const char* result = get_last_error();
+	GLint r = -1;
+	bool cached = false;
+
+	/** locations do not change until the next link */
+	const bool use_cache = _uniform_location_cache && is_valid && name;
+	uint64_t key = 0;
+
+	if (use_cache)
+	{
+		key = (static_cast<uint64_t>(program) << 32) | getUniformNameId(name);
+
+		UniformLocation_m::Iterator iter = _uniform_locations.find(key);
+
+		if (iter != _uniform_locations.end())
+		{
+			r = iter->second;
+			cached = true;
+		}
+	}
+
+	if (!cached)
+		r = TRACE_CALL(gl_GetUniformLocation)(program,name);
+
+	addLocationQuery(Core::now() - start, cached, file, line);
+
+	const char* result = cached ? nullptr : get_last_error();
+
+	// an unlinked program... : the error must come back on the next call
+	if (use_cache && !cached && !result)
+		_uniform_locations[key] = r;
 
 	// add function to call list
 	addCall(result,
@@ -4683,7 +10285,7 @@ void gl::GetUniformfv  (GLuint program, GLint location, GLfloat *params, const c
 	TRACE_FUNCTION("glGetUniformfv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_GetUniformfv(program,location,params);
+	TRACE_CALL(gl_GetUniformfv)(program,location,params);
 
 	const char* result = get_last_error();
 
@@ -4703,7 +10305,7 @@ void gl::GetUniformiv  (GLuint program, GLint location, GLint *params, const cha
 	TRACE_FUNCTION("glGetUniformiv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_GetUniformiv( program, location, params );
+	TRACE_CALL(gl_GetUniformiv)( program, location, params );
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4715,7 +10317,7 @@ void gl::GetVertexAttribPointerv  (GLuint index, GLenum pname, void **pointer, c
 	TRACE_FUNCTION("glGetVertexAttribPointerv(...) called from " <<
 		get_path(file) << '(' << line << ')');
 
-	gl_GetVertexAttribPointerv( index, pname, pointer );
+	TRACE_CALL(gl_GetVertexAttribPointerv)( index, pname, pointer );
 
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4727,7 +10329,7 @@ void gl::GetVertexAttribfv  (GLuint index, GLenum pname, GLfloat *params, const
 	TRACE_FUNCTION("glGetVertexAttribfv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_GetVertexAttribfv( index, pname, params );
+	TRACE_CALL(gl_GetVertexAttribfv)( index, pname, params );
 
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4739,7 +10341,7 @@ void gl::GetVertexAttribiv  (GLuint index, GLenum pname, GLint *params, const ch
 	TRACE_FUNCTION("glGetVertexAttribiv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_GetVertexAttribiv( index, pname, params );
+	TRACE_CALL(gl_GetVertexAttribiv)( index, pname, params );
 
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4751,7 +10353,7 @@ void gl::Hint  (GLenum target, GLenum mode, const char* file, int line)
 	TRACE_FUNCTION("glHint(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Hint( target, mode );
+	TRACE_CALL(gl_Hint)( target, mode );
 
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4763,7 +10365,7 @@ GLboolean gl::IsBuffer  (GLuint buffer, const char* file, int line)
 	TRACE_FUNCTION("glIsBuffer(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	GLboolean r = gl_IsBuffer(buffer);
+	GLboolean r = TRACE_CALL(gl_IsBuffer)(buffer);
 
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4800,7 +10402,7 @@ GLboolean gl::IsEnabled  (GLenum cap, const char* file, int line)
 	}
 
 	/** send it to opengl */
-	GLboolean r = gl_IsEnabled(cap);
+	GLboolean r = TRACE_CALL(gl_IsEnabled)(cap);
 
 	const char* result = get_last_error();
 
@@ -4823,7 +10425,7 @@ GLboolean gl::IsFramebuffer  (GLuint framebuffer, const char* file, int line)
 	TRACE_FUNCTION("glIsFramebuffer(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	GLboolean r = gl_IsFramebuffer(framebuffer);
+	GLboolean r = TRACE_CALL(gl_IsFramebuffer)(framebuffer);
 
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4837,7 +10439,7 @@ GLboolean gl::IsProgram  (GLuint program, const char* file, int line)
 	TRACE_FUNCTION("glIsProgram(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	GLboolean r = gl_IsProgram(program);
+	GLboolean r = TRACE_CALL(gl_IsProgram)(program);
 
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4851,7 +10453,7 @@ GLboolean gl::IsRenderbuffer  (GLuint renderbuffer, const char* file, int line)
 	TRACE_FUNCTION("glIsRenderbuffer(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	GLboolean r = gl_IsRenderbuffer(renderbuffer);
+	GLboolean r = TRACE_CALL(gl_IsRenderbuffer)(renderbuffer);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4865,7 +10467,7 @@ GLboolean gl::IsShader  (GLuint shader, const char* file, int line)
 	TRACE_FUNCTION("glIsShader(...) called from " <<
 		get_path(file) << '(' << line << ')');
 
-	GLboolean r = gl_IsShader(shader);
+	GLboolean r = TRACE_CALL(gl_IsShader)(shader);
 
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4879,7 +10481,7 @@ GLboolean gl::IsTexture  (GLuint texture, const char* file, int line)
 	TRACE_FUNCTION("glIsTexture(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	GLboolean r = gl_IsTexture(texture);
+	GLboolean r = TRACE_CALL(gl_IsTexture)(texture);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4893,7 +10495,7 @@ void gl::LineWidth  (GLfloat width, const char* file, int line)
 	TRACE_FUNCTION("glLineWidth(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_LineWidth(width);
+	TRACE_CALL(gl_LineWidth)(width);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4905,10 +10507,59 @@ void gl::LinkProgram  (GLuint program, const char* file, int line)
 	TRACE_FUNCTION("glLinkProgram(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_LinkProgram(program);
-	
+	/** program binary cache : same inputs, same driver */
+	Vector<uint64_t> inputs;
+	const bool has_key = !_program_binary_dir.empty() &&
+		gl_ProgramBinaryOES && gl_GetProgramBinaryOES &&
+		Extensions::has("GL_OES_get_program_binary") &&
+		getProgramBinaryInputs(program, inputs);
+
+	/** link time : the driver only, not the cache files or the
+	 * uniform locations */
+	uint64_t time = 0;
+	const bool from_cache = has_key &&
+		loadProgramBinary(program, inputs, time);
+
+	if (!from_cache)
+	{
+		const uint64_t start = Core::now();
+
+		TRACE_CALL(gl_LinkProgram)(program);
+
+		// reading GL_LINK_STATUS waits for a deferred link
+		GLint status = GL_FALSE;
+		gl_GetProgramiv(program, GL_LINK_STATUS, &status);
+
+		time = Core::now() - start;
+	}
+
+	// linking resets the uniform values
+	releaseUniforms(program);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+		setUniformLocations(program);
+
+	if (!result && has_key && !from_cache)
+		saveProgramBinary(program, inputs);
+
+	addShaderTime(time);
+
+	if (!result)
+	{
+		ProgramPrep_t& prep = _program_preps[program];
+		prep.site = getCallSite(file, line);
+		++prep.links;
+		prep.linkTime = time;
+		prep.firstUse = true;
+		prep.firstUseTime = 0;
+	}
+
+	// add function to call list
+	addCall(result, format("glLinkProgram( program:%d%s )", program,
+		from_cache ? " binary cache" : ""), file, line);
+
 	breakOnError( !result, result );
 }
 
@@ -4928,10 +10579,13 @@ void gl::PixelStorei  (GLenum pname, GLint param, const char* file, int line)
 		"param: Invalid size must be 1,2,4 or 8"
 	);
 
-	gl_PixelStorei(	pname, param );
+	TRACE_CALL(gl_PixelStorei)(	pname, param );
 
 	const char* result = get_last_error();
 
+	if (!result && pname == GL_UNPACK_ALIGNMENT)
+		_unpack_alignment = param;
+
 	// add function to call list
 	addCall(result,
 		format("glPixelStorei( pname:%s param:%d )",
@@ -4950,9 +10604,17 @@ void gl::PolygonOffset  (GLfloat factor, GLfloat units, const char* file, int li
 	TRACE_FUNCTION("glPolygonOffset(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_PolygonOffset( factor, units );
+	TRACE_CALL(gl_PolygonOffset)( factor, units );
 	
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		_render_state.polygonFactor = factor;
+		_render_state.polygonUnits = units;
+		_render_state_dirty = true;
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -4962,7 +10624,7 @@ void gl::ReadPixels  (GLint x, GLint y, GLsizei width, GLsizei height, GLenum fo
 	TRACE_FUNCTION("glReadPixels(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_ReadPixels(x,y,width,height,format,type,pixels);
+	TRACE_CALL(gl_ReadPixels)(x,y,width,height,format,type,pixels);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4974,7 +10636,7 @@ void gl::ReleaseShaderCompiler  (const char* file, int line)
 	TRACE_FUNCTION("glReleaseShaderCompiler(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_ReleaseShaderCompiler();
+	TRACE_CALL(gl_ReleaseShaderCompiler)();
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -4986,9 +10648,13 @@ void gl::RenderbufferStorage  (GLenum target, GLenum internalformat, GLsizei wid
 	TRACE_FUNCTION("glRenderbufferStorage(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_RenderbufferStorage(target,internalformat,width,height);
+	TRACE_CALL(gl_RenderbufferStorage)(target,internalformat,width,height);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+		setRenderbufferStorage(internalformat, 0, width, height);
+
 	breakOnError( !result, result );
 }
 
@@ -4998,7 +10664,7 @@ void gl::SampleCoverage  (GLfloat value, GLboolean invert, const char* file, int
 	TRACE_FUNCTION("glSampleCoverage(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_SampleCoverage(value,invert);
+	TRACE_CALL(gl_SampleCoverage)(value,invert);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -5010,9 +10676,21 @@ void gl::Scissor  (GLint x, GLint y, GLsizei width, GLsizei height, const char*
 	TRACE_FUNCTION("glScissor(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Scissor(x,y,width,height);
+	TRACE_CALL(gl_Scissor)(x,y,width,height);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		_scissor = Rect_t(x, y, width, height);
+
+		_render_state.scissor[0] = x;
+		_render_state.scissor[1] = y;
+		_render_state.scissor[2] = width;
+		_render_state.scissor[3] = height;
+		_render_state_dirty = true;
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5022,7 +10700,7 @@ void gl::ShaderBinary  (GLsizei count, const GLuint *shaders, GLenum binaryforma
 	TRACE_FUNCTION("glShaderBinary(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_ShaderBinary(count,shaders,binaryformat,binary,length);
+	TRACE_CALL(gl_ShaderBinary)(count,shaders,binaryformat,binary,length);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -5034,9 +10712,29 @@ void gl::ShaderSource  (GLuint shader, GLsizei count, const GLchar *const*string
 	TRACE_FUNCTION("glShaderSource(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_ShaderSource(shader,count,string,length);
+	TRACE_CALL(gl_ShaderSource)(shader,count,string,length);
 	
 	const char* result = get_last_error();
+
+	/** hash of the strings, chained from one to the next */
+	if (!result && string)
+	{
+		uint64_t hash = 0;
+
+		for (GLsizei i = 0; i < count; ++i)
+		{
+			if (!string[i])
+				continue;
+
+			const size_t size = (length && length[i] >= 0) ?
+				length[i] : strlen(string[i]);
+
+			hash = hash64(string[i], size, hash);
+		}
+
+		_shader_hashes[shader] = hash;
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5046,9 +10744,25 @@ void gl::StencilFunc  (GLenum func, GLint ref, GLuint mask, const char* file, in
 	TRACE_FUNCTION("glStencilFunc(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_StencilFunc(func,ref,mask);
-	
-	const char* result = get_last_error();
+	TRACE_CALL(gl_StencilFunc)(func,ref,mask);
+	
+	const char* result = get_last_error();
+
+	if (!result)
+	{
+		uint first, last;
+		stencil_faces(GL_FRONT_AND_BACK, first, last);
+
+		for (uint i = first; i <= last; ++i)
+		{
+			_render_state.stencilFunc[i] = func;
+			_render_state.stencilRef[i] = ref;
+			_render_state.stencilValueMask[i] = mask;
+		}
+
+		_render_state_dirty = true;
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5058,9 +10772,25 @@ void gl::StencilFuncSeparate  (GLenum face, GLenum func, GLint ref, GLuint mask,
 	TRACE_FUNCTION("glStencilFuncSeparate(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_StencilFuncSeparate(face,func,ref,mask);
+	TRACE_CALL(gl_StencilFuncSeparate)(face,func,ref,mask);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		uint first, last;
+		stencil_faces(face, first, last);
+
+		for (uint i = first; i <= last; ++i)
+		{
+			_render_state.stencilFunc[i] = func;
+			_render_state.stencilRef[i] = ref;
+			_render_state.stencilValueMask[i] = mask;
+		}
+
+		_render_state_dirty = true;
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5070,9 +10800,23 @@ void gl::StencilMask  (GLuint mask, const char* file, int line)
 	TRACE_FUNCTION("glStencilMask(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_StencilMask(mask);
+	TRACE_CALL(gl_StencilMask)(mask);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		uint first, last;
+		stencil_faces(GL_FRONT_AND_BACK, first, last);
+
+		for (uint i = first; i <= last; ++i)
+		{
+			_render_state.stencilWriteMask[i] = mask;
+		}
+
+		_render_state_dirty = true;
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5082,9 +10826,23 @@ void gl::StencilMaskSeparate  (GLenum face, GLuint mask, const char* file, int l
 	TRACE_FUNCTION("glStencilMaskSeparate(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_StencilMaskSeparate(face,mask);
+	TRACE_CALL(gl_StencilMaskSeparate)(face,mask);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		uint first, last;
+		stencil_faces(face, first, last);
+
+		for (uint i = first; i <= last; ++i)
+		{
+			_render_state.stencilWriteMask[i] = mask;
+		}
+
+		_render_state_dirty = true;
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5094,9 +10852,25 @@ void gl::StencilOp  (GLenum fail, GLenum zfail, GLenum zpass, const char* file,
 	TRACE_FUNCTION("glStencilOp(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_StencilOp(fail,zfail,zpass);
+	TRACE_CALL(gl_StencilOp)(fail,zfail,zpass);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		uint first, last;
+		stencil_faces(GL_FRONT_AND_BACK, first, last);
+
+		for (uint i = first; i <= last; ++i)
+		{
+			_render_state.stencilFail[i] = fail;
+			_render_state.stencilZFail[i] = zfail;
+			_render_state.stencilZPass[i] = zpass;
+		}
+
+		_render_state_dirty = true;
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5106,9 +10880,25 @@ void gl::StencilOpSeparate  (GLenum face, GLenum sfail, GLenum dpfail, GLenum dp
 	TRACE_FUNCTION("glStencilOpSeparate(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_StencilOpSeparate(face,sfail,dpfail,dppass);
+	TRACE_CALL(gl_StencilOpSeparate)(face,sfail,dpfail,dppass);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		uint first, last;
+		stencil_faces(face, first, last);
+
+		for (uint i = first; i <= last; ++i)
+		{
+			_render_state.stencilFail[i] = sfail;
+			_render_state.stencilZFail[i] = dpfail;
+			_render_state.stencilZPass[i] = dppass;
+		}
+
+		_render_state_dirty = true;
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5169,11 +10959,30 @@ void gl::TexImage2D  (GLenum target, GLint level, GLint internalformat, GLsizei
 	);
 
 	/** send it to opengl */
-	gl_TexImage2D(target,level,internalformat,width,height,border,format,
+	TRACE_CALL(gl_TexImage2D)(target,level,internalformat,width,height,border,format,
 		type,pixels);
 
 	const char* result = get_last_error();
 
+	if (!result)
+	{
+		if (pixels)
+			addUpload(UPLOAD_TEX_IMAGE_2D,
+				getImageSize(width, height, 1, format, type), file, line);
+
+		setTextureLevel(target, level, internalformat, type, width, height,
+			1, getLevelSize(internalformat, type, width, height, 1));
+
+		shadowTexImage(target, level, width, height, format, type, pixels);
+
+		if (const Texture_t* texture = getBoundTexture(target))
+			checkRedundantUpload(UPLOAD_TEX_IMAGE_2D,
+				UploadRange_t(SHADOW_TEXTURE, texture->id,
+					(getTextureFace(target) << 8) | level, 0, 0, width, height),
+				pixels, getImageSize(width, height, 1, format, type),
+				file, line);
+	}
+
 	// add function to call list
 	addCall(result,
 		::format(
@@ -5213,7 +11022,7 @@ void gl::TexParameterf  (GLenum target, GLenum pname, GLfloat param, const char*
 	);
 
 	/** send it to opengl */
-	gl_TexParameterf(target,pname,param);
+	TRACE_CALL(gl_TexParameterf)(target,pname,param);
 
 	/** check for allowed value */
 	String sPname, sParam;
@@ -5297,7 +11106,7 @@ void gl::TexParameterf  (GLenum target, GLenum pname, GLfloat param, const char*
 
 	// add function to call list
 	addCall(result,
-		format("gl_TexParameterf( target:%s pname:%s param:%s )",
+		format("glTexParameterf( target:%s pname:%s param:%s )",
 		target == GL_TEXTURE_2D ? "GL_TEXTURE_2D" : "GL_TEXTURE_CUBE_MAP",
 		sPname, sParam),
 		file, line
@@ -5319,7 +11128,7 @@ void gl::TexParameterfv  (GLenum target, GLenum pname, const GLfloat *params, co
 			pname == GL_TEXTURE_WRAP_T)
 	);
 
-	gl_TexParameterfv(target,pname,params);
+	TRACE_CALL(gl_TexParameterfv)(target,pname,params);
 
 	/** check for allowed value */
 	//String sPname("todo"), sParam("todo");
@@ -5427,7 +11236,7 @@ void gl::TexParameteri  (GLenum target, GLenum pname, GLint param, const char* f
 			pname == GL_TEXTURE_WRAP_T)
 	);
 
-	gl_TexParameteri(target,pname,param);
+	TRACE_CALL(gl_TexParameteri)(target,pname,param);
 
 	String sPname, sParam;
 
@@ -5526,7 +11335,7 @@ void gl::TexParameteriv  (GLenum target, GLenum pname, const GLint *params, cons
 	TRACE_FUNCTION("glTexParameteriv(...) called from " <<
 		get_path(file) << '(' << line << ')');
 
-	gl_TexParameteriv(target,pname,params);
+	TRACE_CALL(gl_TexParameteriv)(target,pname,params);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -5538,10 +11347,29 @@ void gl::TexSubImage2D  (GLenum target, GLint level, GLint xoffset, GLint yoffse
 	TRACE_FUNCTION("glTexSubImage2D(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_TexSubImage2D(target,level,xoffset,yoffset,width,height,format,
+	TRACE_CALL(gl_TexSubImage2D)(target,level,xoffset,yoffset,width,height,format,
 		type,pixels);
-	
+
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		if (pixels)
+			addUpload(UPLOAD_TEX_SUB_IMAGE_2D,
+				getImageSize(width, height, 1, format, type), file, line);
+
+		shadowTexSubImage(target, level, xoffset, yoffset, width, height,
+			format, type, pixels);
+
+		if (const Texture_t* texture = getBoundTexture(target))
+			checkRedundantUpload(UPLOAD_TEX_SUB_IMAGE_2D,
+				UploadRange_t(SHADOW_TEXTURE, texture->id,
+					(getTextureFace(target) << 8) | level,
+					xoffset, yoffset, width, height),
+				pixels, getImageSize(width, height, 1, format, type),
+				file, line);
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5551,9 +11379,16 @@ void gl::Uniform1f  (GLint location, GLfloat v0, const char* file, int line)
 	TRACE_FUNCTION("glUniform1f(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Uniform1f(location,v0);
+	TRACE_CALL(gl_Uniform1f)(location,v0);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		const GLfloat v[] = { v0 };
+		addUniform(location, v, sizeof(v), 1, file, line);
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5563,9 +11398,13 @@ void gl::Uniform1fv  (GLint location, GLsizei count, const GLfloat *value, const
 	TRACE_FUNCTION("glUniform1fv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Uniform1fv(location,count,value);
+	TRACE_CALL(gl_Uniform1fv)(location,count,value);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+		addUniform(location, value, 1 * sizeof(GLfloat), count, file, line);
+
 	breakOnError( !result, result );
 }
 
@@ -5579,10 +11418,16 @@ void gl::Uniform1i  (GLint location, GLint v0, const char* file, int line)
 
 	breakOnError(is_bound, "No program bound");
 
-	gl_Uniform1i(location,v0);
+	TRACE_CALL(gl_Uniform1i)(location,v0);
 
 	const char* result = get_last_error();
 
+	if (!result)
+	{
+		const GLint v[] = { v0 };
+		addUniform(location, v, sizeof(v), 1, file, line);
+	}
+
 	// add function to call list
 	addCall(result,
 	 format("glUniform1i( location:%d, v0:%d )",location,v0),
@@ -5598,9 +11443,13 @@ void gl::Uniform1iv  (GLint location, GLsizei count, const GLint *value, const c
 	TRACE_FUNCTION("glUniform1iv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Uniform1iv(location,count,value);
+	TRACE_CALL(gl_Uniform1iv)(location,count,value);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+		addUniform(location, value, 1 * sizeof(GLint), count, file, line);
+
 	breakOnError( !result, result );
 }
 
@@ -5610,9 +11459,16 @@ void gl::Uniform2f  (GLint location, GLfloat v0, GLfloat v1, const char* file, i
 	TRACE_FUNCTION("glUniform2f(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Uniform2f(location,v0,v1);
+	TRACE_CALL(gl_Uniform2f)(location,v0,v1);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		const GLfloat v[] = { v0, v1 };
+		addUniform(location, v, sizeof(v), 1, file, line);
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5620,12 +11476,16 @@ PFNGLUNIFORM2FVPROC gl::gl_Uniform2fv INIT_POINTER;
 void gl::Uniform2fv  (GLint location, GLsizei count, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glUniform2fv(...) called from " << get_path(file) << '(' << line << ')');
-	gl_Uniform2fv(
+	TRACE_CALL(gl_Uniform2fv)(
 		location,
 		count,
 		value);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+		addUniform(location, value, 2 * sizeof(GLfloat), count, file, line);
+
 	breakOnError( !result, result );
 }
 
@@ -5635,9 +11495,16 @@ void gl::Uniform2i  (GLint location, GLint v0, GLint v1, const char* file, int l
 	TRACE_FUNCTION("glUniform2i(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Uniform2i(location,v0,v1);
+	TRACE_CALL(gl_Uniform2i)(location,v0,v1);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		const GLint v[] = { v0, v1 };
+		addUniform(location, v, sizeof(v), 1, file, line);
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5647,9 +11514,13 @@ void gl::Uniform2iv  (GLint location, GLsizei count, const GLint *value, const c
 	TRACE_FUNCTION("glUniform2iv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Uniform2iv(location,count,value);
+	TRACE_CALL(gl_Uniform2iv)(location,count,value);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+		addUniform(location, value, 2 * sizeof(GLint), count, file, line);
+
 	breakOnError( !result, result );
 }
 
@@ -5659,9 +11530,16 @@ void gl::Uniform3f  (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, const c
 	TRACE_FUNCTION("glUniform3f(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Uniform3f(location,v0,v1,v2);
+	TRACE_CALL(gl_Uniform3f)(location,v0,v1,v2);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		const GLfloat v[] = { v0, v1, v2 };
+		addUniform(location, v, sizeof(v), 1, file, line);
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5671,9 +11549,13 @@ void gl::Uniform3fv  (GLint location, GLsizei count, const GLfloat *value, const
 	TRACE_FUNCTION("glUniform3fv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Uniform3fv(location,count,value);
+	TRACE_CALL(gl_Uniform3fv)(location,count,value);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+		addUniform(location, value, 3 * sizeof(GLfloat), count, file, line);
+
 	breakOnError( !result, result );
 }
 
@@ -5683,9 +11565,16 @@ void gl::Uniform3i  (GLint location, GLint v0, GLint v1, GLint v2, const char* f
 	TRACE_FUNCTION("glUniform3i(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Uniform3i(location,v0,v1,v2);
+	TRACE_CALL(gl_Uniform3i)(location,v0,v1,v2);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		const GLint v[] = { v0, v1, v2 };
+		addUniform(location, v, sizeof(v), 1, file, line);
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5695,9 +11584,13 @@ void gl::Uniform3iv  (GLint location, GLsizei count, const GLint *value, const c
 	TRACE_FUNCTION("glUniform3iv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Uniform3iv(location,count,value);
+	TRACE_CALL(gl_Uniform3iv)(location,count,value);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+		addUniform(location, value, 3 * sizeof(GLint), count, file, line);
+
 	breakOnError( !result, result );
 }
 
@@ -5707,9 +11600,16 @@ void gl::Uniform4f  (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat
 	TRACE_FUNCTION("glUniform4f(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Uniform4f(location,v0,v1,v2,v3);
+	TRACE_CALL(gl_Uniform4f)(location,v0,v1,v2,v3);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		const GLfloat v[] = { v0, v1, v2, v3 };
+		addUniform(location, v, sizeof(v), 1, file, line);
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5719,9 +11619,13 @@ void gl::Uniform4fv  (GLint location, GLsizei count, const GLfloat *value, const
 	TRACE_FUNCTION("glUniform4fv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Uniform4fv(location,count,value);
+	TRACE_CALL(gl_Uniform4fv)(location,count,value);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+		addUniform(location, value, 4 * sizeof(GLfloat), count, file, line);
+
 	breakOnError( !result, result );
 }
 
@@ -5731,9 +11635,16 @@ void gl::Uniform4i  (GLint location, GLint v0, GLint v1, GLint v2, GLint v3, con
 	TRACE_FUNCTION("glUniform4i(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Uniform4i(location,v0,v1,v2,v3);
+	TRACE_CALL(gl_Uniform4i)(location,v0,v1,v2,v3);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		const GLint v[] = { v0, v1, v2, v3 };
+		addUniform(location, v, sizeof(v), 1, file, line);
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5743,9 +11654,13 @@ void gl::Uniform4iv  (GLint location, GLsizei count, const GLint *value, const c
 	TRACE_FUNCTION("glUniform4iv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_Uniform4iv(location,count,value);
+	TRACE_CALL(gl_Uniform4iv)(location,count,value);
 
 	const char* result = get_last_error();
+
+	if (!result)
+		addUniform(location, value, 4 * sizeof(GLint), count, file, line);
+
 	breakOnError(!result, result);
 }
 
@@ -5755,9 +11670,13 @@ void gl::UniformMatrix2fv  (GLint location, GLsizei count, GLboolean transpose,
 	TRACE_FUNCTION("glUniformMatrix2fv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_UniformMatrix2fv(location,count,transpose,value);
+	TRACE_CALL(gl_UniformMatrix2fv)(location,count,transpose,value);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+		addUniform(location, value, 4 * sizeof(GLfloat), count, file, line);
+
 	breakOnError( !result, result );
 }
 
@@ -5767,9 +11686,13 @@ void gl::UniformMatrix3fv  (GLint location, GLsizei count, GLboolean transpose,
 	TRACE_FUNCTION("glUniformMatrix3fv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_UniformMatrix3fv(location,count,transpose,value);
+	TRACE_CALL(gl_UniformMatrix3fv)(location,count,transpose,value);
 	
 	const char* result = get_last_error();
+
+	if (!result)
+		addUniform(location, value, 9 * sizeof(GLfloat), count, file, line);
+
 	breakOnError( !result, result );
 }
 
@@ -5779,10 +11702,13 @@ void gl::UniformMatrix4fv  (GLint location, GLsizei count, GLboolean transpose,
 	TRACE_FUNCTION("glUniformMatrix4fv(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_UniformMatrix4fv(location,count,transpose,value);
+	TRACE_CALL(gl_UniformMatrix4fv)(location,count,transpose,value);
 
 	const char* result = get_last_error();
 
+	if (!result)
+		addUniform(location, value, 16 * sizeof(GLfloat), count, file, line);
+
 	// add function to call list
 	addCall(result,
 		format(
@@ -5812,7 +11738,7 @@ void gl::UseProgram  (GLuint program, const char* file, int line)
 	);
 
 	/** send it to opengl */
-	gl_UseProgram( program );
+	TRACE_CALL(gl_UseProgram)( program );
 
 	// local
 	setUseProgram( ( 0 == program ) ? INVALID_BOUND : program );
@@ -5836,7 +11762,7 @@ void gl::ValidateProgram  (GLuint program, const char* file, int line)
 
 	breakOnError( is_valid, "Invalid program" );
 
-	gl_ValidateProgram(program);
+	TRACE_CALL(gl_ValidateProgram)(program);
 
 	const char* result = get_last_error();
 
@@ -5853,7 +11779,7 @@ void gl::VertexAttrib1f  (GLuint index, GLfloat x, const char* file, int line)
 	TRACE_FUNCTION("glVertexAttrib1f(...) called from " << 
 		get_path(file) << '(' << line << ')');
 
-	gl_VertexAttrib1f(index,x);
+	TRACE_CALL(gl_VertexAttrib1f)(index,x);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -5865,7 +11791,7 @@ void gl::VertexAttrib1fv  (GLuint index, const GLfloat *v, const char* file, int
 	TRACE_FUNCTION("glVertexAttrib1fv(...) called from " <<
 		get_path(file) << '(' << line << ')');
 
-	gl_VertexAttrib1fv(index,v);
+	TRACE_CALL(gl_VertexAttrib1fv)(index,v);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -5877,7 +11803,7 @@ void gl::VertexAttrib2f  (GLuint index, GLfloat x, GLfloat y, const char* file,
 	TRACE_FUNCTION("glVertexAttrib2f(...) called from " <<
 		get_path(file) << '(' << line << ')');
 
-	gl_VertexAttrib2f(index,x,y);
+	TRACE_CALL(gl_VertexAttrib2f)(index,x,y);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -5889,7 +11815,7 @@ void gl::VertexAttrib2fv  (GLuint index, const GLfloat *v, const char* file, int
 	TRACE_FUNCTION("glVertexAttrib2fv(...) called from " <<
 		get_path(file) << '(' << line << ')');
 
-	gl_VertexAttrib2fv(index,v);
+	TRACE_CALL(gl_VertexAttrib2fv)(index,v);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -5900,7 +11826,7 @@ void gl::VertexAttrib3f  (GLuint index, GLfloat x, GLfloat y, GLfloat z, const c
 {
 	TRACE_FUNCTION("glVertexAttrib3f(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_VertexAttrib3f(index,x,y,z);
+	TRACE_CALL(gl_VertexAttrib3f)(index,x,y,z);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -5911,7 +11837,7 @@ void gl::VertexAttrib3fv  (GLuint index, const GLfloat *v, const char* file, int
 {
 	TRACE_FUNCTION("glVertexAttrib3fv(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_VertexAttrib3fv(index,v);
+	TRACE_CALL(gl_VertexAttrib3fv)(index,v);
 	
 	const char* result = get_last_error();
 	breakOnError( !result, result );
@@ -5922,7 +11848,7 @@ void gl::VertexAttrib4f  (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat
 {
 	TRACE_FUNCTION("glVertexAttrib4f(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_VertexAttrib4f(index,x,y,z,w);
+	TRACE_CALL(gl_VertexAttrib4f)(index,x,y,z,w);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -5933,7 +11859,7 @@ void gl::VertexAttrib4fv  (GLuint index, const GLfloat *v, const char* file, int
 {
 	TRACE_FUNCTION("glVertexAttrib4fv(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_VertexAttrib4fv(index,v);
+	TRACE_CALL(gl_VertexAttrib4fv)(index,v);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -5948,25 +11874,51 @@ void gl::VertexAttribPointer(GLuint index, GLint size, GLenum type,
 		get_path(file) << '(' << line << ')');
 
 	breakOnError(
-		(size == 1 || size == 2 || size == 3 || size == 4) ||
+		(size == 1 || size == 2 || size == 3 || size == 4),
+		"size : Invalid value, must be 1, 2, 3 or 4"
+	);
+
+	breakOnError(
 		(type == GL_BYTE ||
-			type == GL_UNSIGNED_BYTE ||
-			type == GL_SHORT ||
-			type == GL_UNSIGNED_SHORT ||
-			type == GL_FIXED ||
-			type == GL_FLOAT) ||
-			(normalized == GL_TRUE || normalized == GL_FALSE) ||
-		(index < GL_MAX_VERTEX_ATTRIBS)
+		type == GL_UNSIGNED_BYTE ||
+		type == GL_SHORT ||
+		type == GL_UNSIGNED_SHORT ||
+		type == GL_FIXED ||
+		type == GL_FLOAT),
+		"type : Invalid enum"
 	);
 
 	breakOnError(
-		_bound_buffer[ARRAY_BUFFER] ||
-		_bound_buffer[ARRAY_BUFFER]->id != INVALID_BOUND
+		(normalized == GL_TRUE || normalized == GL_FALSE),
+		"normalized : Invalid value, must be GL_TRUE or GL_FALSE"
 	);
 
-	gl_VertexAttribPointer(index,size,type,normalized,stride,pointer);
+	breakOnError( stride >= 0, "stride : Invalid value (< 0)" );
+
+	breakOnError( static_cast<GLint>(index) < getMaxVertexAttribs(),
+		"index : Invalid value (>= GL_MAX_VERTEX_ATTRIBS)" );
+
+	TRACE_CALL(gl_VertexAttribPointer)(index,size,type,normalized,stride,pointer);
 
 	const char* result = get_last_error();
+
+	if (!result && index < VERTEX_ATTRIBS)
+	{
+		const uint buffer = getBoundBufferId(ARRAY_BUFFER);
+
+		VertexAttrib_t& attrib = _vertex_array.attribs[index];
+		attrib.size = size;
+		attrib.type = type;
+		attrib.normalized = normalized;
+		attrib.stride = stride;
+		attrib.buffer = buffer == INVALID_BOUND ? 0 : buffer;
+		attrib.detached = 0;
+		attrib.pointer = pointer;
+
+		_vertex_array.dirty = 1;
+		_vertex_array.layoutDirty = 1;
+	}
+
 	breakOnError( !result, result );
 }
 
@@ -5975,9 +11927,29 @@ void gl::Viewport  (GLint x, GLint y, GLsizei width, GLsizei height, const char*
 {
 	TRACE_FUNCTION("glViewport(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_Viewport(x,y,width,height);
+	TRACE_CALL(gl_Viewport)(x,y,width,height);
 
 	const char* result = get_last_error();
+
+	if (!result)
+	{
+		_viewport = Rect_t(x, y, width, height);
+
+		_render_state.viewport[0] = x;
+		_render_state.viewport[1] = y;
+		_render_state.viewport[2] = width;
+		_render_state.viewport[3] = height;
+		_render_state_dirty = true;
+	}
+
+	// default framebuffer size : the biggest viewport on it
+	if (!result && !_bound_framebuffer && !_default_size_set)
+	{
+		if (x + width > _default_width)
+			_default_width = x + width;
+		if (y + height > _default_height)
+			_default_height = y + height;
+	}
 	breakOnError(!result, result);
 }
 
@@ -5991,7 +11963,7 @@ void gl::BeginPerfMonitorAMD  (GLuint monitor, const char* file, int line)
 {
 	TRACE_FUNCTION("glBeginPerfMonitorAMD(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_BeginPerfMonitorAMD(monitor);
+	TRACE_CALL(gl_BeginPerfMonitorAMD)(monitor);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6002,7 +11974,7 @@ void gl::DeletePerfMonitorsAMD  (GLsizei n, GLuint *monitors, const char* file,
 {
 	TRACE_FUNCTION("glDeletePerfMonitorsAMD(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_DeletePerfMonitorsAMD(n,monitors);
+	TRACE_CALL(gl_DeletePerfMonitorsAMD)(n,monitors);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6013,7 +11985,7 @@ void gl::EndPerfMonitorAMD  (GLuint monitor, const char* file, int line)
 {
 	TRACE_FUNCTION("glEndPerfMonitorAMD(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_EndPerfMonitorAMD(monitor);
+	TRACE_CALL(gl_EndPerfMonitorAMD)(monitor);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6024,7 +11996,7 @@ void gl::GenPerfMonitorsAMD  (GLsizei n, GLuint *monitors, const char* file, int
 {
 	TRACE_FUNCTION("glGenPerfMonitorsAMD(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_GenPerfMonitorsAMD(n,monitors);
+	TRACE_CALL(gl_GenPerfMonitorsAMD)(n,monitors);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6035,7 +12007,7 @@ void gl::GetPerfMonitorCounterDataAMD  (GLuint monitor, GLenum pname, GLsizei da
 {
 	TRACE_FUNCTION("glGetPerfMonitorCounterDataAMD(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_GetPerfMonitorCounterDataAMD(monitor,pname,dataSize,data,bytesWritten);
+	TRACE_CALL(gl_GetPerfMonitorCounterDataAMD)(monitor,pname,dataSize,data,bytesWritten);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6045,7 +12017,7 @@ PFNGLGETPERFMONITORCOUNTERINFOAMDPROC gl::gl_GetPerfMonitorCounterInfoAMD INIT_P
 void gl::GetPerfMonitorCounterInfoAMD  (GLuint group, GLuint counter, GLenum pname, void *data, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPerfMonitorCounterInfoAMD(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPerfMonitorCounterInfoAMD(
+	TRACE_CALL(gl_GetPerfMonitorCounterInfoAMD)(
 		group,
 		counter,
 		pname,
@@ -6058,7 +12030,7 @@ PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC gl::gl_GetPerfMonitorCounterStringAMD IN
 void gl::GetPerfMonitorCounterStringAMD  (GLuint group, GLuint counter, GLsizei bufSize, GLsizei *length, GLchar *counterString, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPerfMonitorCounterStringAMD(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPerfMonitorCounterStringAMD(
+	TRACE_CALL(gl_GetPerfMonitorCounterStringAMD)(
 		group,
 		counter,
 		bufSize,
@@ -6072,7 +12044,7 @@ PFNGLGETPERFMONITORCOUNTERSAMDPROC gl::gl_GetPerfMonitorCountersAMD INIT_POINTER
 void gl::GetPerfMonitorCountersAMD  (GLuint group, GLint *numCounters, GLint *maxActiveCounters, GLsizei counterSize, GLuint *counters, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPerfMonitorCountersAMD(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPerfMonitorCountersAMD(
+	TRACE_CALL(gl_GetPerfMonitorCountersAMD)(
 		group,
 		numCounters,
 		maxActiveCounters,
@@ -6086,7 +12058,7 @@ PFNGLGETPERFMONITORGROUPSTRINGAMDPROC gl::gl_GetPerfMonitorGroupStringAMD INIT_P
 void gl::GetPerfMonitorGroupStringAMD  (GLuint group, GLsizei bufSize, GLsizei *length, GLchar *groupString, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPerfMonitorGroupStringAMD(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPerfMonitorGroupStringAMD(
+	TRACE_CALL(gl_GetPerfMonitorGroupStringAMD)(
 		group,
 		bufSize,
 		length,
@@ -6099,7 +12071,7 @@ PFNGLGETPERFMONITORGROUPSAMDPROC gl::gl_GetPerfMonitorGroupsAMD INIT_POINTER;
 void gl::GetPerfMonitorGroupsAMD  (GLint *numGroups, GLsizei groupsSize, GLuint *groups, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPerfMonitorGroupsAMD(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPerfMonitorGroupsAMD(
+	TRACE_CALL(gl_GetPerfMonitorGroupsAMD)(
 		numGroups,
 		groupsSize,
 		groups);
@@ -6111,7 +12083,7 @@ PFNGLSELECTPERFMONITORCOUNTERSAMDPROC gl::gl_SelectPerfMonitorCountersAMD INIT_P
 void gl::SelectPerfMonitorCountersAMD  (GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint *counterList, const char* file, int line)
 {
 	TRACE_FUNCTION("glSelectPerfMonitorCountersAMD(...) called from " << get_path(file) << '(' << line << ')');
-	gl_SelectPerfMonitorCountersAMD(
+	TRACE_CALL(gl_SelectPerfMonitorCountersAMD)(
 		monitor,
 		enable,
 		group,
@@ -6126,7 +12098,7 @@ PFNGLBLITFRAMEBUFFERANGLEPROC gl::gl_BlitFramebufferANGLE INIT_POINTER;
 void gl::BlitFramebufferANGLE  (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter, const char* file, int line)
 {
 	TRACE_FUNCTION("glBlitFramebufferANGLE(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BlitFramebufferANGLE(
+	TRACE_CALL(gl_BlitFramebufferANGLE)(
 		srcX0,
 		srcY0,
 		srcX1,
@@ -6146,13 +12118,17 @@ PFNGLRENDERBUFFERSTORAGEMULTISAMPLEANGLEPROC gl::gl_RenderbufferStorageMultisamp
 void gl::RenderbufferStorageMultisampleANGLE  (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, const char* file, int line)
 {
 	TRACE_FUNCTION("glRenderbufferStorageMultisampleANGLE(...) called from " << get_path(file) << '(' << line << ')');
-	gl_RenderbufferStorageMultisampleANGLE(
+	TRACE_CALL(gl_RenderbufferStorageMultisampleANGLE)(
 		target,
 		samples,
 		internalformat,
 		width,
 		height);
 	const char* result = get_last_error();
+
+	if (!result)
+		setRenderbufferStorage(internalformat, samples, width, height);
+
 	breakOnError(!result, result);
 }
 
@@ -6161,7 +12137,7 @@ PFNGLDRAWARRAYSINSTANCEDANGLEPROC gl::gl_DrawArraysInstancedANGLE INIT_POINTER;
 void gl::DrawArraysInstancedANGLE  (GLenum mode, GLint first, GLsizei count, GLsizei primcount, const char* file, int line)
 {
 	TRACE_FUNCTION("glDrawArraysInstancedANGLE(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DrawArraysInstancedANGLE(
+	TRACE_CALL(gl_DrawArraysInstancedANGLE)(
 		mode,
 		first,
 		count,
@@ -6174,7 +12150,7 @@ PFNGLDRAWELEMENTSINSTANCEDANGLEPROC gl::gl_DrawElementsInstancedANGLE INIT_POINT
 void gl::DrawElementsInstancedANGLE  (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount, const char* file, int line)
 {
 	TRACE_FUNCTION("glDrawElementsInstancedANGLE(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DrawElementsInstancedANGLE(
+	TRACE_CALL(gl_DrawElementsInstancedANGLE)(
 		mode,
 		count,
 		type,
@@ -6188,7 +12164,7 @@ PFNGLVERTEXATTRIBDIVISORANGLEPROC gl::gl_VertexAttribDivisorANGLE INIT_POINTER;
 void gl::VertexAttribDivisorANGLE  (GLuint index, GLuint divisor, const char* file, int line)
 {
 	TRACE_FUNCTION("glVertexAttribDivisorANGLE(...) called from " << get_path(file) << '(' << line << ')');
-	gl_VertexAttribDivisorANGLE(
+	TRACE_CALL(gl_VertexAttribDivisorANGLE)(
 		index,
 		divisor);
 	const char* result = get_last_error();
@@ -6200,7 +12176,7 @@ PFNGLGETTRANSLATEDSHADERSOURCEANGLEPROC gl::gl_GetTranslatedShaderSourceANGLE IN
 void gl::GetTranslatedShaderSourceANGLE  (GLuint shader, GLsizei bufsize, GLsizei *length, GLchar *source, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetTranslatedShaderSourceANGLE(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetTranslatedShaderSourceANGLE(
+	TRACE_CALL(gl_GetTranslatedShaderSourceANGLE)(
 		shader,
 		bufsize,
 		length,
@@ -6214,7 +12190,7 @@ PFNGLCOPYTEXTURELEVELSAPPLEPROC gl::gl_CopyTextureLevelsAPPLE INIT_POINTER;
 void gl::CopyTextureLevelsAPPLE  (GLuint destinationTexture, GLuint sourceTexture, GLint sourceBaseLevel, GLsizei sourceLevelCount, const char* file, int line)
 {
 	TRACE_FUNCTION("glCopyTextureLevelsAPPLE(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CopyTextureLevelsAPPLE(
+	TRACE_CALL(gl_CopyTextureLevelsAPPLE)(
 		destinationTexture,
 		sourceTexture,
 		sourceBaseLevel,
@@ -6228,13 +12204,17 @@ PFNGLRENDERBUFFERSTORAGEMULTISAMPLEAPPLEPROC gl::gl_RenderbufferStorageMultisamp
 void gl::RenderbufferStorageMultisampleAPPLE  (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, const char* file, int line)
 {
 	TRACE_FUNCTION("glRenderbufferStorageMultisampleAPPLE(...) called from " << get_path(file) << '(' << line << ')');
-	gl_RenderbufferStorageMultisampleAPPLE(
+	TRACE_CALL(gl_RenderbufferStorageMultisampleAPPLE)(
 		target,
 		samples,
 		internalformat,
 		width,
 		height);
 	const char* result = get_last_error();
+
+	if (!result)
+		setRenderbufferStorage(internalformat, samples, width, height);
+
 	breakOnError(!result, result);
 }
 
@@ -6242,7 +12222,7 @@ PFNGLRESOLVEMULTISAMPLEFRAMEBUFFERAPPLEPROC gl::gl_ResolveMultisampleFramebuffer
 void gl::ResolveMultisampleFramebufferAPPLE  (const char* file, int line)
 {
 	TRACE_FUNCTION("glResolveMultisampleFramebufferAPPLE(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ResolveMultisampleFramebufferAPPLE();
+	TRACE_CALL(gl_ResolveMultisampleFramebufferAPPLE)();
 	const char* result = get_last_error();
 	breakOnError(!result, result);
 }
@@ -6252,19 +12232,21 @@ PFNGLCLIENTWAITSYNCAPPLEPROC gl::gl_ClientWaitSyncAPPLE INIT_POINTER;
 GLenum gl::ClientWaitSyncAPPLE  (GLsync sync, GLbitfield flags, GLuint64 timeout, const char* file, int line)
 {
 	TRACE_FUNCTION("glClientWaitSyncAPPLE(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_ClientWaitSyncAPPLE(
+	GLenum r = TRACE_CALL(gl_ClientWaitSyncAPPLE)(
 		sync,
 		flags,
 		timeout);
 	const char* result = get_last_error();
 	breakOnError(!result, result);
+
+	return r;
 }
 
 PFNGLDELETESYNCAPPLEPROC gl::gl_DeleteSyncAPPLE INIT_POINTER;
 void gl::DeleteSyncAPPLE  (GLsync sync, const char* file, int line)
 {
 	TRACE_FUNCTION("glDeleteSyncAPPLE(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DeleteSyncAPPLE(
+	TRACE_CALL(gl_DeleteSyncAPPLE)(
 		sync);
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6274,18 +12256,20 @@ PFNGLFENCESYNCAPPLEPROC gl::gl_FenceSyncAPPLE INIT_POINTER;
 GLsync gl::FenceSyncAPPLE  (GLenum condition, GLbitfield flags, const char* file, int line)
 {
 	TRACE_FUNCTION("glFenceSyncAPPLE(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_FenceSyncAPPLE(
+	GLsync r = TRACE_CALL(gl_FenceSyncAPPLE)(
 		condition,
 		flags);
 	const char* result = get_last_error();
 	breakOnError(!result, result);
+
+	return r;
 }
 
 PFNGLGETINTEGER64VAPPLEPROC gl::gl_GetInteger64vAPPLE INIT_POINTER;
 void gl::GetInteger64vAPPLE  (GLenum pname, GLint64 *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetInteger64vAPPLE(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetInteger64vAPPLE(
+	TRACE_CALL(gl_GetInteger64vAPPLE)(
 		pname,
 		params);
 	const char* result = get_last_error();
@@ -6296,7 +12280,7 @@ PFNGLGETSYNCIVAPPLEPROC gl::gl_GetSyncivAPPLE INIT_POINTER;
 void gl::GetSyncivAPPLE  (GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetSyncivAPPLE(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetSyncivAPPLE(
+	TRACE_CALL(gl_GetSyncivAPPLE)(
 		sync,
 		pname,
 		bufSize,
@@ -6311,7 +12295,7 @@ GLboolean gl::IsSyncAPPLE  (GLsync sync, const char* file, int line)
 {
 	TRACE_FUNCTION("glIsSyncAPPLE(...) called from " << get_path(file) << '(' << line << ')');
 
-	GLboolean r = gl_IsSyncAPPLE(sync);
+	GLboolean r = TRACE_CALL(gl_IsSyncAPPLE)(sync);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6323,7 +12307,7 @@ PFNGLWAITSYNCAPPLEPROC gl::gl_WaitSyncAPPLE INIT_POINTER;
 void gl::WaitSyncAPPLE  (GLsync sync, GLbitfield flags, GLuint64 timeout, const char* file, int line)
 {
 	TRACE_FUNCTION("glWaitSyncAPPLE(...) called from " << get_path(file) << '(' << line << ')');
-	gl_WaitSyncAPPLE(
+	TRACE_CALL(gl_WaitSyncAPPLE)(
 		sync,
 		flags,
 		timeout);
@@ -6336,7 +12320,7 @@ PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEEXTPROC gl::gl_DrawArraysInstancedBaseInstan
 void gl::DrawArraysInstancedBaseInstanceEXT  (GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance, const char* file, int line)
 {
 	TRACE_FUNCTION("glDrawArraysInstancedBaseInstanceEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DrawArraysInstancedBaseInstanceEXT(
+	TRACE_CALL(gl_DrawArraysInstancedBaseInstanceEXT)(
 		mode,
 		first,
 		count,
@@ -6350,7 +12334,7 @@ PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEEXTPROC gl::gl_DrawElementsInstancedBaseIn
 void gl::DrawElementsInstancedBaseInstanceEXT  (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance, const char* file, int line)
 {
 	TRACE_FUNCTION("glDrawElementsInstancedBaseInstanceEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DrawElementsInstancedBaseInstanceEXT(
+	TRACE_CALL(gl_DrawElementsInstancedBaseInstanceEXT)(
 		mode,
 		count,
 		type,
@@ -6365,7 +12349,7 @@ PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEEXTPROC gl::gl_DrawElementsInsta
 void gl::DrawElementsInstancedBaseVertexBaseInstanceEXT  (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance, const char* file, int line)
 {
 	TRACE_FUNCTION("glDrawElementsInstancedBaseVertexBaseInstanceEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DrawElementsInstancedBaseVertexBaseInstanceEXT(
+	TRACE_CALL(gl_DrawElementsInstancedBaseVertexBaseInstanceEXT)(
 		mode,
 		count,
 		type,
@@ -6382,7 +12366,7 @@ PFNGLBINDFRAGDATALOCATIONEXTPROC gl::gl_BindFragDataLocationEXT INIT_POINTER;
 void gl::BindFragDataLocationEXT  (GLuint program, GLuint color, const GLchar *name, const char* file, int line)
 {
 	TRACE_FUNCTION("glBindFragDataLocationEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BindFragDataLocationEXT(
+	TRACE_CALL(gl_BindFragDataLocationEXT)(
 		program,
 		color,
 		name);
@@ -6394,7 +12378,7 @@ PFNGLBINDFRAGDATALOCATIONINDEXEDEXTPROC gl::gl_BindFragDataLocationIndexedEXT IN
 void gl::BindFragDataLocationIndexedEXT  (GLuint program, GLuint colorNumber, GLuint index, const GLchar *name, const char* file, int line)
 {
 	TRACE_FUNCTION("glBindFragDataLocationIndexedEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BindFragDataLocationIndexedEXT(
+	TRACE_CALL(gl_BindFragDataLocationIndexedEXT)(
 		program,
 		colorNumber,
 		index,
@@ -6408,7 +12392,7 @@ GLint gl::GetFragDataIndexEXT  (GLuint program, const GLchar *name, const char*
 {
 	TRACE_FUNCTION("glGetFragDataIndexEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	GLint r = gl_GetFragDataIndexEXT(program,name);
+	GLint r = TRACE_CALL(gl_GetFragDataIndexEXT)(program,name);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6421,7 +12405,7 @@ GLint gl::GetProgramResourceLocationIndexEXT  (GLuint program, GLenum programInt
 {
 	TRACE_FUNCTION("glGetProgramResourceLocationIndexEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	GLint r = gl_GetProgramResourceLocationIndexEXT(program,programInterface,name);
+	GLint r = TRACE_CALL(gl_GetProgramResourceLocationIndexEXT)(program,programInterface,name);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6434,7 +12418,7 @@ PFNGLBUFFERSTORAGEEXTPROC gl::gl_BufferStorageEXT INIT_POINTER;
 void gl::BufferStorageEXT  (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags, const char* file, int line)
 {
 	TRACE_FUNCTION("glBufferStorageEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BufferStorageEXT(
+	TRACE_CALL(gl_BufferStorageEXT)(
 		target,
 		size,
 		data,
@@ -6448,7 +12432,7 @@ PFNGLCOPYIMAGESUBDATAEXTPROC gl::gl_CopyImageSubDataEXT INIT_POINTER;
 void gl::CopyImageSubDataEXT  (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth, const char* file, int line)
 {
 	TRACE_FUNCTION("glCopyImageSubDataEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CopyImageSubDataEXT(
+	TRACE_CALL(gl_CopyImageSubDataEXT)(
 		srcName,
 		srcTarget,
 		srcLevel,
@@ -6473,7 +12457,7 @@ PFNGLGETOBJECTLABELEXTPROC gl::gl_GetObjectLabelEXT INIT_POINTER;
 void gl::GetObjectLabelEXT  (GLenum type, GLuint object, GLsizei bufSize, GLsizei *length, GLchar *label, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetObjectLabelEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetObjectLabelEXT(
+	TRACE_CALL(gl_GetObjectLabelEXT)(
 		type,
 		object,
 		bufSize,
@@ -6487,7 +12471,7 @@ PFNGLLABELOBJECTEXTPROC gl::gl_LabelObjectEXT INIT_POINTER;
 void gl::LabelObjectEXT  (GLenum type, GLuint object, GLsizei length, const GLchar *label, const char* file, int line)
 {
 	TRACE_FUNCTION("glLabelObjectEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_LabelObjectEXT(
+	TRACE_CALL(gl_LabelObjectEXT)(
 		type,
 		object,
 		length,
@@ -6501,9 +12485,10 @@ PFNGLINSERTEVENTMARKEREXTPROC gl::gl_InsertEventMarkerEXT INIT_POINTER;
 void gl::InsertEventMarkerEXT  (GLsizei length, const GLchar *marker, const char* file, int line)
 {
 	TRACE_FUNCTION("glInsertEventMarkerEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_InsertEventMarkerEXT(
+	TRACE_CALL(gl_InsertEventMarkerEXT)(
 		length,
 		marker);
+	pushZone(length, marker, true);
 	const char* result = get_last_error();
 	breakOnError(!result, result);
 }
@@ -6513,7 +12498,9 @@ void gl::PopGroupMarkerEXT  (const char* file, int line)
 {
 	TRACE_FUNCTION("glPopGroupMarkerEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_PopGroupMarkerEXT();
+	popGpuGroup();
+	popZone();
+	TRACE_CALL(gl_PopGroupMarkerEXT)();
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6524,7 +12511,9 @@ void gl::PushGroupMarkerEXT  (GLsizei length, const GLchar *marker, const char*
 {
 	TRACE_FUNCTION("glPushGroupMarkerEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_PushGroupMarkerEXT(length,marker);
+	TRACE_CALL(gl_PushGroupMarkerEXT)(length,marker);
+	pushGpuGroup(length, marker);
+	pushZone(length, marker, false);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6536,9 +12525,12 @@ void gl::DiscardFramebufferEXT  (GLenum target, GLsizei numAttachments, const GL
 {
 	TRACE_FUNCTION("glDiscardFramebufferEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_DiscardFramebufferEXT(target,numAttachments,attachments);
+	TRACE_CALL(gl_DiscardFramebufferEXT)(target,numAttachments,attachments);
 
 	const char* result = get_last_error();
+
+	if (!result && target == GL_FRAMEBUFFER)
+		addPassDiscard(numAttachments, attachments);
 	breakOnError(!result, result);
 }
 
@@ -6548,7 +12540,19 @@ void gl::BeginQueryEXT  (GLenum target, GLuint id, const char* file, int line)
 {
 	TRACE_FUNCTION("glBeginQueryEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_BeginQueryEXT(target,id);
+	/** elapsed queries can't be nested : drop the frame timing */
+	if (target == GL_TIME_ELAPSED_EXT)
+	{
+		if (!_gpu_timestamps && _gpu_frame.begin)
+		{
+			gl_EndQueryEXT(GL_TIME_ELAPSED_EXT);
+			releaseGpuQuery(_gpu_frame);
+			++_gpu_dropped;
+		}
+		_gpu_app_elapsed = true;
+	}
+
+	TRACE_CALL(gl_BeginQueryEXT)(target,id);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6559,7 +12563,7 @@ void gl::DeleteQueriesEXT  (GLsizei n, const GLuint *ids, const char* file, int
 {
 	TRACE_FUNCTION("glDeleteQueriesEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_DeleteQueriesEXT(n,ids);
+	TRACE_CALL(gl_DeleteQueriesEXT)(n,ids);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6570,7 +12574,10 @@ void gl::EndQueryEXT  (GLenum target, const char* file, int line)
 {
 	TRACE_FUNCTION("glEndQueryEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_EndQueryEXT(target);
+	TRACE_CALL(gl_EndQueryEXT)(target);
+
+	if (target == GL_TIME_ELAPSED_EXT)
+		_gpu_app_elapsed = false;
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6581,7 +12588,7 @@ void gl::GenQueriesEXT  (GLsizei n, GLuint *ids, const char* file, int line)
 {
 	TRACE_FUNCTION("glGenQueriesEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_GenQueriesEXT(n,ids);
+	TRACE_CALL(gl_GenQueriesEXT)(n,ids);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6592,7 +12599,7 @@ void gl::GetQueryObjecti64vEXT  (GLuint id, GLenum pname, GLint64 *params, const
 {
 	TRACE_FUNCTION("glGetQueryObjecti64vEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_GetQueryObjecti64vEXT(id,pname,params);
+	TRACE_CALL(gl_GetQueryObjecti64vEXT)(id,pname,params);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6603,7 +12610,7 @@ void gl::GetQueryObjectivEXT  (GLuint id, GLenum pname, GLint *params, const cha
 {
 	TRACE_FUNCTION("glGetQueryObjectivEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_GetQueryObjectivEXT(id,pname,params);
+	TRACE_CALL(gl_GetQueryObjectivEXT)(id,pname,params);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6614,7 +12621,7 @@ void gl::GetQueryObjectui64vEXT  (GLuint id, GLenum pname, GLuint64 *params, con
 {
 	TRACE_FUNCTION("glGetQueryObjectui64vEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_GetQueryObjectui64vEXT(id,pname,params);
+	TRACE_CALL(gl_GetQueryObjectui64vEXT)(id,pname,params);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6625,7 +12632,7 @@ void gl::GetQueryObjectuivEXT  (GLuint id, GLenum pname, GLuint *params, const c
 {
 	TRACE_FUNCTION("glGetQueryObjectuivEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_GetQueryObjectuivEXT(id,pname,params);
+	TRACE_CALL(gl_GetQueryObjectuivEXT)(id,pname,params);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6636,7 +12643,7 @@ void gl::GetQueryivEXT  (GLenum target, GLenum pname, GLint *params, const char*
 {
 	TRACE_FUNCTION("glGetQueryivEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_GetQueryivEXT(target,pname,params);
+	TRACE_CALL(gl_GetQueryivEXT)(target,pname,params);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6647,7 +12654,7 @@ GLboolean gl::IsQueryEXT  (GLuint id, const char* file, int line)
 {
 	TRACE_FUNCTION("glIsQueryEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	GLboolean r = gl_IsQueryEXT(id);
+	GLboolean r = TRACE_CALL(gl_IsQueryEXT)(id);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6660,7 +12667,7 @@ void gl::QueryCounterEXT  (GLuint id, GLenum target, const char* file, int line)
 {
 	TRACE_FUNCTION("glQueryCounterEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_QueryCounterEXT(id,target);
+	TRACE_CALL(gl_QueryCounterEXT)(id,target);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6672,7 +12679,7 @@ void gl::DrawBuffersEXT  (GLsizei n, const GLenum *bufs, const char* file, int l
 {
 	TRACE_FUNCTION("glDrawBuffersEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_DrawBuffersEXT(n,bufs);
+	TRACE_CALL(gl_DrawBuffersEXT)(n,bufs);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6684,7 +12691,7 @@ void gl::BlendEquationSeparateiEXT  (GLuint buf, GLenum modeRGB, GLenum modeAlph
 {
 	TRACE_FUNCTION("glBlendEquationSeparateiEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_BlendEquationSeparateiEXT(buf,modeRGB,modeAlpha);
+	TRACE_CALL(gl_BlendEquationSeparateiEXT)(buf,modeRGB,modeAlpha);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6695,7 +12702,7 @@ void gl::BlendEquationiEXT  (GLuint buf, GLenum mode, const char* file, int line
 {
 	TRACE_FUNCTION("glBlendEquationiEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_BlendEquationiEXT(buf,mode);
+	TRACE_CALL(gl_BlendEquationiEXT)(buf,mode);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6706,7 +12713,7 @@ void gl::BlendFuncSeparateiEXT  (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenu
 {
 	TRACE_FUNCTION("glBlendFuncSeparateiEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_BlendFuncSeparateiEXT(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);
+	TRACE_CALL(gl_BlendFuncSeparateiEXT)(buf,srcRGB,dstRGB,srcAlpha,dstAlpha);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6717,7 +12724,7 @@ void gl::BlendFunciEXT  (GLuint buf, GLenum src, GLenum dst, const char* file, i
 {
 	TRACE_FUNCTION("glBlendFunciEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_BlendFunciEXT(buf,src,dst);
+	TRACE_CALL(gl_BlendFunciEXT)(buf,src,dst);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6728,7 +12735,7 @@ void gl::ColorMaskiEXT  (GLuint index, GLboolean r, GLboolean g, GLboolean b, GL
 {
 	TRACE_FUNCTION("glColorMaskiEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_ColorMaskiEXT(index,r,g,b,a);
+	TRACE_CALL(gl_ColorMaskiEXT)(index,r,g,b,a);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6739,7 +12746,7 @@ void gl::DisableiEXT  (GLenum target, GLuint index, const char* file, int line)
 {
 	TRACE_FUNCTION("glDisableiEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_DisableiEXT(target,index);
+	TRACE_CALL(gl_DisableiEXT)(target,index);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6750,7 +12757,7 @@ void gl::EnableiEXT  (GLenum target, GLuint index, const char* file, int line)
 {
 	TRACE_FUNCTION("glEnableiEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_EnableiEXT(target,index);
+	TRACE_CALL(gl_EnableiEXT)(target,index);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6761,7 +12768,7 @@ GLboolean gl::IsEnablediEXT  (GLenum target, GLuint index, const char* file, int
 {
 	TRACE_FUNCTION("glIsEnablediEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	return gl_IsEnablediEXT(target,index);
+	return TRACE_CALL(gl_IsEnablediEXT)(target,index);
 }
 
 // GL_EXT_draw_elements_base_vertex
@@ -6770,7 +12777,7 @@ void gl::DrawElementsBaseVertexEXT  (GLenum mode, GLsizei count, GLenum type, co
 {
 	TRACE_FUNCTION("glDrawElementsBaseVertexEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_DrawElementsBaseVertexEXT(mode,count,type,indices,basevertex);
+	TRACE_CALL(gl_DrawElementsBaseVertexEXT)(mode,count,type,indices,basevertex);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6781,7 +12788,7 @@ void gl::DrawElementsInstancedBaseVertexEXT  (GLenum mode, GLsizei count, GLenum
 {
 	TRACE_FUNCTION("glDrawElementsInstancedBaseVertexEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_DrawElementsInstancedBaseVertexEXT(
+	TRACE_CALL(gl_DrawElementsInstancedBaseVertexEXT)(
 		mode,count,type,indices,instancecount,basevertex);
 
 	const char* result = get_last_error();
@@ -6793,7 +12800,7 @@ void gl::DrawRangeElementsBaseVertexEXT  (GLenum mode, GLuint start, GLuint end,
 {
 	TRACE_FUNCTION("glDrawRangeElementsBaseVertexEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_DrawRangeElementsBaseVertexEXT(
+	TRACE_CALL(gl_DrawRangeElementsBaseVertexEXT)(
 		mode,start,end,count,type,indices,basevertex);
 
 	const char* result = get_last_error();
@@ -6805,7 +12812,7 @@ void gl::MultiDrawElementsBaseVertexEXT  (GLenum mode, const GLsizei *count, GLe
 {
 	TRACE_FUNCTION("glMultiDrawElementsBaseVertexEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_MultiDrawElementsBaseVertexEXT(
+	TRACE_CALL(gl_MultiDrawElementsBaseVertexEXT)(
 		mode,count,type,indices,primcount,basevertex);
 
 	const char* result = get_last_error();
@@ -6818,7 +12825,7 @@ void gl::DrawArraysInstancedEXT  (GLenum mode, GLint start, GLsizei count, GLsiz
 {
 	TRACE_FUNCTION("glDrawArraysInstancedEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_DrawArraysInstancedEXT(
+	TRACE_CALL(gl_DrawArraysInstancedEXT)(
 		mode,start,count,primcount);
 
 	const char* result = get_last_error();
@@ -6830,7 +12837,7 @@ void gl::DrawElementsInstancedEXT  (GLenum mode, GLsizei count, GLenum type, con
 {
 	TRACE_FUNCTION("glDrawElementsInstancedEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_DrawElementsInstancedEXT(
+	TRACE_CALL(gl_DrawElementsInstancedEXT)(
 		mode,count,type,indices,primcount);
 
 	const char* result = get_last_error();
@@ -6843,7 +12850,7 @@ void gl::FramebufferTextureEXT  (GLenum target, GLenum attachment, GLuint textur
 {
 	TRACE_FUNCTION("glFramebufferTextureEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_FramebufferTextureEXT(
+	TRACE_CALL(gl_FramebufferTextureEXT)(
 		target,attachment,texture,level);
 
 	const char* result = get_last_error();
@@ -6856,7 +12863,7 @@ void gl::VertexAttribDivisorEXT  (GLuint index, GLuint divisor, const char* file
 {
 	TRACE_FUNCTION("glVertexAttribDivisorEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_VertexAttribDivisorEXT(index,divisor);
+	TRACE_CALL(gl_VertexAttribDivisorEXT)(index,divisor);
 
 	const char* result = get_last_error();
 	breakOnError(!result, result);
@@ -6868,21 +12875,53 @@ void gl::FlushMappedBufferRangeEXT  (GLenum target, GLintptr offset, GLsizeiptr
 {
 	TRACE_FUNCTION("glFlushMappedBufferRangeEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_FlushMappedBufferRangeEXT(target,offset,length);
+	TRACE_CALL(gl_FlushMappedBufferRangeEXT)(target,offset,length);
 
 	const char* result = get_last_error();
+
+	if (!result &&
+		(target == GL_ARRAY_BUFFER || target == GL_ELEMENT_ARRAY_BUFFER))
+	{
+		flushMapping(target == GL_ARRAY_BUFFER ? ARRAY_BUFFER :
+			ELEMENT_ARRAY_BUFFER, offset, length);
+	}
+
 	breakOnError(!result, result);
 }
 
 PFNGLMAPBUFFERRANGEEXTPROC gl::gl_MapBufferRangeEXT INIT_POINTER;
-void gl::MapBufferRangeEXT  (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access, const char* file, int line)
+void* gl::MapBufferRangeEXT  (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access, const char* file, int line)
 {
 	TRACE_FUNCTION("glMapBufferRangeEXT(...) called from " << get_path(file) << '(' << line << ')');
 
-	gl_MapBufferRangeEXT(target,offset,length,access);
+	const uint64_t start = Core::now();
+	void* pointer = TRACE_CALL(gl_MapBufferRangeEXT)(target,offset,length,access);
+	const uint64_t time = Core::now() - start;
+
+	// the content is written outside of the debugger
+	if ((access & GL_MAP_WRITE_BIT_EXT) &&
+		(target == GL_ARRAY_BUFFER || target == GL_ELEMENT_ARRAY_BUFFER))
+	{
+		const uint id = getBoundBufferId(target == GL_ARRAY_BUFFER ?
+			ARRAY_BUFFER : ELEMENT_ARRAY_BUFFER);
+
+		_shadow.release(getShadowKey(SHADOW_BUFFER, id));
+		invalidateIndexRanges(id);
+		invalidateUploadHashes(SHADOW_BUFFER, id);
+	}
 
 	const char* result = get_last_error();
+
+	if (!result && pointer &&
+		(target == GL_ARRAY_BUFFER || target == GL_ELEMENT_ARRAY_BUFFER))
+	{
+		beginMapping(target == GL_ARRAY_BUFFER ? ARRAY_BUFFER :
+			ELEMENT_ARRAY_BUFFER, offset, length, access, pointer, time,
+			file, line);
+	}
+
 	breakOnError(!result, result);
+	return pointer;
 }
 
 // GL_EXT_multi_draw_arrays
@@ -6890,7 +12929,7 @@ PFNGLMULTIDRAWARRAYSEXTPROC gl::gl_MultiDrawArraysEXT INIT_POINTER;
 void gl::MultiDrawArraysEXT  (GLenum mode, const GLint *first, const GLsizei *count, GLsizei primcount, const char* file, int line)
 {
 	TRACE_FUNCTION("glMultiDrawArraysEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MultiDrawArraysEXT(
+	TRACE_CALL(gl_MultiDrawArraysEXT)(
 		mode,first,count,primcount);
 
 	const char* result = get_last_error();
@@ -6901,7 +12940,7 @@ PFNGLMULTIDRAWELEMENTSEXTPROC gl::gl_MultiDrawElementsEXT INIT_POINTER;
 void gl::MultiDrawElementsEXT  (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei primcount, const char* file, int line)
 {
 	TRACE_FUNCTION("glMultiDrawElementsEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MultiDrawElementsEXT(
+	TRACE_CALL(gl_MultiDrawElementsEXT)(
 		mode,
 		count,
 		type,
@@ -6914,7 +12953,7 @@ PFNGLMULTIDRAWARRAYSINDIRECTEXTPROC gl::gl_MultiDrawArraysIndirectEXT INIT_POINT
 void gl::MultiDrawArraysIndirectEXT  (GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride, const char* file, int line)
 {
 	TRACE_FUNCTION("glMultiDrawArraysIndirectEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MultiDrawArraysIndirectEXT(
+	TRACE_CALL(gl_MultiDrawArraysIndirectEXT)(
 		mode,
 		indirect,
 		drawcount,
@@ -6925,7 +12964,7 @@ PFNGLMULTIDRAWELEMENTSINDIRECTEXTPROC gl::gl_MultiDrawElementsIndirectEXT INIT_P
 void gl::MultiDrawElementsIndirectEXT  (GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride, const char* file, int line)
 {
 	TRACE_FUNCTION("glMultiDrawElementsIndirectEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MultiDrawElementsIndirectEXT(
+	TRACE_CALL(gl_MultiDrawElementsIndirectEXT)(
 		mode,
 		type,
 		indirect,
@@ -6938,7 +12977,7 @@ PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEEXTPROC gl::gl_FramebufferTexture2DMultisamp
 void gl::FramebufferTexture2DMultisampleEXT  (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLsizei samples, const char* file, int line)
 {
 	TRACE_FUNCTION("glFramebufferTexture2DMultisampleEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_FramebufferTexture2DMultisampleEXT(
+	TRACE_CALL(gl_FramebufferTexture2DMultisampleEXT)(
 		target,
 		attachment,
 		textarget,
@@ -6951,12 +12990,19 @@ PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC gl::gl_RenderbufferStorageMultisample
 void gl::RenderbufferStorageMultisampleEXT  (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, const char* file, int line)
 {
 	TRACE_FUNCTION("glRenderbufferStorageMultisampleEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_RenderbufferStorageMultisampleEXT(
+	TRACE_CALL(gl_RenderbufferStorageMultisampleEXT)(
 		target,
 		samples,
 		internalformat,
 		width,
 		height);
+
+	const char* result = get_last_error();
+
+	if (!result)
+		setRenderbufferStorage(internalformat, samples, width, height);
+
+	breakOnError(!result, result);
 }
 
 // GL_EXT_multiview_draw_buffers
@@ -6964,7 +13010,7 @@ PFNGLDRAWBUFFERSINDEXEDEXTPROC gl::gl_DrawBuffersIndexedEXT INIT_POINTER;
 void gl::DrawBuffersIndexedEXT  (GLint n, const GLenum *location, const GLint *indices, const char* file, int line)
 {
 	TRACE_FUNCTION("glDrawBuffersIndexedEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DrawBuffersIndexedEXT(
+	TRACE_CALL(gl_DrawBuffersIndexedEXT)(
 		n,
 		location,
 		indices);
@@ -6974,7 +13020,7 @@ PFNGLGETINTEGERI_VEXTPROC gl::gl_GetIntegeri_vEXT INIT_POINTER;
 void gl::GetIntegeri_vEXT  (GLenum target, GLuint index, GLint *data, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetIntegeri_vEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetIntegeri_vEXT(
+	TRACE_CALL(gl_GetIntegeri_vEXT)(
 		target,
 		index,
 		data);
@@ -6984,7 +13030,7 @@ PFNGLREADBUFFERINDEXEDEXTPROC gl::gl_ReadBufferIndexedEXT INIT_POINTER;
 void gl::ReadBufferIndexedEXT  (GLenum src, GLint index, const char* file, int line)
 {
 	TRACE_FUNCTION("glReadBufferIndexedEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ReadBufferIndexedEXT(
+	TRACE_CALL(gl_ReadBufferIndexedEXT)(
 		src,
 		index);
 }
@@ -6994,7 +13040,7 @@ PFNGLPOLYGONOFFSETCLAMPEXTPROC gl::gl_PolygonOffsetClampEXT INIT_POINTER;
 void gl::PolygonOffsetClampEXT  (GLfloat factor, GLfloat units, GLfloat clamp, const char* file, int line)
 {
 	TRACE_FUNCTION("glPolygonOffsetClampEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PolygonOffsetClampEXT(
+	TRACE_CALL(gl_PolygonOffsetClampEXT)(
 		factor,
 		units,
 		clamp);
@@ -7005,7 +13051,7 @@ PFNGLPRIMITIVEBOUNDINGBOXEXTPROC gl::gl_PrimitiveBoundingBoxEXT INIT_POINTER;
 void gl::PrimitiveBoundingBoxEXT  (GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW, const char* file, int line)
 {
 	TRACE_FUNCTION("glPrimitiveBoundingBoxEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PrimitiveBoundingBoxEXT(
+	TRACE_CALL(gl_PrimitiveBoundingBoxEXT)(
 		minX,
 		minY,
 		minZ,
@@ -7021,7 +13067,7 @@ PFNGLRASTERSAMPLESEXTPROC gl::gl_RasterSamplesEXT INIT_POINTER;
 void gl::RasterSamplesEXT  (GLuint samples, GLboolean fixedsamplelocations, const char* file, int line)
 {
 	TRACE_FUNCTION("glRasterSamplesEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_RasterSamplesEXT(
+	TRACE_CALL(gl_RasterSamplesEXT)(
 		samples,
 		fixedsamplelocations);
 }
@@ -7031,7 +13077,7 @@ PFNGLGETGRAPHICSRESETSTATUSEXTPROC gl::gl_GetGraphicsResetStatusEXT INIT_POINTER
 GLenum gl::GetGraphicsResetStatusEXT  (const char* file, int line)
 {
 	TRACE_FUNCTION("glGetGraphicsResetStatusEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_GetGraphicsResetStatusEXT(
+	return TRACE_CALL(gl_GetGraphicsResetStatusEXT)(
 		);
 }
 
@@ -7039,7 +13085,7 @@ PFNGLGETNUNIFORMFVEXTPROC gl::gl_GetnUniformfvEXT INIT_POINTER;
 void gl::GetnUniformfvEXT  (GLuint program, GLint location, GLsizei bufSize, GLfloat *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetnUniformfvEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetnUniformfvEXT(
+	TRACE_CALL(gl_GetnUniformfvEXT)(
 		program,
 		location,
 		bufSize,
@@ -7050,7 +13096,7 @@ PFNGLGETNUNIFORMIVEXTPROC gl::gl_GetnUniformivEXT INIT_POINTER;
 void gl::GetnUniformivEXT  (GLuint program, GLint location, GLsizei bufSize, GLint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetnUniformivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetnUniformivEXT(
+	TRACE_CALL(gl_GetnUniformivEXT)(
 		program,
 		location,
 		bufSize,
@@ -7061,7 +13107,7 @@ PFNGLREADNPIXELSEXTPROC gl::gl_ReadnPixelsEXT INIT_POINTER;
 void gl::ReadnPixelsEXT  (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data, const char* file, int line)
 {
 	TRACE_FUNCTION("glReadnPixelsEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ReadnPixelsEXT(
+	TRACE_CALL(gl_ReadnPixelsEXT)(
 		x,
 		y,
 		width,
@@ -7077,7 +13123,7 @@ PFNGLACTIVESHADERPROGRAMEXTPROC gl::gl_ActiveShaderProgramEXT INIT_POINTER;
 void gl::ActiveShaderProgramEXT  (GLuint pipeline, GLuint program, const char* file, int line)
 {
 	TRACE_FUNCTION("glActiveShaderProgramEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ActiveShaderProgramEXT(
+	TRACE_CALL(gl_ActiveShaderProgramEXT)(
 		pipeline,
 		program);
 }
@@ -7086,7 +13132,7 @@ PFNGLBINDPROGRAMPIPELINEEXTPROC gl::gl_BindProgramPipelineEXT INIT_POINTER;
 void gl::BindProgramPipelineEXT  (GLuint pipeline, const char* file, int line)
 {
 	TRACE_FUNCTION("glBindProgramPipelineEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BindProgramPipelineEXT(
+	TRACE_CALL(gl_BindProgramPipelineEXT)(
 		pipeline);
 }
 
@@ -7094,7 +13140,7 @@ PFNGLCREATESHADERPROGRAMVEXTPROC gl::gl_CreateShaderProgramvEXT INIT_POINTER;
 GLuint gl::CreateShaderProgramvEXT  (GLenum type, GLsizei count, const GLchar **strings, const char* file, int line)
 {
 	TRACE_FUNCTION("glCreateShaderProgramvEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_CreateShaderProgramvEXT(
+	return TRACE_CALL(gl_CreateShaderProgramvEXT)(
 		type,
 		count,
 		strings);
@@ -7104,7 +13150,7 @@ PFNGLDELETEPROGRAMPIPELINESEXTPROC gl::gl_DeleteProgramPipelinesEXT INIT_POINTER
 void gl::DeleteProgramPipelinesEXT  (GLsizei n, const GLuint *pipelines, const char* file, int line)
 {
 	TRACE_FUNCTION("glDeleteProgramPipelinesEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DeleteProgramPipelinesEXT(
+	TRACE_CALL(gl_DeleteProgramPipelinesEXT)(
 		n,
 		pipelines);
 }
@@ -7113,7 +13159,7 @@ PFNGLGENPROGRAMPIPELINESEXTPROC gl::gl_GenProgramPipelinesEXT INIT_POINTER;
 void gl::GenProgramPipelinesEXT  (GLsizei n, GLuint *pipelines, const char* file, int line)
 {
 	TRACE_FUNCTION("glGenProgramPipelinesEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GenProgramPipelinesEXT(
+	TRACE_CALL(gl_GenProgramPipelinesEXT)(
 		n,
 		pipelines);
 }
@@ -7122,7 +13168,7 @@ PFNGLGETPROGRAMPIPELINEINFOLOGEXTPROC gl::gl_GetProgramPipelineInfoLogEXT INIT_P
 void gl::GetProgramPipelineInfoLogEXT  (GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetProgramPipelineInfoLogEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetProgramPipelineInfoLogEXT(
+	TRACE_CALL(gl_GetProgramPipelineInfoLogEXT)(
 		pipeline,
 		bufSize,
 		length,
@@ -7133,7 +13179,7 @@ PFNGLGETPROGRAMPIPELINEIVEXTPROC gl::gl_GetProgramPipelineivEXT INIT_POINTER;
 void gl::GetProgramPipelineivEXT  (GLuint pipeline, GLenum pname, GLint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetProgramPipelineivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetProgramPipelineivEXT(
+	TRACE_CALL(gl_GetProgramPipelineivEXT)(
 		pipeline,
 		pname,
 		params);
@@ -7143,7 +13189,7 @@ PFNGLISPROGRAMPIPELINEEXTPROC gl::gl_IsProgramPipelineEXT INIT_POINTER;
 GLboolean gl::IsProgramPipelineEXT  (GLuint pipeline, const char* file, int line)
 {
 	TRACE_FUNCTION("glIsProgramPipelineEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_IsProgramPipelineEXT(
+	return TRACE_CALL(gl_IsProgramPipelineEXT)(
 		pipeline);
 }
 
@@ -7151,7 +13197,7 @@ PFNGLPROGRAMPARAMETERIEXTPROC gl::gl_ProgramParameteriEXT INIT_POINTER;
 void gl::ProgramParameteriEXT  (GLuint program, GLenum pname, GLint value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramParameteriEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramParameteriEXT(
+	TRACE_CALL(gl_ProgramParameteriEXT)(
 		program,
 		pname,
 		value);
@@ -7161,7 +13207,7 @@ PFNGLPROGRAMUNIFORM1FEXTPROC gl::gl_ProgramUniform1fEXT INIT_POINTER;
 void gl::ProgramUniform1fEXT  (GLuint program, GLint location, GLfloat v0, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform1fEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform1fEXT(
+	TRACE_CALL(gl_ProgramUniform1fEXT)(
 		program,
 		location,
 		v0);
@@ -7171,7 +13217,7 @@ PFNGLPROGRAMUNIFORM1FVEXTPROC gl::gl_ProgramUniform1fvEXT INIT_POINTER;
 void gl::ProgramUniform1fvEXT  (GLuint program, GLint location, GLsizei count, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform1fvEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform1fvEXT(
+	TRACE_CALL(gl_ProgramUniform1fvEXT)(
 		program,
 		location,
 		count,
@@ -7182,7 +13228,7 @@ PFNGLPROGRAMUNIFORM1IEXTPROC gl::gl_ProgramUniform1iEXT INIT_POINTER;
 void gl::ProgramUniform1iEXT  (GLuint program, GLint location, GLint v0, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform1iEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform1iEXT(
+	TRACE_CALL(gl_ProgramUniform1iEXT)(
 		program,
 		location,
 		v0);
@@ -7192,7 +13238,7 @@ PFNGLPROGRAMUNIFORM1IVEXTPROC gl::gl_ProgramUniform1ivEXT INIT_POINTER;
 void gl::ProgramUniform1ivEXT  (GLuint program, GLint location, GLsizei count, const GLint *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform1ivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform1ivEXT(
+	TRACE_CALL(gl_ProgramUniform1ivEXT)(
 		program,
 		location,
 		count,
@@ -7203,7 +13249,7 @@ PFNGLPROGRAMUNIFORM1UIEXTPROC gl::gl_ProgramUniform1uiEXT INIT_POINTER;
 void gl::ProgramUniform1uiEXT  (GLuint program, GLint location, GLuint v0, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform1uiEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform1uiEXT(
+	TRACE_CALL(gl_ProgramUniform1uiEXT)(
 		program,
 		location,
 		v0);
@@ -7213,7 +13259,7 @@ PFNGLPROGRAMUNIFORM1UIVEXTPROC gl::gl_ProgramUniform1uivEXT INIT_POINTER;
 void gl::ProgramUniform1uivEXT  (GLuint program, GLint location, GLsizei count, const GLuint *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform1uivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform1uivEXT(
+	TRACE_CALL(gl_ProgramUniform1uivEXT)(
 		program,
 		location,
 		count,
@@ -7224,7 +13270,7 @@ PFNGLPROGRAMUNIFORM2FEXTPROC gl::gl_ProgramUniform2fEXT INIT_POINTER;
 void gl::ProgramUniform2fEXT  (GLuint program, GLint location, GLfloat v0, GLfloat v1, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform2fEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform2fEXT(
+	TRACE_CALL(gl_ProgramUniform2fEXT)(
 		program,
 		location,
 		v0,
@@ -7235,7 +13281,7 @@ PFNGLPROGRAMUNIFORM2FVEXTPROC gl::gl_ProgramUniform2fvEXT INIT_POINTER;
 void gl::ProgramUniform2fvEXT  (GLuint program, GLint location, GLsizei count, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform2fvEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform2fvEXT(
+	TRACE_CALL(gl_ProgramUniform2fvEXT)(
 		program,
 		location,
 		count,
@@ -7246,7 +13292,7 @@ PFNGLPROGRAMUNIFORM2IEXTPROC gl::gl_ProgramUniform2iEXT INIT_POINTER;
 void gl::ProgramUniform2iEXT  (GLuint program, GLint location, GLint v0, GLint v1, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform2iEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform2iEXT(
+	TRACE_CALL(gl_ProgramUniform2iEXT)(
 		program,
 		location,
 		v0,
@@ -7257,7 +13303,7 @@ PFNGLPROGRAMUNIFORM2IVEXTPROC gl::gl_ProgramUniform2ivEXT INIT_POINTER;
 void gl::ProgramUniform2ivEXT  (GLuint program, GLint location, GLsizei count, const GLint *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform2ivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform2ivEXT(
+	TRACE_CALL(gl_ProgramUniform2ivEXT)(
 		program,
 		location,
 		count,
@@ -7268,7 +13314,7 @@ PFNGLPROGRAMUNIFORM2UIEXTPROC gl::gl_ProgramUniform2uiEXT INIT_POINTER;
 void gl::ProgramUniform2uiEXT  (GLuint program, GLint location, GLuint v0, GLuint v1, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform2uiEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform2uiEXT(
+	TRACE_CALL(gl_ProgramUniform2uiEXT)(
 		program,
 		location,
 		v0,
@@ -7279,7 +13325,7 @@ PFNGLPROGRAMUNIFORM2UIVEXTPROC gl::gl_ProgramUniform2uivEXT INIT_POINTER;
 void gl::ProgramUniform2uivEXT  (GLuint program, GLint location, GLsizei count, const GLuint *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform2uivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform2uivEXT(
+	TRACE_CALL(gl_ProgramUniform2uivEXT)(
 		program,
 		location,
 		count,
@@ -7290,7 +13336,7 @@ PFNGLPROGRAMUNIFORM3FEXTPROC gl::gl_ProgramUniform3fEXT INIT_POINTER;
 void gl::ProgramUniform3fEXT  (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform3fEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform3fEXT(
+	TRACE_CALL(gl_ProgramUniform3fEXT)(
 		program,
 		location,
 		v0,
@@ -7302,7 +13348,7 @@ PFNGLPROGRAMUNIFORM3FVEXTPROC gl::gl_ProgramUniform3fvEXT INIT_POINTER;
 void gl::ProgramUniform3fvEXT  (GLuint program, GLint location, GLsizei count, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform3fvEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform3fvEXT(
+	TRACE_CALL(gl_ProgramUniform3fvEXT)(
 		program,
 		location,
 		count,
@@ -7313,7 +13359,7 @@ PFNGLPROGRAMUNIFORM3IEXTPROC gl::gl_ProgramUniform3iEXT INIT_POINTER;
 void gl::ProgramUniform3iEXT  (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform3iEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform3iEXT(
+	TRACE_CALL(gl_ProgramUniform3iEXT)(
 		program,
 		location,
 		v0,
@@ -7325,7 +13371,7 @@ PFNGLPROGRAMUNIFORM3IVEXTPROC gl::gl_ProgramUniform3ivEXT INIT_POINTER;
 void gl::ProgramUniform3ivEXT  (GLuint program, GLint location, GLsizei count, const GLint *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform3ivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform3ivEXT(
+	TRACE_CALL(gl_ProgramUniform3ivEXT)(
 		program,
 		location,
 		count,
@@ -7336,7 +13382,7 @@ PFNGLPROGRAMUNIFORM3UIEXTPROC gl::gl_ProgramUniform3uiEXT INIT_POINTER;
 void gl::ProgramUniform3uiEXT  (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform3uiEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform3uiEXT(
+	TRACE_CALL(gl_ProgramUniform3uiEXT)(
 		program,
 		location,
 		v0,
@@ -7348,7 +13394,7 @@ PFNGLPROGRAMUNIFORM3UIVEXTPROC gl::gl_ProgramUniform3uivEXT INIT_POINTER;
 void gl::ProgramUniform3uivEXT  (GLuint program, GLint location, GLsizei count, const GLuint *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform3uivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform3uivEXT(
+	TRACE_CALL(gl_ProgramUniform3uivEXT)(
 		program,
 		location,
 		count,
@@ -7359,7 +13405,7 @@ PFNGLPROGRAMUNIFORM4FEXTPROC gl::gl_ProgramUniform4fEXT INIT_POINTER;
 void gl::ProgramUniform4fEXT  (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform4fEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform4fEXT(
+	TRACE_CALL(gl_ProgramUniform4fEXT)(
 		program,
 		location,
 		v0,
@@ -7372,7 +13418,7 @@ PFNGLPROGRAMUNIFORM4FVEXTPROC gl::gl_ProgramUniform4fvEXT INIT_POINTER;
 void gl::ProgramUniform4fvEXT  (GLuint program, GLint location, GLsizei count, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform4fvEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform4fvEXT(
+	TRACE_CALL(gl_ProgramUniform4fvEXT)(
 		program,
 		location,
 		count,
@@ -7383,7 +13429,7 @@ PFNGLPROGRAMUNIFORM4IEXTPROC gl::gl_ProgramUniform4iEXT INIT_POINTER;
 void gl::ProgramUniform4iEXT  (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform4iEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform4iEXT(
+	TRACE_CALL(gl_ProgramUniform4iEXT)(
 		program,
 		location,
 		v0,
@@ -7396,7 +13442,7 @@ PFNGLPROGRAMUNIFORM4IVEXTPROC gl::gl_ProgramUniform4ivEXT INIT_POINTER;
 void gl::ProgramUniform4ivEXT  (GLuint program, GLint location, GLsizei count, const GLint *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform4ivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform4ivEXT(
+	TRACE_CALL(gl_ProgramUniform4ivEXT)(
 		program,
 		location,
 		count,
@@ -7407,7 +13453,7 @@ PFNGLPROGRAMUNIFORM4UIEXTPROC gl::gl_ProgramUniform4uiEXT INIT_POINTER;
 void gl::ProgramUniform4uiEXT  (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform4uiEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform4uiEXT(
+	TRACE_CALL(gl_ProgramUniform4uiEXT)(
 		program,
 		location,
 		v0,
@@ -7420,7 +13466,7 @@ PFNGLPROGRAMUNIFORM4UIVEXTPROC gl::gl_ProgramUniform4uivEXT INIT_POINTER;
 void gl::ProgramUniform4uivEXT  (GLuint program, GLint location, GLsizei count, const GLuint *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniform4uivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniform4uivEXT(
+	TRACE_CALL(gl_ProgramUniform4uivEXT)(
 		program,
 		location,
 		count,
@@ -7431,7 +13477,7 @@ PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC gl::gl_ProgramUniformMatrix2fvEXT INIT_POINT
 void gl::ProgramUniformMatrix2fvEXT  (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniformMatrix2fvEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniformMatrix2fvEXT(
+	TRACE_CALL(gl_ProgramUniformMatrix2fvEXT)(
 		program,
 		location,
 		count,
@@ -7443,7 +13489,7 @@ PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC gl::gl_ProgramUniformMatrix2x3fvEXT INIT_P
 void gl::ProgramUniformMatrix2x3fvEXT  (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniformMatrix2x3fvEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniformMatrix2x3fvEXT(
+	TRACE_CALL(gl_ProgramUniformMatrix2x3fvEXT)(
 		program,
 		location,
 		count,
@@ -7455,7 +13501,7 @@ PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC gl::gl_ProgramUniformMatrix2x4fvEXT INIT_P
 void gl::ProgramUniformMatrix2x4fvEXT  (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniformMatrix2x4fvEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniformMatrix2x4fvEXT(
+	TRACE_CALL(gl_ProgramUniformMatrix2x4fvEXT)(
 		program,
 		location,
 		count,
@@ -7467,7 +13513,7 @@ PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC gl::gl_ProgramUniformMatrix3fvEXT INIT_POINT
 void gl::ProgramUniformMatrix3fvEXT  (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniformMatrix3fvEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniformMatrix3fvEXT(
+	TRACE_CALL(gl_ProgramUniformMatrix3fvEXT)(
 		program,
 		location,
 		count,
@@ -7479,7 +13525,7 @@ PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC gl::gl_ProgramUniformMatrix3x2fvEXT INIT_P
 void gl::ProgramUniformMatrix3x2fvEXT  (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniformMatrix3x2fvEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniformMatrix3x2fvEXT(
+	TRACE_CALL(gl_ProgramUniformMatrix3x2fvEXT)(
 		program,
 		location,
 		count,
@@ -7491,7 +13537,7 @@ PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC gl::gl_ProgramUniformMatrix3x4fvEXT INIT_P
 void gl::ProgramUniformMatrix3x4fvEXT  (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniformMatrix3x4fvEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniformMatrix3x4fvEXT(
+	TRACE_CALL(gl_ProgramUniformMatrix3x4fvEXT)(
 		program,
 		location,
 		count,
@@ -7503,7 +13549,7 @@ PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC gl::gl_ProgramUniformMatrix4fvEXT INIT_POINT
 void gl::ProgramUniformMatrix4fvEXT  (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniformMatrix4fvEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniformMatrix4fvEXT(
+	TRACE_CALL(gl_ProgramUniformMatrix4fvEXT)(
 		program,
 		location,
 		count,
@@ -7515,7 +13561,7 @@ PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC gl::gl_ProgramUniformMatrix4x2fvEXT INIT_P
 void gl::ProgramUniformMatrix4x2fvEXT  (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniformMatrix4x2fvEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniformMatrix4x2fvEXT(
+	TRACE_CALL(gl_ProgramUniformMatrix4x2fvEXT)(
 		program,
 		location,
 		count,
@@ -7527,7 +13573,7 @@ PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC gl::gl_ProgramUniformMatrix4x3fvEXT INIT_P
 void gl::ProgramUniformMatrix4x3fvEXT  (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniformMatrix4x3fvEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniformMatrix4x3fvEXT(
+	TRACE_CALL(gl_ProgramUniformMatrix4x3fvEXT)(
 		program,
 		location,
 		count,
@@ -7539,7 +13585,7 @@ PFNGLUSEPROGRAMSTAGESEXTPROC gl::gl_UseProgramStagesEXT INIT_POINTER;
 void gl::UseProgramStagesEXT  (GLuint pipeline, GLbitfield stages, GLuint program, const char* file, int line)
 {
 	TRACE_FUNCTION("glUseProgramStagesEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_UseProgramStagesEXT(
+	TRACE_CALL(gl_UseProgramStagesEXT)(
 		pipeline,
 		stages,
 		program);
@@ -7549,7 +13595,7 @@ PFNGLVALIDATEPROGRAMPIPELINEEXTPROC gl::gl_ValidateProgramPipelineEXT INIT_POINT
 void gl::ValidateProgramPipelineEXT  (GLuint pipeline, const char* file, int line)
 {
 	TRACE_FUNCTION("glValidateProgramPipelineEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ValidateProgramPipelineEXT(
+	TRACE_CALL(gl_ValidateProgramPipelineEXT)(
 		pipeline);
 }
 
@@ -7558,7 +13604,7 @@ PFNGLCLEARPIXELLOCALSTORAGEUIEXTPROC gl::gl_ClearPixelLocalStorageuiEXT INIT_POI
 void gl::ClearPixelLocalStorageuiEXT  (GLsizei offset, GLsizei n, const GLuint *values, const char* file, int line)
 {
 	TRACE_FUNCTION("glClearPixelLocalStorageuiEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ClearPixelLocalStorageuiEXT(
+	TRACE_CALL(gl_ClearPixelLocalStorageuiEXT)(
 		offset,
 		n,
 		values);
@@ -7568,7 +13614,7 @@ PFNGLFRAMEBUFFERPIXELLOCALSTORAGESIZEEXTPROC gl::gl_FramebufferPixelLocalStorage
 void gl::FramebufferPixelLocalStorageSizeEXT  (GLuint target, GLsizei size, const char* file, int line)
 {
 	TRACE_FUNCTION("glFramebufferPixelLocalStorageSizeEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_FramebufferPixelLocalStorageSizeEXT(
+	TRACE_CALL(gl_FramebufferPixelLocalStorageSizeEXT)(
 		target,
 		size);
 }
@@ -7577,7 +13623,7 @@ PFNGLGETFRAMEBUFFERPIXELLOCALSTORAGESIZEEXTPROC gl::gl_GetFramebufferPixelLocalS
 GLsizei gl::GetFramebufferPixelLocalStorageSizeEXT  (GLuint target, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetFramebufferPixelLocalStorageSizeEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_GetFramebufferPixelLocalStorageSizeEXT(
+	return TRACE_CALL(gl_GetFramebufferPixelLocalStorageSizeEXT)(
 		target);
 }
 
@@ -7586,7 +13632,7 @@ PFNGLTEXPAGECOMMITMENTEXTPROC gl::gl_TexPageCommitmentEXT INIT_POINTER;
 void gl::TexPageCommitmentEXT  (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit, const char* file, int line)
 {
 	TRACE_FUNCTION("glTexPageCommitmentEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TexPageCommitmentEXT(
+	TRACE_CALL(gl_TexPageCommitmentEXT)(
 		target,
 		level,
 		xoffset,
@@ -7603,7 +13649,7 @@ PFNGLPATCHPARAMETERIEXTPROC gl::gl_PatchParameteriEXT INIT_POINTER;
 void gl::PatchParameteriEXT  (GLenum pname, GLint value, const char* file, int line)
 {
 	TRACE_FUNCTION("glPatchParameteriEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PatchParameteriEXT(
+	TRACE_CALL(gl_PatchParameteriEXT)(
 		pname,
 		value);
 }
@@ -7613,7 +13659,7 @@ PFNGLGETSAMPLERPARAMETERIIVEXTPROC gl::gl_GetSamplerParameterIivEXT INIT_POINTER
 void gl::GetSamplerParameterIivEXT  (GLuint sampler, GLenum pname, GLint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetSamplerParameterIivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetSamplerParameterIivEXT(
+	TRACE_CALL(gl_GetSamplerParameterIivEXT)(
 		sampler,
 		pname,
 		params);
@@ -7623,7 +13669,7 @@ PFNGLGETSAMPLERPARAMETERIUIVEXTPROC gl::gl_GetSamplerParameterIuivEXT INIT_POINT
 void gl::GetSamplerParameterIuivEXT  (GLuint sampler, GLenum pname, GLuint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetSamplerParameterIuivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetSamplerParameterIuivEXT(
+	TRACE_CALL(gl_GetSamplerParameterIuivEXT)(
 		sampler,
 		pname,
 		params);
@@ -7633,7 +13679,7 @@ PFNGLGETTEXPARAMETERIIVEXTPROC gl::gl_GetTexParameterIivEXT INIT_POINTER;
 void gl::GetTexParameterIivEXT  (GLenum target, GLenum pname, GLint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetTexParameterIivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetTexParameterIivEXT(
+	TRACE_CALL(gl_GetTexParameterIivEXT)(
 		target,
 		pname,
 		params);
@@ -7643,7 +13689,7 @@ PFNGLGETTEXPARAMETERIUIVEXTPROC gl::gl_GetTexParameterIuivEXT INIT_POINTER;
 void gl::GetTexParameterIuivEXT  (GLenum target, GLenum pname, GLuint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetTexParameterIuivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetTexParameterIuivEXT(
+	TRACE_CALL(gl_GetTexParameterIuivEXT)(
 		target,
 		pname,
 		params);
@@ -7653,7 +13699,7 @@ PFNGLSAMPLERPARAMETERIIVEXTPROC gl::gl_SamplerParameterIivEXT INIT_POINTER;
 void gl::SamplerParameterIivEXT  (GLuint sampler, GLenum pname, const GLint *param, const char* file, int line)
 {
 	TRACE_FUNCTION("glSamplerParameterIivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_SamplerParameterIivEXT(
+	TRACE_CALL(gl_SamplerParameterIivEXT)(
 		sampler,
 		pname,
 		param);
@@ -7663,7 +13709,7 @@ PFNGLSAMPLERPARAMETERIUIVEXTPROC gl::gl_SamplerParameterIuivEXT INIT_POINTER;
 void gl::SamplerParameterIuivEXT  (GLuint sampler, GLenum pname, const GLuint *param, const char* file, int line)
 {
 	TRACE_FUNCTION("glSamplerParameterIuivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_SamplerParameterIuivEXT(
+	TRACE_CALL(gl_SamplerParameterIuivEXT)(
 		sampler,
 		pname,
 		param);
@@ -7673,7 +13719,7 @@ PFNGLTEXPARAMETERIIVEXTPROC gl::gl_TexParameterIivEXT INIT_POINTER;
 void gl::TexParameterIivEXT  (GLenum target, GLenum pname, const GLint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glTexParameterIivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TexParameterIivEXT(
+	TRACE_CALL(gl_TexParameterIivEXT)(
 		target,
 		pname,
 		params);
@@ -7683,7 +13729,7 @@ PFNGLTEXPARAMETERIUIVEXTPROC gl::gl_TexParameterIuivEXT INIT_POINTER;
 void gl::TexParameterIuivEXT  (GLenum target, GLenum pname, const GLuint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glTexParameterIuivEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TexParameterIuivEXT(
+	TRACE_CALL(gl_TexParameterIuivEXT)(
 		target,
 		pname,
 		params);
@@ -7694,7 +13740,7 @@ PFNGLTEXBUFFEREXTPROC gl::gl_TexBufferEXT INIT_POINTER;
 void gl::TexBufferEXT  (GLenum target, GLenum internalformat, GLuint buffer, const char* file, int line)
 {
 	TRACE_FUNCTION("glTexBufferEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TexBufferEXT(
+	TRACE_CALL(gl_TexBufferEXT)(
 		target,
 		internalformat,
 		buffer);
@@ -7704,7 +13750,7 @@ PFNGLTEXBUFFERRANGEEXTPROC gl::gl_TexBufferRangeEXT INIT_POINTER;
 void gl::TexBufferRangeEXT  (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size, const char* file, int line)
 {
 	TRACE_FUNCTION("glTexBufferRangeEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TexBufferRangeEXT(
+	TRACE_CALL(gl_TexBufferRangeEXT)(
 		target,
 		internalformat,
 		buffer,
@@ -7717,7 +13763,7 @@ PFNGLTEXSTORAGE1DEXTPROC gl::gl_TexStorage1DEXT INIT_POINTER;
 void gl::TexStorage1DEXT  (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, const char* file, int line)
 {
 	TRACE_FUNCTION("glTexStorage1DEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TexStorage1DEXT(
+	TRACE_CALL(gl_TexStorage1DEXT)(
 		target,
 		levels,
 		internalformat,
@@ -7728,32 +13774,46 @@ PFNGLTEXSTORAGE2DEXTPROC gl::gl_TexStorage2DEXT INIT_POINTER;
 void gl::TexStorage2DEXT  (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, const char* file, int line)
 {
 	TRACE_FUNCTION("glTexStorage2DEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TexStorage2DEXT(
+	TRACE_CALL(gl_TexStorage2DEXT)(
 		target,
 		levels,
 		internalformat,
 		width,
 		height);
+
+	const char* result = get_last_error();
+
+	if (!result)
+		setTextureStorage(target, levels, internalformat, width, height, 1);
+
+	breakOnError(!result, result);
 }
 
 PFNGLTEXSTORAGE3DEXTPROC gl::gl_TexStorage3DEXT INIT_POINTER;
 void gl::TexStorage3DEXT  (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, const char* file, int line)
 {
 	TRACE_FUNCTION("glTexStorage3DEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TexStorage3DEXT(
+	TRACE_CALL(gl_TexStorage3DEXT)(
 		target,
 		levels,
 		internalformat,
 		width,
 		height,
 		depth);
+
+	const char* result = get_last_error();
+
+	if (!result)
+		setTextureStorage(target, levels, internalformat, width, height, depth);
+
+	breakOnError(!result, result);
 }
 
 PFNGLTEXTURESTORAGE1DEXTPROC gl::gl_TextureStorage1DEXT INIT_POINTER;
 void gl::TextureStorage1DEXT  (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, const char* file, int line)
 {
 	TRACE_FUNCTION("glTextureStorage1DEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TextureStorage1DEXT(
+	TRACE_CALL(gl_TextureStorage1DEXT)(
 		texture,
 		target,
 		levels,
@@ -7765,7 +13825,7 @@ PFNGLTEXTURESTORAGE2DEXTPROC gl::gl_TextureStorage2DEXT INIT_POINTER;
 void gl::TextureStorage2DEXT  (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, const char* file, int line)
 {
 	TRACE_FUNCTION("glTextureStorage2DEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TextureStorage2DEXT(
+	TRACE_CALL(gl_TextureStorage2DEXT)(
 		texture,
 		target,
 		levels,
@@ -7778,7 +13838,7 @@ PFNGLTEXTURESTORAGE3DEXTPROC gl::gl_TextureStorage3DEXT INIT_POINTER;
 void gl::TextureStorage3DEXT  (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, const char* file, int line)
 {
 	TRACE_FUNCTION("glTextureStorage3DEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TextureStorage3DEXT(
+	TRACE_CALL(gl_TextureStorage3DEXT)(
 		texture,
 		target,
 		levels,
@@ -7793,7 +13853,7 @@ PFNGLTEXTUREVIEWEXTPROC gl::gl_TextureViewEXT INIT_POINTER;
 void gl::TextureViewEXT  (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers, const char* file, int line)
 {
 	TRACE_FUNCTION("glTextureViewEXT(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TextureViewEXT(
+	TRACE_CALL(gl_TextureViewEXT)(
 		texture,
 		target,
 		origtexture,
@@ -7809,7 +13869,7 @@ PFNGLFRAMEBUFFERTEXTURE2DDOWNSAMPLEIMGPROC gl::gl_FramebufferTexture2DDownsample
 void gl::FramebufferTexture2DDownsampleIMG  (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint xscale, GLint yscale, const char* file, int line)
 {
 	TRACE_FUNCTION("glFramebufferTexture2DDownsampleIMG(...) called from " << get_path(file) << '(' << line << ')');
-	gl_FramebufferTexture2DDownsampleIMG(
+	TRACE_CALL(gl_FramebufferTexture2DDownsampleIMG)(
 		target,
 		attachment,
 		textarget,
@@ -7823,7 +13883,7 @@ PFNGLFRAMEBUFFERTEXTURELAYERDOWNSAMPLEIMGPROC gl::gl_FramebufferTextureLayerDown
 void gl::FramebufferTextureLayerDownsampleIMG  (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer, GLint xscale, GLint yscale, const char* file, int line)
 {
 	TRACE_FUNCTION("glFramebufferTextureLayerDownsampleIMG(...) called from " << get_path(file) << '(' << line << ')');
-	gl_FramebufferTextureLayerDownsampleIMG(
+	TRACE_CALL(gl_FramebufferTextureLayerDownsampleIMG)(
 		target,
 		attachment,
 		texture,
@@ -7838,7 +13898,7 @@ PFNGLFRAMEBUFFERTEXTURE2DMULTISAMPLEIMGPROC gl::gl_FramebufferTexture2DMultisamp
 void gl::FramebufferTexture2DMultisampleIMG  (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLsizei samples, const char* file, int line)
 {
 	TRACE_FUNCTION("glFramebufferTexture2DMultisampleIMG(...) called from " << get_path(file) << '(' << line << ')');
-	gl_FramebufferTexture2DMultisampleIMG(
+	TRACE_CALL(gl_FramebufferTexture2DMultisampleIMG)(
 		target,
 		attachment,
 		textarget,
@@ -7851,12 +13911,19 @@ PFNGLRENDERBUFFERSTORAGEMULTISAMPLEIMGPROC gl::gl_RenderbufferStorageMultisample
 void gl::RenderbufferStorageMultisampleIMG  (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, const char* file, int line)
 {
 	TRACE_FUNCTION("glRenderbufferStorageMultisampleIMG(...) called from " << get_path(file) << '(' << line << ')');
-	gl_RenderbufferStorageMultisampleIMG(
+	TRACE_CALL(gl_RenderbufferStorageMultisampleIMG)(
 		target,
 		samples,
 		internalformat,
 		width,
 		height);
+
+	const char* result = get_last_error();
+
+	if (!result)
+		setRenderbufferStorage(internalformat, samples, width, height);
+
+	breakOnError(!result, result);
 }
 
 // GL_INTEL_framebuffer_CMAA
@@ -7864,7 +13931,7 @@ PFNGLAPPLYFRAMEBUFFERATTACHMENTCMAAINTELPROC gl::gl_ApplyFramebufferAttachmentCM
 void gl::ApplyFramebufferAttachmentCMAAINTEL  (const char* file, int line)
 {
 	TRACE_FUNCTION("glApplyFramebufferAttachmentCMAAINTEL(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ApplyFramebufferAttachmentCMAAINTEL(
+	TRACE_CALL(gl_ApplyFramebufferAttachmentCMAAINTEL)(
 		);
 }
 
@@ -7873,7 +13940,7 @@ PFNGLBEGINPERFQUERYINTELPROC gl::gl_BeginPerfQueryINTEL INIT_POINTER;
 void gl::BeginPerfQueryINTEL  (GLuint queryHandle, const char* file, int line)
 {
 	TRACE_FUNCTION("glBeginPerfQueryINTEL(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BeginPerfQueryINTEL(
+	TRACE_CALL(gl_BeginPerfQueryINTEL)(
 		queryHandle);
 }
 
@@ -7881,7 +13948,7 @@ PFNGLCREATEPERFQUERYINTELPROC gl::gl_CreatePerfQueryINTEL INIT_POINTER;
 void gl::CreatePerfQueryINTEL  (GLuint queryId, GLuint *queryHandle, const char* file, int line)
 {
 	TRACE_FUNCTION("glCreatePerfQueryINTEL(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CreatePerfQueryINTEL(
+	TRACE_CALL(gl_CreatePerfQueryINTEL)(
 		queryId,
 		queryHandle);
 }
@@ -7890,7 +13957,7 @@ PFNGLDELETEPERFQUERYINTELPROC gl::gl_DeletePerfQueryINTEL INIT_POINTER;
 void gl::DeletePerfQueryINTEL  (GLuint queryHandle, const char* file, int line)
 {
 	TRACE_FUNCTION("glDeletePerfQueryINTEL(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DeletePerfQueryINTEL(
+	TRACE_CALL(gl_DeletePerfQueryINTEL)(
 		queryHandle);
 }
 
@@ -7898,7 +13965,7 @@ PFNGLENDPERFQUERYINTELPROC gl::gl_EndPerfQueryINTEL INIT_POINTER;
 void gl::EndPerfQueryINTEL  (GLuint queryHandle, const char* file, int line)
 {
 	TRACE_FUNCTION("glEndPerfQueryINTEL(...) called from " << get_path(file) << '(' << line << ')');
-	gl_EndPerfQueryINTEL(
+	TRACE_CALL(gl_EndPerfQueryINTEL)(
 		queryHandle);
 }
 
@@ -7906,7 +13973,7 @@ PFNGLGETFIRSTPERFQUERYIDINTELPROC gl::gl_GetFirstPerfQueryIdINTEL INIT_POINTER;
 void gl::GetFirstPerfQueryIdINTEL  (GLuint *queryId, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetFirstPerfQueryIdINTEL(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetFirstPerfQueryIdINTEL(
+	TRACE_CALL(gl_GetFirstPerfQueryIdINTEL)(
 		queryId);
 }
 
@@ -7914,7 +13981,7 @@ PFNGLGETNEXTPERFQUERYIDINTELPROC gl::gl_GetNextPerfQueryIdINTEL INIT_POINTER;
 void gl::GetNextPerfQueryIdINTEL  (GLuint queryId, GLuint *nextQueryId, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetNextPerfQueryIdINTEL(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetNextPerfQueryIdINTEL(
+	TRACE_CALL(gl_GetNextPerfQueryIdINTEL)(
 		queryId,
 		nextQueryId);
 }
@@ -7923,7 +13990,7 @@ PFNGLGETPERFCOUNTERINFOINTELPROC gl::gl_GetPerfCounterInfoINTEL INIT_POINTER;
 void gl::GetPerfCounterInfoINTEL  (GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar *counterName, GLuint counterDescLength, GLchar *counterDesc, GLuint *counterOffset, GLuint *counterDataSize, GLuint *counterTypeEnum, GLuint *counterDataTypeEnum, GLuint64 *rawCounterMaxValue, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPerfCounterInfoINTEL(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPerfCounterInfoINTEL(
+	TRACE_CALL(gl_GetPerfCounterInfoINTEL)(
 		queryId,
 		counterId,
 		counterNameLength,
@@ -7941,7 +14008,7 @@ PFNGLGETPERFQUERYDATAINTELPROC gl::gl_GetPerfQueryDataINTEL INIT_POINTER;
 void gl::GetPerfQueryDataINTEL  (GLuint queryHandle, GLuint flags, GLsizei dataSize, GLvoid *data, GLuint *bytesWritten, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPerfQueryDataINTEL(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPerfQueryDataINTEL(
+	TRACE_CALL(gl_GetPerfQueryDataINTEL)(
 		queryHandle,
 		flags,
 		dataSize,
@@ -7953,7 +14020,7 @@ PFNGLGETPERFQUERYIDBYNAMEINTELPROC gl::gl_GetPerfQueryIdByNameINTEL INIT_POINTER
 void gl::GetPerfQueryIdByNameINTEL  (GLchar *queryName, GLuint *queryId, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPerfQueryIdByNameINTEL(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPerfQueryIdByNameINTEL(
+	TRACE_CALL(gl_GetPerfQueryIdByNameINTEL)(
 		queryName,
 		queryId);
 }
@@ -7962,7 +14029,7 @@ PFNGLGETPERFQUERYINFOINTELPROC gl::gl_GetPerfQueryInfoINTEL INIT_POINTER;
 void gl::GetPerfQueryInfoINTEL  (GLuint queryId, GLuint queryNameLength, GLchar *queryName, GLuint *dataSize, GLuint *noCounters, GLuint *noInstances, GLuint *capsMask, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPerfQueryInfoINTEL(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPerfQueryInfoINTEL(
+	TRACE_CALL(gl_GetPerfQueryInfoINTEL)(
 		queryId,
 		queryNameLength,
 		queryName,
@@ -7977,7 +14044,7 @@ PFNGLBLENDBARRIERKHRPROC gl::gl_BlendBarrierKHR INIT_POINTER;
 void gl::BlendBarrierKHR  (const char* file, int line)
 {
 	TRACE_FUNCTION("glBlendBarrierKHR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BlendBarrierKHR(
+	TRACE_CALL(gl_BlendBarrierKHR)(
 		);
 }
 
@@ -7986,7 +14053,11 @@ PFNGLDEBUGMESSAGECONTROLKHRPROC gl::gl_DebugMessageControlKHR INIT_POINTER;
 void gl::DebugMessageControlKHR  (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled, const char* file, int line)
 {
 	TRACE_FUNCTION("glDebugMessageControlKHR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DebugMessageControlKHR(
+	/** error messages muted : back to glGetError */
+	if (!enabled && (type == GL_DEBUG_TYPE_ERROR_KHR || type == GL_DONT_CARE))
+		_debug_errors = false;
+
+	TRACE_CALL(gl_DebugMessageControlKHR)(
 		source,
 		type,
 		severity,
@@ -7999,7 +14070,7 @@ PFNGLDEBUGMESSAGEINSERTKHRPROC gl::gl_DebugMessageInsertKHR INIT_POINTER;
 void gl::DebugMessageInsertKHR  (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf, const char* file, int line)
 {
 	TRACE_FUNCTION("glDebugMessageInsertKHR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DebugMessageInsertKHR(
+	TRACE_CALL(gl_DebugMessageInsertKHR)(
 		source,
 		type,
 		id,
@@ -8012,14 +14083,19 @@ PFNGLDEBUGMESSAGECALLBACKKHRPROC gl::gl_DebugMessageCallbackKHR INIT_POINTER;
 void gl::DebugMessageCallbackKHR(GLDEBUGPROCKHR callback, const void *userParam, const char* file, int line)
 {
 	TRACE_FUNCTION("glDebugMessageCallbackKHR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DebugMessageCallbackKHR(callback, userParam);
+	_app_debug_callback = callback;
+	_app_debug_param = userParam;
+
+	/** the debugger callback forwards the messages */
+	if (!_debug_output)
+		TRACE_CALL(gl_DebugMessageCallbackKHR)(callback, userParam);
 }
 
 PFNGLGETDEBUGMESSAGELOGKHRPROC gl::gl_GetDebugMessageLogKHR INIT_POINTER;
 GLuint gl::GetDebugMessageLogKHR  (GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetDebugMessageLogKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_GetDebugMessageLogKHR(
+	return TRACE_CALL(gl_GetDebugMessageLogKHR)(
 		count,
 		bufSize,
 		sources,
@@ -8034,7 +14110,7 @@ PFNGLGETOBJECTLABELKHRPROC gl::gl_GetObjectLabelKHR INIT_POINTER;
 void gl::GetObjectLabelKHR  (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetObjectLabelKHR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetObjectLabelKHR(
+	TRACE_CALL(gl_GetObjectLabelKHR)(
 		identifier,
 		name,
 		bufSize,
@@ -8046,7 +14122,7 @@ PFNGLGETOBJECTPTRLABELKHRPROC gl::gl_GetObjectPtrLabelKHR INIT_POINTER;
 void gl::GetObjectPtrLabelKHR  (const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetObjectPtrLabelKHR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetObjectPtrLabelKHR(
+	TRACE_CALL(gl_GetObjectPtrLabelKHR)(
 		ptr,
 		bufSize,
 		length,
@@ -8057,7 +14133,7 @@ PFNGLGETPOINTERVKHRPROC gl::gl_GetPointervKHR INIT_POINTER;
 void gl::GetPointervKHR  (GLenum pname, void **params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPointervKHR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPointervKHR(
+	TRACE_CALL(gl_GetPointervKHR)(
 		pname,
 		params);
 }
@@ -8066,7 +14142,7 @@ PFNGLOBJECTLABELKHRPROC gl::gl_ObjectLabelKHR INIT_POINTER;
 void gl::ObjectLabelKHR  (GLenum identifier, GLuint name, GLsizei length, const GLchar *label, const char* file, int line)
 {
 	TRACE_FUNCTION("glObjectLabelKHR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ObjectLabelKHR(
+	TRACE_CALL(gl_ObjectLabelKHR)(
 		identifier,
 		name,
 		length,
@@ -8077,7 +14153,7 @@ PFNGLOBJECTPTRLABELKHRPROC gl::gl_ObjectPtrLabelKHR INIT_POINTER;
 void gl::ObjectPtrLabelKHR  (const void *ptr, GLsizei length, const GLchar *label, const char* file, int line)
 {
 	TRACE_FUNCTION("glObjectPtrLabelKHR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ObjectPtrLabelKHR(
+	TRACE_CALL(gl_ObjectPtrLabelKHR)(
 		ptr,
 		length,
 		label);
@@ -8087,7 +14163,9 @@ PFNGLPOPDEBUGGROUPKHRPROC gl::gl_PopDebugGroupKHR INIT_POINTER;
 void gl::PopDebugGroupKHR  (const char* file, int line)
 {
 	TRACE_FUNCTION("glPopDebugGroupKHR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PopDebugGroupKHR(
+	popGpuGroup();
+	popZone();
+	TRACE_CALL(gl_PopDebugGroupKHR)(
 		);
 }
 
@@ -8095,11 +14173,13 @@ PFNGLPUSHDEBUGGROUPKHRPROC gl::gl_PushDebugGroupKHR INIT_POINTER;
 void gl::PushDebugGroupKHR  (GLenum source, GLuint id, GLsizei length, const GLchar *message, const char* file, int line)
 {
 	TRACE_FUNCTION("glPushDebugGroupKHR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PushDebugGroupKHR(
+	TRACE_CALL(gl_PushDebugGroupKHR)(
 		source,
 		id,
 		length,
 		message);
+	pushGpuGroup(length, message);
+	pushZone(length, message, false);
 }
 
 // GL_KHR_robustness
@@ -8107,7 +14187,7 @@ PFNGLGETGRAPHICSRESETSTATUSKHRPROC gl::gl_GetGraphicsResetStatusKHR INIT_POINTER
 GLenum gl::GetGraphicsResetStatusKHR  (const char* file, int line)
 {
 	TRACE_FUNCTION("glGetGraphicsResetStatusKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_GetGraphicsResetStatusKHR(
+	return TRACE_CALL(gl_GetGraphicsResetStatusKHR)(
 		);
 }
 
@@ -8115,7 +14195,7 @@ PFNGLGETNUNIFORMFVKHRPROC gl::gl_GetnUniformfvKHR INIT_POINTER;
 void gl::GetnUniformfvKHR  (GLuint program, GLint location, GLsizei bufSize, GLfloat *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetnUniformfvKHR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetnUniformfvKHR(
+	TRACE_CALL(gl_GetnUniformfvKHR)(
 		program,
 		location,
 		bufSize,
@@ -8126,7 +14206,7 @@ PFNGLGETNUNIFORMIVKHRPROC gl::gl_GetnUniformivKHR INIT_POINTER;
 void gl::GetnUniformivKHR  (GLuint program, GLint location, GLsizei bufSize, GLint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetnUniformivKHR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetnUniformivKHR(
+	TRACE_CALL(gl_GetnUniformivKHR)(
 		program,
 		location,
 		bufSize,
@@ -8137,7 +14217,7 @@ PFNGLGETNUNIFORMUIVKHRPROC gl::gl_GetnUniformuivKHR INIT_POINTER;
 void gl::GetnUniformuivKHR  (GLuint program, GLint location, GLsizei bufSize, GLuint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetnUniformuivKHR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetnUniformuivKHR(
+	TRACE_CALL(gl_GetnUniformuivKHR)(
 		program,
 		location,
 		bufSize,
@@ -8148,7 +14228,7 @@ PFNGLREADNPIXELSKHRPROC gl::gl_ReadnPixelsKHR INIT_POINTER;
 void gl::ReadnPixelsKHR  (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data, const char* file, int line)
 {
 	TRACE_FUNCTION("glReadnPixelsKHR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ReadnPixelsKHR(
+	TRACE_CALL(gl_ReadnPixelsKHR)(
 		x,
 		y,
 		width,
@@ -8164,7 +14244,7 @@ PFNGLGETIMAGEHANDLENVPROC gl::gl_GetImageHandleNV INIT_POINTER;
 GLuint64 gl::GetImageHandleNV  (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetImageHandleNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_GetImageHandleNV(
+	return TRACE_CALL(gl_GetImageHandleNV)(
 		texture,
 		level,
 		layered,
@@ -8176,7 +14256,7 @@ PFNGLGETTEXTUREHANDLENVPROC gl::gl_GetTextureHandleNV INIT_POINTER;
 GLuint64 gl::GetTextureHandleNV  (GLuint texture, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetTextureHandleNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_GetTextureHandleNV(
+	return TRACE_CALL(gl_GetTextureHandleNV)(
 		texture);
 }
 
@@ -8184,7 +14264,7 @@ PFNGLGETTEXTURESAMPLERHANDLENVPROC gl::gl_GetTextureSamplerHandleNV INIT_POINTER
 GLuint64 gl::GetTextureSamplerHandleNV  (GLuint texture, GLuint sampler, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetTextureSamplerHandleNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_GetTextureSamplerHandleNV(
+	return TRACE_CALL(gl_GetTextureSamplerHandleNV)(
 		texture,
 		sampler);
 }
@@ -8193,7 +14273,7 @@ PFNGLISIMAGEHANDLERESIDENTNVPROC gl::gl_IsImageHandleResidentNV INIT_POINTER;
 GLboolean gl::IsImageHandleResidentNV  (GLuint64 handle, const char* file, int line)
 {
 	TRACE_FUNCTION("glIsImageHandleResidentNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_IsImageHandleResidentNV(
+	return TRACE_CALL(gl_IsImageHandleResidentNV)(
 		handle);
 }
 
@@ -8201,7 +14281,7 @@ PFNGLISTEXTUREHANDLERESIDENTNVPROC gl::gl_IsTextureHandleResidentNV INIT_POINTER
 GLboolean gl::IsTextureHandleResidentNV  (GLuint64 handle, const char* file, int line)
 {
 	TRACE_FUNCTION("glIsTextureHandleResidentNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_IsTextureHandleResidentNV(
+	return TRACE_CALL(gl_IsTextureHandleResidentNV)(
 		handle);
 }
 
@@ -8209,7 +14289,7 @@ PFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC gl::gl_MakeImageHandleNonResidentNV INIT_P
 void gl::MakeImageHandleNonResidentNV  (GLuint64 handle, const char* file, int line)
 {
 	TRACE_FUNCTION("glMakeImageHandleNonResidentNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MakeImageHandleNonResidentNV(
+	TRACE_CALL(gl_MakeImageHandleNonResidentNV)(
 		handle);
 }
 
@@ -8217,7 +14297,7 @@ PFNGLMAKEIMAGEHANDLERESIDENTNVPROC gl::gl_MakeImageHandleResidentNV INIT_POINTER
 void gl::MakeImageHandleResidentNV  (GLuint64 handle, GLenum access, const char* file, int line)
 {
 	TRACE_FUNCTION("glMakeImageHandleResidentNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MakeImageHandleResidentNV(
+	TRACE_CALL(gl_MakeImageHandleResidentNV)(
 		handle,
 		access);
 }
@@ -8226,7 +14306,7 @@ PFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC gl::gl_MakeTextureHandleNonResidentNV IN
 void gl::MakeTextureHandleNonResidentNV  (GLuint64 handle, const char* file, int line)
 {
 	TRACE_FUNCTION("glMakeTextureHandleNonResidentNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MakeTextureHandleNonResidentNV(
+	TRACE_CALL(gl_MakeTextureHandleNonResidentNV)(
 		handle);
 }
 
@@ -8234,7 +14314,7 @@ PFNGLMAKETEXTUREHANDLERESIDENTNVPROC gl::gl_MakeTextureHandleResidentNV INIT_POI
 void gl::MakeTextureHandleResidentNV  (GLuint64 handle, const char* file, int line)
 {
 	TRACE_FUNCTION("glMakeTextureHandleResidentNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MakeTextureHandleResidentNV(
+	TRACE_CALL(gl_MakeTextureHandleResidentNV)(
 		handle);
 }
 
@@ -8242,7 +14322,7 @@ PFNGLPROGRAMUNIFORMHANDLEUI64NVPROC gl::gl_ProgramUniformHandleui64NV INIT_POINT
 void gl::ProgramUniformHandleui64NV  (GLuint program, GLint location, GLuint64 value, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniformHandleui64NV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniformHandleui64NV(
+	TRACE_CALL(gl_ProgramUniformHandleui64NV)(
 		program,
 		location,
 		value);
@@ -8252,7 +14332,7 @@ PFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC gl::gl_ProgramUniformHandleui64vNV INIT_POI
 void gl::ProgramUniformHandleui64vNV  (GLuint program, GLint location, GLsizei count, const GLuint64 *values, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramUniformHandleui64vNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramUniformHandleui64vNV(
+	TRACE_CALL(gl_ProgramUniformHandleui64vNV)(
 		program,
 		location,
 		count,
@@ -8263,7 +14343,7 @@ PFNGLUNIFORMHANDLEUI64NVPROC gl::gl_UniformHandleui64NV INIT_POINTER;
 void gl::UniformHandleui64NV  (GLint location, GLuint64 value, const char* file, int line)
 {
 	TRACE_FUNCTION("glUniformHandleui64NV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_UniformHandleui64NV(
+	TRACE_CALL(gl_UniformHandleui64NV)(
 		location,
 		value);
 }
@@ -8272,7 +14352,7 @@ PFNGLUNIFORMHANDLEUI64VNVPROC gl::gl_UniformHandleui64vNV INIT_POINTER;
 void gl::UniformHandleui64vNV  (GLint location, GLsizei count, const GLuint64 *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glUniformHandleui64vNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_UniformHandleui64vNV(
+	TRACE_CALL(gl_UniformHandleui64vNV)(
 		location,
 		count,
 		value);
@@ -8283,7 +14363,7 @@ PFNGLBLENDBARRIERNVPROC gl::gl_BlendBarrierNV INIT_POINTER;
 void gl::BlendBarrierNV  (const char* file, int line)
 {
 	TRACE_FUNCTION("glBlendBarrierNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BlendBarrierNV(
+	TRACE_CALL(gl_BlendBarrierNV)(
 		);
 }
 
@@ -8291,7 +14371,7 @@ PFNGLBLENDPARAMETERINVPROC gl::gl_BlendParameteriNV INIT_POINTER;
 void gl::BlendParameteriNV  (GLenum pname, GLint value, const char* file, int line)
 {
 	TRACE_FUNCTION("glBlendParameteriNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BlendParameteriNV(
+	TRACE_CALL(gl_BlendParameteriNV)(
 		pname,
 		value);
 }
@@ -8301,7 +14381,7 @@ PFNGLBEGINCONDITIONALRENDERNVPROC gl::gl_BeginConditionalRenderNV INIT_POINTER;
 void gl::BeginConditionalRenderNV  (GLuint id, GLenum mode, const char* file, int line)
 {
 	TRACE_FUNCTION("glBeginConditionalRenderNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BeginConditionalRenderNV(
+	TRACE_CALL(gl_BeginConditionalRenderNV)(
 		id,
 		mode);
 }
@@ -8310,7 +14390,7 @@ PFNGLENDCONDITIONALRENDERNVPROC gl::gl_EndConditionalRenderNV INIT_POINTER;
 void gl::EndConditionalRenderNV  (const char* file, int line)
 {
 	TRACE_FUNCTION("glEndConditionalRenderNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_EndConditionalRenderNV(
+	TRACE_CALL(gl_EndConditionalRenderNV)(
 		);
 }
 
@@ -8319,7 +14399,7 @@ PFNGLSUBPIXELPRECISIONBIASNVPROC gl::gl_SubpixelPrecisionBiasNV INIT_POINTER;
 void gl::SubpixelPrecisionBiasNV  (GLuint xbits, GLuint ybits, const char* file, int line)
 {
 	TRACE_FUNCTION("glSubpixelPrecisionBiasNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_SubpixelPrecisionBiasNV(
+	TRACE_CALL(gl_SubpixelPrecisionBiasNV)(
 		xbits,
 		ybits);
 }
@@ -8329,7 +14409,7 @@ PFNGLCOPYBUFFERSUBDATANVPROC gl::gl_CopyBufferSubDataNV INIT_POINTER;
 void gl::CopyBufferSubDataNV  (GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size, const char* file, int line)
 {
 	TRACE_FUNCTION("glCopyBufferSubDataNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CopyBufferSubDataNV(
+	TRACE_CALL(gl_CopyBufferSubDataNV)(
 		readTarget,
 		writeTarget,
 		readOffset,
@@ -8342,7 +14422,7 @@ PFNGLCOVERAGEMASKNVPROC gl::gl_CoverageMaskNV INIT_POINTER;
 void gl::CoverageMaskNV  (GLboolean mask, const char* file, int line)
 {
 	TRACE_FUNCTION("glCoverageMaskNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CoverageMaskNV(
+	TRACE_CALL(gl_CoverageMaskNV)(
 		mask);
 }
 
@@ -8350,7 +14430,7 @@ PFNGLCOVERAGEOPERATIONNVPROC gl::gl_CoverageOperationNV INIT_POINTER;
 void gl::CoverageOperationNV  (GLenum operation, const char* file, int line)
 {
 	TRACE_FUNCTION("glCoverageOperationNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CoverageOperationNV(
+	TRACE_CALL(gl_CoverageOperationNV)(
 		operation);
 }
 
@@ -8359,7 +14439,7 @@ PFNGLDRAWBUFFERSNVPROC gl::gl_DrawBuffersNV INIT_POINTER;
 void gl::DrawBuffersNV  (GLsizei n, const GLenum *bufs, const char* file, int line)
 {
 	TRACE_FUNCTION("glDrawBuffersNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DrawBuffersNV(
+	TRACE_CALL(gl_DrawBuffersNV)(
 		n,
 		bufs);
 }
@@ -8369,7 +14449,7 @@ PFNGLDRAWARRAYSINSTANCEDNVPROC gl::gl_DrawArraysInstancedNV INIT_POINTER;
 void gl::DrawArraysInstancedNV  (GLenum mode, GLint first, GLsizei count, GLsizei primcount, const char* file, int line)
 {
 	TRACE_FUNCTION("glDrawArraysInstancedNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DrawArraysInstancedNV(
+	TRACE_CALL(gl_DrawArraysInstancedNV)(
 		mode,
 		first,
 		count,
@@ -8380,7 +14460,7 @@ PFNGLDRAWELEMENTSINSTANCEDNVPROC gl::gl_DrawElementsInstancedNV INIT_POINTER;
 void gl::DrawElementsInstancedNV  (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount, const char* file, int line)
 {
 	TRACE_FUNCTION("glDrawElementsInstancedNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DrawElementsInstancedNV(
+	TRACE_CALL(gl_DrawElementsInstancedNV)(
 		mode,
 		count,
 		type,
@@ -8393,7 +14473,7 @@ PFNGLDELETEFENCESNVPROC gl::gl_DeleteFencesNV INIT_POINTER;
 void gl::DeleteFencesNV  (GLsizei n, const GLuint *fences, const char* file, int line)
 {
 	TRACE_FUNCTION("glDeleteFencesNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DeleteFencesNV(
+	TRACE_CALL(gl_DeleteFencesNV)(
 		n,
 		fences);
 }
@@ -8402,7 +14482,7 @@ PFNGLFINISHFENCENVPROC gl::gl_FinishFenceNV INIT_POINTER;
 void gl::FinishFenceNV  (GLuint fence, const char* file, int line)
 {
 	TRACE_FUNCTION("glFinishFenceNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_FinishFenceNV(
+	TRACE_CALL(gl_FinishFenceNV)(
 		fence);
 }
 
@@ -8410,7 +14490,7 @@ PFNGLGENFENCESNVPROC gl::gl_GenFencesNV INIT_POINTER;
 void gl::GenFencesNV  (GLsizei n, GLuint *fences, const char* file, int line)
 {
 	TRACE_FUNCTION("glGenFencesNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GenFencesNV(
+	TRACE_CALL(gl_GenFencesNV)(
 		n,
 		fences);
 }
@@ -8419,7 +14499,7 @@ PFNGLGETFENCEIVNVPROC gl::gl_GetFenceivNV INIT_POINTER;
 void gl::GetFenceivNV  (GLuint fence, GLenum pname, GLint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetFenceivNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetFenceivNV(
+	TRACE_CALL(gl_GetFenceivNV)(
 		fence,
 		pname,
 		params);
@@ -8429,7 +14509,7 @@ PFNGLISFENCENVPROC gl::gl_IsFenceNV INIT_POINTER;
 GLboolean gl::IsFenceNV  (GLuint fence, const char* file, int line)
 {
 	TRACE_FUNCTION("glIsFenceNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_IsFenceNV(
+	return TRACE_CALL(gl_IsFenceNV)(
 		fence);
 }
 
@@ -8437,7 +14517,7 @@ PFNGLSETFENCENVPROC gl::gl_SetFenceNV INIT_POINTER;
 void gl::SetFenceNV  (GLuint fence, GLenum condition, const char* file, int line)
 {
 	TRACE_FUNCTION("glSetFenceNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_SetFenceNV(
+	TRACE_CALL(gl_SetFenceNV)(
 		fence,
 		condition);
 }
@@ -8446,7 +14526,7 @@ PFNGLTESTFENCENVPROC gl::gl_TestFenceNV INIT_POINTER;
 GLboolean gl::TestFenceNV  (GLuint fence, const char* file, int line)
 {
 	TRACE_FUNCTION("glTestFenceNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_TestFenceNV(
+	return TRACE_CALL(gl_TestFenceNV)(
 		fence);
 }
 
@@ -8455,7 +14535,7 @@ PFNGLFRAGMENTCOVERAGECOLORNVPROC gl::gl_FragmentCoverageColorNV INIT_POINTER;
 void gl::FragmentCoverageColorNV  (GLuint color, const char* file, int line)
 {
 	TRACE_FUNCTION("glFragmentCoverageColorNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_FragmentCoverageColorNV(
+	TRACE_CALL(gl_FragmentCoverageColorNV)(
 		color);
 }
 
@@ -8464,7 +14544,7 @@ PFNGLBLITFRAMEBUFFERNVPROC gl::gl_BlitFramebufferNV INIT_POINTER;
 void gl::BlitFramebufferNV  (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter, const char* file, int line)
 {
 	TRACE_FUNCTION("glBlitFramebufferNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BlitFramebufferNV(
+	TRACE_CALL(gl_BlitFramebufferNV)(
 		srcX0,
 		srcY0,
 		srcX1,
@@ -8482,7 +14562,7 @@ PFNGLCOVERAGEMODULATIONNVPROC gl::gl_CoverageModulationNV INIT_POINTER;
 void gl::CoverageModulationNV  (GLenum components, const char* file, int line)
 {
 	TRACE_FUNCTION("glCoverageModulationNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CoverageModulationNV(
+	TRACE_CALL(gl_CoverageModulationNV)(
 		components);
 }
 
@@ -8490,7 +14570,7 @@ PFNGLCOVERAGEMODULATIONTABLENVPROC gl::gl_CoverageModulationTableNV INIT_POINTER
 void gl::CoverageModulationTableNV  (GLsizei n, const GLfloat *v, const char* file, int line)
 {
 	TRACE_FUNCTION("glCoverageModulationTableNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CoverageModulationTableNV(
+	TRACE_CALL(gl_CoverageModulationTableNV)(
 		n,
 		v);
 }
@@ -8499,7 +14579,7 @@ PFNGLGETCOVERAGEMODULATIONTABLENVPROC gl::gl_GetCoverageModulationTableNV INIT_P
 void gl::GetCoverageModulationTableNV  (GLsizei bufsize, GLfloat *v, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetCoverageModulationTableNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetCoverageModulationTableNV(
+	TRACE_CALL(gl_GetCoverageModulationTableNV)(
 		bufsize,
 		v);
 }
@@ -8509,12 +14589,19 @@ PFNGLRENDERBUFFERSTORAGEMULTISAMPLENVPROC gl::gl_RenderbufferStorageMultisampleN
 void gl::RenderbufferStorageMultisampleNV  (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, const char* file, int line)
 {
 	TRACE_FUNCTION("glRenderbufferStorageMultisampleNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_RenderbufferStorageMultisampleNV(
+	TRACE_CALL(gl_RenderbufferStorageMultisampleNV)(
 		target,
 		samples,
 		internalformat,
 		width,
 		height);
+
+	const char* result = get_last_error();
+
+	if (!result)
+		setRenderbufferStorage(internalformat, samples, width, height);
+
+	breakOnError(!result, result);
 }
 
 // GL_NV_instanced_arrays
@@ -8522,7 +14609,7 @@ PFNGLVERTEXATTRIBDIVISORNVPROC gl::gl_VertexAttribDivisorNV INIT_POINTER;
 void gl::VertexAttribDivisorNV  (GLuint index, GLuint divisor, const char* file, int line)
 {
 	TRACE_FUNCTION("glVertexAttribDivisorNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_VertexAttribDivisorNV(
+	TRACE_CALL(gl_VertexAttribDivisorNV)(
 		index,
 		divisor);
 }
@@ -8532,7 +14619,7 @@ PFNGLGETINTERNALFORMATSAMPLEIVNVPROC gl::gl_GetInternalformatSampleivNV INIT_POI
 void gl::GetInternalformatSampleivNV  (GLenum target, GLenum internalformat, GLsizei samples, GLenum pname, GLsizei bufSize, GLint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetInternalformatSampleivNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetInternalformatSampleivNV(
+	TRACE_CALL(gl_GetInternalformatSampleivNV)(
 		target,
 		internalformat,
 		samples,
@@ -8546,7 +14633,7 @@ PFNGLUNIFORMMATRIX2X3FVNVPROC gl::gl_UniformMatrix2x3fvNV INIT_POINTER;
 void gl::UniformMatrix2x3fvNV  (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glUniformMatrix2x3fvNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_UniformMatrix2x3fvNV(
+	TRACE_CALL(gl_UniformMatrix2x3fvNV)(
 		location,
 		count,
 		transpose,
@@ -8557,7 +14644,7 @@ PFNGLUNIFORMMATRIX2X4FVNVPROC gl::gl_UniformMatrix2x4fvNV INIT_POINTER;
 void gl::UniformMatrix2x4fvNV  (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glUniformMatrix2x4fvNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_UniformMatrix2x4fvNV(
+	TRACE_CALL(gl_UniformMatrix2x4fvNV)(
 		location,
 		count,
 		transpose,
@@ -8568,7 +14655,7 @@ PFNGLUNIFORMMATRIX3X2FVNVPROC gl::gl_UniformMatrix3x2fvNV INIT_POINTER;
 void gl::UniformMatrix3x2fvNV  (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glUniformMatrix3x2fvNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_UniformMatrix3x2fvNV(
+	TRACE_CALL(gl_UniformMatrix3x2fvNV)(
 		location,
 		count,
 		transpose,
@@ -8579,7 +14666,7 @@ PFNGLUNIFORMMATRIX3X4FVNVPROC gl::gl_UniformMatrix3x4fvNV INIT_POINTER;
 void gl::UniformMatrix3x4fvNV  (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glUniformMatrix3x4fvNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_UniformMatrix3x4fvNV(
+	TRACE_CALL(gl_UniformMatrix3x4fvNV)(
 		location,
 		count,
 		transpose,
@@ -8590,7 +14677,7 @@ PFNGLUNIFORMMATRIX4X2FVNVPROC gl::gl_UniformMatrix4x2fvNV INIT_POINTER;
 void gl::UniformMatrix4x2fvNV  (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glUniformMatrix4x2fvNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_UniformMatrix4x2fvNV(
+	TRACE_CALL(gl_UniformMatrix4x2fvNV)(
 		location,
 		count,
 		transpose,
@@ -8601,7 +14688,7 @@ PFNGLUNIFORMMATRIX4X3FVNVPROC gl::gl_UniformMatrix4x3fvNV INIT_POINTER;
 void gl::UniformMatrix4x3fvNV  (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glUniformMatrix4x3fvNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_UniformMatrix4x3fvNV(
+	TRACE_CALL(gl_UniformMatrix4x3fvNV)(
 		location,
 		count,
 		transpose,
@@ -8613,7 +14700,7 @@ PFNGLCOPYPATHNVPROC gl::gl_CopyPathNV INIT_POINTER;
 void gl::CopyPathNV  (GLuint resultPath, GLuint srcPath, const char* file, int line)
 {
 	TRACE_FUNCTION("glCopyPathNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CopyPathNV(
+	TRACE_CALL(gl_CopyPathNV)(
 		resultPath,
 		srcPath);
 }
@@ -8622,7 +14709,7 @@ PFNGLCOVERFILLPATHINSTANCEDNVPROC gl::gl_CoverFillPathInstancedNV INIT_POINTER;
 void gl::CoverFillPathInstancedNV  (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues, const char* file, int line)
 {
 	TRACE_FUNCTION("glCoverFillPathInstancedNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CoverFillPathInstancedNV(
+	TRACE_CALL(gl_CoverFillPathInstancedNV)(
 		numPaths,
 		pathNameType,
 		paths,
@@ -8636,7 +14723,7 @@ PFNGLCOVERFILLPATHNVPROC gl::gl_CoverFillPathNV INIT_POINTER;
 void gl::CoverFillPathNV  (GLuint path, GLenum coverMode, const char* file, int line)
 {
 	TRACE_FUNCTION("glCoverFillPathNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CoverFillPathNV(
+	TRACE_CALL(gl_CoverFillPathNV)(
 		path,
 		coverMode);
 }
@@ -8645,7 +14732,7 @@ PFNGLCOVERSTROKEPATHINSTANCEDNVPROC gl::gl_CoverStrokePathInstancedNV INIT_POINT
 void gl::CoverStrokePathInstancedNV  (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues, const char* file, int line)
 {
 	TRACE_FUNCTION("glCoverStrokePathInstancedNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CoverStrokePathInstancedNV(
+	TRACE_CALL(gl_CoverStrokePathInstancedNV)(
 		numPaths,
 		pathNameType,
 		paths,
@@ -8659,7 +14746,7 @@ PFNGLCOVERSTROKEPATHNVPROC gl::gl_CoverStrokePathNV INIT_POINTER;
 void gl::CoverStrokePathNV  (GLuint path, GLenum coverMode, const char* file, int line)
 {
 	TRACE_FUNCTION("glCoverStrokePathNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CoverStrokePathNV(
+	TRACE_CALL(gl_CoverStrokePathNV)(
 		path,
 		coverMode);
 }
@@ -8668,7 +14755,7 @@ PFNGLDELETEPATHSNVPROC gl::gl_DeletePathsNV INIT_POINTER;
 void gl::DeletePathsNV  (GLuint path, GLsizei range, const char* file, int line)
 {
 	TRACE_FUNCTION("glDeletePathsNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DeletePathsNV(
+	TRACE_CALL(gl_DeletePathsNV)(
 		path,
 		range);
 }
@@ -8677,7 +14764,7 @@ PFNGLGENPATHSNVPROC gl::gl_GenPathsNV INIT_POINTER;
 GLuint gl::GenPathsNV  (GLsizei range, const char* file, int line)
 {
 	TRACE_FUNCTION("glGenPathsNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_GenPathsNV(
+	return TRACE_CALL(gl_GenPathsNV)(
 		range);
 }
 
@@ -8685,7 +14772,7 @@ PFNGLGETPATHCOMMANDSNVPROC gl::gl_GetPathCommandsNV INIT_POINTER;
 void gl::GetPathCommandsNV  (GLuint path, GLubyte *commands, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPathCommandsNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPathCommandsNV(
+	TRACE_CALL(gl_GetPathCommandsNV)(
 		path,
 		commands);
 }
@@ -8694,7 +14781,7 @@ PFNGLGETPATHCOORDSNVPROC gl::gl_GetPathCoordsNV INIT_POINTER;
 void gl::GetPathCoordsNV  (GLuint path, GLfloat *coords, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPathCoordsNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPathCoordsNV(
+	TRACE_CALL(gl_GetPathCoordsNV)(
 		path,
 		coords);
 }
@@ -8703,7 +14790,7 @@ PFNGLGETPATHDASHARRAYNVPROC gl::gl_GetPathDashArrayNV INIT_POINTER;
 void gl::GetPathDashArrayNV  (GLuint path, GLfloat *dashArray, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPathDashArrayNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPathDashArrayNV(
+	TRACE_CALL(gl_GetPathDashArrayNV)(
 		path,
 		dashArray);
 }
@@ -8712,7 +14799,7 @@ PFNGLGETPATHLENGTHNVPROC gl::gl_GetPathLengthNV INIT_POINTER;
 GLfloat gl::GetPathLengthNV  (GLuint path, GLsizei startSegment, GLsizei numSegments, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPathLengthNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_GetPathLengthNV(
+	return TRACE_CALL(gl_GetPathLengthNV)(
 		path,
 		startSegment,
 		numSegments);
@@ -8722,7 +14809,7 @@ PFNGLGETPATHMETRICRANGENVPROC gl::gl_GetPathMetricRangeNV INIT_POINTER;
 void gl::GetPathMetricRangeNV  (GLbitfield metricQueryMask, GLuint firstPathName, GLsizei numPaths, GLsizei stride, GLfloat *metrics, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPathMetricRangeNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPathMetricRangeNV(
+	TRACE_CALL(gl_GetPathMetricRangeNV)(
 		metricQueryMask,
 		firstPathName,
 		numPaths,
@@ -8734,7 +14821,7 @@ PFNGLGETPATHMETRICSNVPROC gl::gl_GetPathMetricsNV INIT_POINTER;
 void gl::GetPathMetricsNV  (GLbitfield metricQueryMask, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLsizei stride, GLfloat *metrics, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPathMetricsNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPathMetricsNV(
+	TRACE_CALL(gl_GetPathMetricsNV)(
 		metricQueryMask,
 		numPaths,
 		pathNameType,
@@ -8748,7 +14835,7 @@ PFNGLGETPATHPARAMETERFVNVPROC gl::gl_GetPathParameterfvNV INIT_POINTER;
 void gl::GetPathParameterfvNV  (GLuint path, GLenum pname, GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPathParameterfvNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPathParameterfvNV(
+	TRACE_CALL(gl_GetPathParameterfvNV)(
 		path,
 		pname,
 		value);
@@ -8758,7 +14845,7 @@ PFNGLGETPATHPARAMETERIVNVPROC gl::gl_GetPathParameterivNV INIT_POINTER;
 void gl::GetPathParameterivNV  (GLuint path, GLenum pname, GLint *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPathParameterivNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPathParameterivNV(
+	TRACE_CALL(gl_GetPathParameterivNV)(
 		path,
 		pname,
 		value);
@@ -8768,7 +14855,7 @@ PFNGLGETPATHSPACINGNVPROC gl::gl_GetPathSpacingNV INIT_POINTER;
 void gl::GetPathSpacingNV  (GLenum pathListMode, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLfloat advanceScale, GLfloat kerningScale, GLenum transformType, GLfloat *returnedSpacing, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetPathSpacingNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetPathSpacingNV(
+	TRACE_CALL(gl_GetPathSpacingNV)(
 		pathListMode,
 		numPaths,
 		pathNameType,
@@ -8784,7 +14871,7 @@ PFNGLGETPROGRAMRESOURCEFVNVPROC gl::gl_GetProgramResourcefvNV INIT_POINTER;
 void gl::GetProgramResourcefvNV  (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei bufSize, GLsizei *length, GLfloat *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetProgramResourcefvNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetProgramResourcefvNV(
+	TRACE_CALL(gl_GetProgramResourcefvNV)(
 		program,
 		programInterface,
 		index,
@@ -8799,7 +14886,7 @@ PFNGLINTERPOLATEPATHSNVPROC gl::gl_InterpolatePathsNV INIT_POINTER;
 void gl::InterpolatePathsNV  (GLuint resultPath, GLuint pathA, GLuint pathB, GLfloat weight, const char* file, int line)
 {
 	TRACE_FUNCTION("glInterpolatePathsNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_InterpolatePathsNV(
+	TRACE_CALL(gl_InterpolatePathsNV)(
 		resultPath,
 		pathA,
 		pathB,
@@ -8810,7 +14897,7 @@ PFNGLISPATHNVPROC gl::gl_IsPathNV INIT_POINTER;
 GLboolean gl::IsPathNV  (GLuint path, const char* file, int line)
 {
 	TRACE_FUNCTION("glIsPathNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_IsPathNV(
+	return TRACE_CALL(gl_IsPathNV)(
 		path);
 }
 
@@ -8818,7 +14905,7 @@ PFNGLISPOINTINFILLPATHNVPROC gl::gl_IsPointInFillPathNV INIT_POINTER;
 GLboolean gl::IsPointInFillPathNV  (GLuint path, GLuint mask, GLfloat x, GLfloat y, const char* file, int line)
 {
 	TRACE_FUNCTION("glIsPointInFillPathNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_IsPointInFillPathNV(
+	return TRACE_CALL(gl_IsPointInFillPathNV)(
 		path,
 		mask,
 		x,
@@ -8829,7 +14916,7 @@ PFNGLISPOINTINSTROKEPATHNVPROC gl::gl_IsPointInStrokePathNV INIT_POINTER;
 GLboolean gl::IsPointInStrokePathNV  (GLuint path, GLfloat x, GLfloat y, const char* file, int line)
 {
 	TRACE_FUNCTION("glIsPointInStrokePathNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_IsPointInStrokePathNV(
+	return TRACE_CALL(gl_IsPointInStrokePathNV)(
 		path,
 		x,
 		y);
@@ -8839,7 +14926,7 @@ PFNGLMATRIXLOAD3X2FNVPROC gl::gl_MatrixLoad3x2fNV INIT_POINTER;
 void gl::MatrixLoad3x2fNV  (GLenum matrixMode, const GLfloat *m, const char* file, int line)
 {
 	TRACE_FUNCTION("glMatrixLoad3x2fNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MatrixLoad3x2fNV(
+	TRACE_CALL(gl_MatrixLoad3x2fNV)(
 		matrixMode,
 		m);
 }
@@ -8848,7 +14935,7 @@ PFNGLMATRIXLOAD3X3FNVPROC gl::gl_MatrixLoad3x3fNV INIT_POINTER;
 void gl::MatrixLoad3x3fNV  (GLenum matrixMode, const GLfloat *m, const char* file, int line)
 {
 	TRACE_FUNCTION("glMatrixLoad3x3fNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MatrixLoad3x3fNV(
+	TRACE_CALL(gl_MatrixLoad3x3fNV)(
 		matrixMode,
 		m);
 }
@@ -8857,7 +14944,7 @@ PFNGLMATRIXLOADTRANSPOSE3X3FNVPROC gl::gl_MatrixLoadTranspose3x3fNV INIT_POINTER
 void gl::MatrixLoadTranspose3x3fNV  (GLenum matrixMode, const GLfloat *m, const char* file, int line)
 {
 	TRACE_FUNCTION("glMatrixLoadTranspose3x3fNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MatrixLoadTranspose3x3fNV(
+	TRACE_CALL(gl_MatrixLoadTranspose3x3fNV)(
 		matrixMode,
 		m);
 }
@@ -8866,7 +14953,7 @@ PFNGLMATRIXMULT3X2FNVPROC gl::gl_MatrixMult3x2fNV INIT_POINTER;
 void gl::MatrixMult3x2fNV  (GLenum matrixMode, const GLfloat *m, const char* file, int line)
 {
 	TRACE_FUNCTION("glMatrixMult3x2fNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MatrixMult3x2fNV(
+	TRACE_CALL(gl_MatrixMult3x2fNV)(
 		matrixMode,
 		m);
 }
@@ -8875,7 +14962,7 @@ PFNGLMATRIXMULT3X3FNVPROC gl::gl_MatrixMult3x3fNV INIT_POINTER;
 void gl::MatrixMult3x3fNV  (GLenum matrixMode, const GLfloat *m, const char* file, int line)
 {
 	TRACE_FUNCTION("glMatrixMult3x3fNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MatrixMult3x3fNV(
+	TRACE_CALL(gl_MatrixMult3x3fNV)(
 		matrixMode,
 		m);
 }
@@ -8884,7 +14971,7 @@ PFNGLMATRIXMULTTRANSPOSE3X3FNVPROC gl::gl_MatrixMultTranspose3x3fNV INIT_POINTER
 void gl::MatrixMultTranspose3x3fNV  (GLenum matrixMode, const GLfloat *m, const char* file, int line)
 {
 	TRACE_FUNCTION("glMatrixMultTranspose3x3fNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MatrixMultTranspose3x3fNV(
+	TRACE_CALL(gl_MatrixMultTranspose3x3fNV)(
 		matrixMode,
 		m);
 }
@@ -8893,7 +14980,7 @@ PFNGLPATHCOMMANDSNVPROC gl::gl_PathCommandsNV INIT_POINTER;
 void gl::PathCommandsNV  (GLuint path, GLsizei numCommands, const GLubyte *commands, GLsizei numCoords, GLenum coordType, const void *coords, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathCommandsNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PathCommandsNV(
+	TRACE_CALL(gl_PathCommandsNV)(
 		path,
 		numCommands,
 		commands,
@@ -8906,7 +14993,7 @@ PFNGLPATHCOORDSNVPROC gl::gl_PathCoordsNV INIT_POINTER;
 void gl::PathCoordsNV  (GLuint path, GLsizei numCoords, GLenum coordType, const void *coords, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathCoordsNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PathCoordsNV(
+	TRACE_CALL(gl_PathCoordsNV)(
 		path,
 		numCoords,
 		coordType,
@@ -8917,7 +15004,7 @@ PFNGLPATHCOVERDEPTHFUNCNVPROC gl::gl_PathCoverDepthFuncNV INIT_POINTER;
 void gl::PathCoverDepthFuncNV  (GLenum func, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathCoverDepthFuncNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PathCoverDepthFuncNV(
+	TRACE_CALL(gl_PathCoverDepthFuncNV)(
 		func);
 }
 
@@ -8925,7 +15012,7 @@ PFNGLPATHDASHARRAYNVPROC gl::gl_PathDashArrayNV INIT_POINTER;
 void gl::PathDashArrayNV  (GLuint path, GLsizei dashCount, const GLfloat *dashArray, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathDashArrayNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PathDashArrayNV(
+	TRACE_CALL(gl_PathDashArrayNV)(
 		path,
 		dashCount,
 		dashArray);
@@ -8935,7 +15022,7 @@ PFNGLPATHGLYPHINDEXARRAYNVPROC gl::gl_PathGlyphIndexArrayNV INIT_POINTER;
 GLenum gl::PathGlyphIndexArrayNV  (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathGlyphIndexArrayNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_PathGlyphIndexArrayNV(
+	return TRACE_CALL(gl_PathGlyphIndexArrayNV)(
 		firstPathName,
 		fontTarget,
 		fontName,
@@ -8950,7 +15037,7 @@ PFNGLPATHGLYPHINDEXRANGENVPROC gl::gl_PathGlyphIndexRangeNV INIT_POINTER;
 GLenum gl::PathGlyphIndexRangeNV  (GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint pathParameterTemplate, GLfloat emScale, GLuint baseAndCount[2], const char* file, int line)
 {
 	TRACE_FUNCTION("glPathGlyphIndexRangeNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_PathGlyphIndexRangeNV(
+	return TRACE_CALL(gl_PathGlyphIndexRangeNV)(
 		fontTarget,
 		fontName,
 		fontStyle,
@@ -8963,7 +15050,7 @@ PFNGLPATHGLYPHRANGENVPROC gl::gl_PathGlyphRangeNV INIT_POINTER;
 void gl::PathGlyphRangeNV  (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyph, GLsizei numGlyphs, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathGlyphRangeNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PathGlyphRangeNV(
+	TRACE_CALL(gl_PathGlyphRangeNV)(
 		firstPathName,
 		fontTarget,
 		fontName,
@@ -8979,7 +15066,7 @@ PFNGLPATHGLYPHSNVPROC gl::gl_PathGlyphsNV INIT_POINTER;
 void gl::PathGlyphsNV  (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLsizei numGlyphs, GLenum type, const void *charcodes, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathGlyphsNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PathGlyphsNV(
+	TRACE_CALL(gl_PathGlyphsNV)(
 		firstPathName,
 		fontTarget,
 		fontName,
@@ -8996,7 +15083,7 @@ PFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC gl::gl_PathMemoryGlyphIndexArrayNV INIT_POI
 GLenum gl::PathMemoryGlyphIndexArrayNV  (GLuint firstPathName, GLenum fontTarget, GLsizeiptr fontSize, const void *fontData, GLsizei faceIndex, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathMemoryGlyphIndexArrayNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_PathMemoryGlyphIndexArrayNV(
+	return TRACE_CALL(gl_PathMemoryGlyphIndexArrayNV)(
 		firstPathName,
 		fontTarget,
 		fontSize,
@@ -9012,7 +15099,7 @@ PFNGLPATHPARAMETERFNVPROC gl::gl_PathParameterfNV INIT_POINTER;
 void gl::PathParameterfNV  (GLuint path, GLenum pname, GLfloat value, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathParameterfNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PathParameterfNV(
+	TRACE_CALL(gl_PathParameterfNV)(
 		path,
 		pname,
 		value);
@@ -9022,7 +15109,7 @@ PFNGLPATHPARAMETERFVNVPROC gl::gl_PathParameterfvNV INIT_POINTER;
 void gl::PathParameterfvNV  (GLuint path, GLenum pname, const GLfloat *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathParameterfvNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PathParameterfvNV(
+	TRACE_CALL(gl_PathParameterfvNV)(
 		path,
 		pname,
 		value);
@@ -9032,7 +15119,7 @@ PFNGLPATHPARAMETERINVPROC gl::gl_PathParameteriNV INIT_POINTER;
 void gl::PathParameteriNV  (GLuint path, GLenum pname, GLint value, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathParameteriNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PathParameteriNV(
+	TRACE_CALL(gl_PathParameteriNV)(
 		path,
 		pname,
 		value);
@@ -9042,7 +15129,7 @@ PFNGLPATHPARAMETERIVNVPROC gl::gl_PathParameterivNV INIT_POINTER;
 void gl::PathParameterivNV  (GLuint path, GLenum pname, const GLint *value, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathParameterivNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PathParameterivNV(
+	TRACE_CALL(gl_PathParameterivNV)(
 		path,
 		pname,
 		value);
@@ -9052,7 +15139,7 @@ PFNGLPATHSTENCILDEPTHOFFSETNVPROC gl::gl_PathStencilDepthOffsetNV INIT_POINTER;
 void gl::PathStencilDepthOffsetNV  (GLfloat factor, GLfloat units, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathStencilDepthOffsetNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PathStencilDepthOffsetNV(
+	TRACE_CALL(gl_PathStencilDepthOffsetNV)(
 		factor,
 		units);
 }
@@ -9061,7 +15148,7 @@ PFNGLPATHSTENCILFUNCNVPROC gl::gl_PathStencilFuncNV INIT_POINTER;
 void gl::PathStencilFuncNV  (GLenum func, GLint ref, GLuint mask, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathStencilFuncNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PathStencilFuncNV(
+	TRACE_CALL(gl_PathStencilFuncNV)(
 		func,
 		ref,
 		mask);
@@ -9071,7 +15158,7 @@ PFNGLPATHSTRINGNVPROC gl::gl_PathStringNV INIT_POINTER;
 void gl::PathStringNV  (GLuint path, GLenum format, GLsizei length, const void *pathString, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathStringNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PathStringNV(
+	TRACE_CALL(gl_PathStringNV)(
 		path,
 		format,
 		length,
@@ -9082,7 +15169,7 @@ PFNGLPATHSUBCOMMANDSNVPROC gl::gl_PathSubCommandsNV INIT_POINTER;
 void gl::PathSubCommandsNV  (GLuint path, GLsizei commandStart, GLsizei commandsToDelete, GLsizei numCommands, const GLubyte *commands, GLsizei numCoords, GLenum coordType, const void *coords, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathSubCommandsNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PathSubCommandsNV(
+	TRACE_CALL(gl_PathSubCommandsNV)(
 		path,
 		commandStart,
 		commandsToDelete,
@@ -9097,7 +15184,7 @@ PFNGLPATHSUBCOORDSNVPROC gl::gl_PathSubCoordsNV INIT_POINTER;
 void gl::PathSubCoordsNV  (GLuint path, GLsizei coordStart, GLsizei numCoords, GLenum coordType, const void *coords, const char* file, int line)
 {
 	TRACE_FUNCTION("glPathSubCoordsNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PathSubCoordsNV(
+	TRACE_CALL(gl_PathSubCoordsNV)(
 		path,
 		coordStart,
 		numCoords,
@@ -9109,7 +15196,7 @@ PFNGLPOINTALONGPATHNVPROC gl::gl_PointAlongPathNV INIT_POINTER;
 GLboolean gl::PointAlongPathNV  (GLuint path, GLsizei startSegment, GLsizei numSegments, GLfloat distance, GLfloat *x, GLfloat *y, GLfloat *tangentX, GLfloat *tangentY, const char* file, int line)
 {
 	TRACE_FUNCTION("glPointAlongPathNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_PointAlongPathNV(
+	return TRACE_CALL(gl_PointAlongPathNV)(
 		path,
 		startSegment,
 		numSegments,
@@ -9124,7 +15211,7 @@ PFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC gl::gl_ProgramPathFragmentInputGenNV INIT
 void gl::ProgramPathFragmentInputGenNV  (GLuint program, GLint location, GLenum genMode, GLint components, const GLfloat *coeffs, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramPathFragmentInputGenNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramPathFragmentInputGenNV(
+	TRACE_CALL(gl_ProgramPathFragmentInputGenNV)(
 		program,
 		location,
 		genMode,
@@ -9136,7 +15223,7 @@ PFNGLSTENCILFILLPATHINSTANCEDNVPROC gl::gl_StencilFillPathInstancedNV INIT_POINT
 void gl::StencilFillPathInstancedNV  (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum transformType, const GLfloat *transformValues, const char* file, int line)
 {
 	TRACE_FUNCTION("glStencilFillPathInstancedNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_StencilFillPathInstancedNV(
+	TRACE_CALL(gl_StencilFillPathInstancedNV)(
 		numPaths,
 		pathNameType,
 		paths,
@@ -9151,7 +15238,7 @@ PFNGLSTENCILFILLPATHNVPROC gl::gl_StencilFillPathNV INIT_POINTER;
 void gl::StencilFillPathNV  (GLuint path, GLenum fillMode, GLuint mask, const char* file, int line)
 {
 	TRACE_FUNCTION("glStencilFillPathNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_StencilFillPathNV(
+	TRACE_CALL(gl_StencilFillPathNV)(
 		path,
 		fillMode,
 		mask);
@@ -9161,7 +15248,7 @@ PFNGLSTENCILSTROKEPATHINSTANCEDNVPROC gl::gl_StencilStrokePathInstancedNV INIT_P
 void gl::StencilStrokePathInstancedNV  (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum transformType, const GLfloat *transformValues, const char* file, int line)
 {
 	TRACE_FUNCTION("glStencilStrokePathInstancedNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_StencilStrokePathInstancedNV(
+	TRACE_CALL(gl_StencilStrokePathInstancedNV)(
 		numPaths,
 		pathNameType,
 		paths,
@@ -9176,7 +15263,7 @@ PFNGLSTENCILSTROKEPATHNVPROC gl::gl_StencilStrokePathNV INIT_POINTER;
 void gl::StencilStrokePathNV  (GLuint path, GLint reference, GLuint mask, const char* file, int line)
 {
 	TRACE_FUNCTION("glStencilStrokePathNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_StencilStrokePathNV(
+	TRACE_CALL(gl_StencilStrokePathNV)(
 		path,
 		reference,
 		mask);
@@ -9186,7 +15273,7 @@ PFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC gl::gl_StencilThenCoverFillPathInst
 void gl::StencilThenCoverFillPathInstancedNV  (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues, const char* file, int line)
 {
 	TRACE_FUNCTION("glStencilThenCoverFillPathInstancedNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_StencilThenCoverFillPathInstancedNV(
+	TRACE_CALL(gl_StencilThenCoverFillPathInstancedNV)(
 		numPaths,
 		pathNameType,
 		paths,
@@ -9202,7 +15289,7 @@ PFNGLSTENCILTHENCOVERFILLPATHNVPROC gl::gl_StencilThenCoverFillPathNV INIT_POINT
 void gl::StencilThenCoverFillPathNV  (GLuint path, GLenum fillMode, GLuint mask, GLenum coverMode, const char* file, int line)
 {
 	TRACE_FUNCTION("glStencilThenCoverFillPathNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_StencilThenCoverFillPathNV(
+	TRACE_CALL(gl_StencilThenCoverFillPathNV)(
 		path,
 		fillMode,
 		mask,
@@ -9213,7 +15300,7 @@ PFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC gl::gl_StencilThenCoverStrokePath
 void gl::StencilThenCoverStrokePathInstancedNV  (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues, const char* file, int line)
 {
 	TRACE_FUNCTION("glStencilThenCoverStrokePathInstancedNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_StencilThenCoverStrokePathInstancedNV(
+	TRACE_CALL(gl_StencilThenCoverStrokePathInstancedNV)(
 		numPaths,
 		pathNameType,
 		paths,
@@ -9229,7 +15316,7 @@ PFNGLSTENCILTHENCOVERSTROKEPATHNVPROC gl::gl_StencilThenCoverStrokePathNV INIT_P
 void gl::StencilThenCoverStrokePathNV  (GLuint path, GLint reference, GLuint mask, GLenum coverMode, const char* file, int line)
 {
 	TRACE_FUNCTION("glStencilThenCoverStrokePathNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_StencilThenCoverStrokePathNV(
+	TRACE_CALL(gl_StencilThenCoverStrokePathNV)(
 		path,
 		reference,
 		mask,
@@ -9240,7 +15327,7 @@ PFNGLTRANSFORMPATHNVPROC gl::gl_TransformPathNV INIT_POINTER;
 void gl::TransformPathNV  (GLuint resultPath, GLuint srcPath, GLenum transformType, const GLfloat *transformValues, const char* file, int line)
 {
 	TRACE_FUNCTION("glTransformPathNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TransformPathNV(
+	TRACE_CALL(gl_TransformPathNV)(
 		resultPath,
 		srcPath,
 		transformType,
@@ -9251,7 +15338,7 @@ PFNGLWEIGHTPATHSNVPROC gl::gl_WeightPathsNV INIT_POINTER;
 void gl::WeightPathsNV  (GLuint resultPath, GLsizei numPaths, const GLuint *paths, const GLfloat *weights, const char* file, int line)
 {
 	TRACE_FUNCTION("glWeightPathsNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_WeightPathsNV(
+	TRACE_CALL(gl_WeightPathsNV)(
 		resultPath,
 		numPaths,
 		paths,
@@ -9263,7 +15350,7 @@ PFNGLPOLYGONMODENVPROC gl::gl_PolygonModeNV INIT_POINTER;
 void gl::PolygonModeNV  (GLenum face, GLenum mode, const char* file, int line)
 {
 	TRACE_FUNCTION("glPolygonModeNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PolygonModeNV(
+	TRACE_CALL(gl_PolygonModeNV)(
 		face,
 		mode);
 }
@@ -9273,7 +15360,7 @@ PFNGLREADBUFFERNVPROC gl::gl_ReadBufferNV INIT_POINTER;
 void gl::ReadBufferNV  (GLenum mode, const char* file, int line)
 {
 	TRACE_FUNCTION("glReadBufferNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ReadBufferNV(
+	TRACE_CALL(gl_ReadBufferNV)(
 		mode);
 }
 
@@ -9282,7 +15369,7 @@ PFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC gl::gl_FramebufferSampleLocationsfvNV IN
 void gl::FramebufferSampleLocationsfvNV  (GLenum target, GLuint start, GLsizei count, const GLfloat *v, const char* file, int line)
 {
 	TRACE_FUNCTION("glFramebufferSampleLocationsfvNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_FramebufferSampleLocationsfvNV(
+	TRACE_CALL(gl_FramebufferSampleLocationsfvNV)(
 		target,
 		start,
 		count,
@@ -9293,7 +15380,7 @@ PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC gl::gl_NamedFramebufferSampleLocati
 void gl::NamedFramebufferSampleLocationsfvNV  (GLuint framebuffer, GLuint start, GLsizei count, const GLfloat *v, const char* file, int line)
 {
 	TRACE_FUNCTION("glNamedFramebufferSampleLocationsfvNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_NamedFramebufferSampleLocationsfvNV(
+	TRACE_CALL(gl_NamedFramebufferSampleLocationsfvNV)(
 		framebuffer,
 		start,
 		count,
@@ -9304,7 +15391,7 @@ PFNGLRESOLVEDEPTHVALUESNVPROC gl::gl_ResolveDepthValuesNV INIT_POINTER;
 void gl::ResolveDepthValuesNV  (const char* file, int line)
 {
 	TRACE_FUNCTION("glResolveDepthValuesNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ResolveDepthValuesNV(
+	TRACE_CALL(gl_ResolveDepthValuesNV)(
 		);
 }
 
@@ -9313,7 +15400,7 @@ PFNGLDEPTHRANGEARRAYFVNVPROC gl::gl_DepthRangeArrayfvNV INIT_POINTER;
 void gl::DepthRangeArrayfvNV  (GLuint first, GLsizei count, const GLfloat *v, const char* file, int line)
 {
 	TRACE_FUNCTION("glDepthRangeArrayfvNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DepthRangeArrayfvNV(
+	TRACE_CALL(gl_DepthRangeArrayfvNV)(
 		first,
 		count,
 		v);
@@ -9323,7 +15410,7 @@ PFNGLDEPTHRANGEINDEXEDFNVPROC gl::gl_DepthRangeIndexedfNV INIT_POINTER;
 void gl::DepthRangeIndexedfNV  (GLuint index, GLfloat n, GLfloat f, const char* file, int line)
 {
 	TRACE_FUNCTION("glDepthRangeIndexedfNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DepthRangeIndexedfNV(
+	TRACE_CALL(gl_DepthRangeIndexedfNV)(
 		index,
 		n,
 		f);
@@ -9333,7 +15420,7 @@ PFNGLDISABLEINVPROC gl::gl_DisableiNV INIT_POINTER;
 void gl::DisableiNV  (GLenum target, GLuint index, const char* file, int line)
 {
 	TRACE_FUNCTION("glDisableiNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DisableiNV(
+	TRACE_CALL(gl_DisableiNV)(
 		target,
 		index);
 }
@@ -9342,7 +15429,7 @@ PFNGLENABLEINVPROC gl::gl_EnableiNV INIT_POINTER;
 void gl::EnableiNV  (GLenum target, GLuint index, const char* file, int line)
 {
 	TRACE_FUNCTION("glEnableiNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_EnableiNV(
+	TRACE_CALL(gl_EnableiNV)(
 		target,
 		index);
 }
@@ -9351,7 +15438,7 @@ PFNGLGETFLOATI_VNVPROC gl::gl_GetFloati_vNV INIT_POINTER;
 void gl::GetFloati_vNV  (GLenum target, GLuint index, GLfloat *data, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetFloati_vNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetFloati_vNV(
+	TRACE_CALL(gl_GetFloati_vNV)(
 		target,
 		index,
 		data);
@@ -9361,7 +15448,7 @@ PFNGLISENABLEDINVPROC gl::gl_IsEnablediNV INIT_POINTER;
 GLboolean gl::IsEnablediNV  (GLenum target, GLuint index, const char* file, int line)
 {
 	TRACE_FUNCTION("glIsEnablediNV(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_IsEnablediNV(
+	return TRACE_CALL(gl_IsEnablediNV)(
 		target,
 		index);
 }
@@ -9370,7 +15457,7 @@ PFNGLSCISSORARRAYVNVPROC gl::gl_ScissorArrayvNV INIT_POINTER;
 void gl::ScissorArrayvNV  (GLuint first, GLsizei count, const GLint *v, const char* file, int line)
 {
 	TRACE_FUNCTION("glScissorArrayvNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ScissorArrayvNV(
+	TRACE_CALL(gl_ScissorArrayvNV)(
 		first,
 		count,
 		v);
@@ -9380,7 +15467,7 @@ PFNGLSCISSORINDEXEDNVPROC gl::gl_ScissorIndexedNV INIT_POINTER;
 void gl::ScissorIndexedNV  (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height, const char* file, int line)
 {
 	TRACE_FUNCTION("glScissorIndexedNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ScissorIndexedNV(
+	TRACE_CALL(gl_ScissorIndexedNV)(
 		index,
 		left,
 		bottom,
@@ -9392,7 +15479,7 @@ PFNGLSCISSORINDEXEDVNVPROC gl::gl_ScissorIndexedvNV INIT_POINTER;
 void gl::ScissorIndexedvNV  (GLuint index, const GLint *v, const char* file, int line)
 {
 	TRACE_FUNCTION("glScissorIndexedvNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ScissorIndexedvNV(
+	TRACE_CALL(gl_ScissorIndexedvNV)(
 		index,
 		v);
 }
@@ -9401,7 +15488,7 @@ PFNGLVIEWPORTARRAYVNVPROC gl::gl_ViewportArrayvNV INIT_POINTER;
 void gl::ViewportArrayvNV  (GLuint first, GLsizei count, const GLfloat *v, const char* file, int line)
 {
 	TRACE_FUNCTION("glViewportArrayvNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ViewportArrayvNV(
+	TRACE_CALL(gl_ViewportArrayvNV)(
 		first,
 		count,
 		v);
@@ -9411,7 +15498,7 @@ PFNGLVIEWPORTINDEXEDFNVPROC gl::gl_ViewportIndexedfNV INIT_POINTER;
 void gl::ViewportIndexedfNV  (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h, const char* file, int line)
 {
 	TRACE_FUNCTION("glViewportIndexedfNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ViewportIndexedfNV(
+	TRACE_CALL(gl_ViewportIndexedfNV)(
 		index,
 		x,
 		y,
@@ -9423,7 +15510,7 @@ PFNGLVIEWPORTINDEXEDFVNVPROC gl::gl_ViewportIndexedfvNV INIT_POINTER;
 void gl::ViewportIndexedfvNV  (GLuint index, const GLfloat *v, const char* file, int line)
 {
 	TRACE_FUNCTION("glViewportIndexedfvNV(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ViewportIndexedfvNV(
+	TRACE_CALL(gl_ViewportIndexedfvNV)(
 		index,
 		v);
 }
@@ -9433,18 +15520,25 @@ PFNGLEGLIMAGETARGETRENDERBUFFERSTORAGEOESPROC gl::gl_EGLImageTargetRenderbufferS
 void gl::EGLImageTargetRenderbufferStorageOES  (GLenum target, GLeglImageOES image, const char* file, int line)
 {
 	TRACE_FUNCTION("glEGLImageTargetRenderbufferStorageOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_EGLImageTargetRenderbufferStorageOES(
+	TRACE_CALL(gl_EGLImageTargetRenderbufferStorageOES)(
 		target,
 		image);
+
+	// new storage the debugger can't see
+	setFramebuffersDirty(GL_RENDERBUFFER, _bound_renderbuffer);
 }
 
 PFNGLEGLIMAGETARGETTEXTURE2DOESPROC gl::gl_EGLImageTargetTexture2DOES INIT_POINTER;
 void gl::EGLImageTargetTexture2DOES  (GLenum target, GLeglImageOES image, const char* file, int line)
 {
 	TRACE_FUNCTION("glEGLImageTargetTexture2DOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_EGLImageTargetTexture2DOES(
+	TRACE_CALL(gl_EGLImageTargetTexture2DOES)(
 		target,
 		image);
+
+	// new storage the debugger can't see
+	if (const Texture_t* texture = getBoundTexture(target))
+		setFramebuffersDirty(GL_TEXTURE, texture->id);
 }
 
 // GL_OES_copy_image
@@ -9452,7 +15546,7 @@ PFNGLCOPYIMAGESUBDATAOESPROC gl::gl_CopyImageSubDataOES INIT_POINTER;
 void gl::CopyImageSubDataOES  (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth, const char* file, int line)
 {
 	TRACE_FUNCTION("glCopyImageSubDataOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CopyImageSubDataOES(
+	TRACE_CALL(gl_CopyImageSubDataOES)(
 		srcName,
 		srcTarget,
 		srcLevel,
@@ -9475,7 +15569,7 @@ PFNGLBLENDEQUATIONSEPARATEIOESPROC gl::gl_BlendEquationSeparateiOES INIT_POINTER
 void gl::BlendEquationSeparateiOES  (GLuint buf, GLenum modeRGB, GLenum modeAlpha, const char* file, int line)
 {
 	TRACE_FUNCTION("glBlendEquationSeparateiOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BlendEquationSeparateiOES(
+	TRACE_CALL(gl_BlendEquationSeparateiOES)(
 		buf,
 		modeRGB,
 		modeAlpha);
@@ -9485,7 +15579,7 @@ PFNGLBLENDEQUATIONIOESPROC gl::gl_BlendEquationiOES INIT_POINTER;
 void gl::BlendEquationiOES  (GLuint buf, GLenum mode, const char* file, int line)
 {
 	TRACE_FUNCTION("glBlendEquationiOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BlendEquationiOES(
+	TRACE_CALL(gl_BlendEquationiOES)(
 		buf,
 		mode);
 }
@@ -9494,7 +15588,7 @@ PFNGLBLENDFUNCSEPARATEIOESPROC gl::gl_BlendFuncSeparateiOES INIT_POINTER;
 void gl::BlendFuncSeparateiOES  (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha, const char* file, int line)
 {
 	TRACE_FUNCTION("glBlendFuncSeparateiOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BlendFuncSeparateiOES(
+	TRACE_CALL(gl_BlendFuncSeparateiOES)(
 		buf,
 		srcRGB,
 		dstRGB,
@@ -9506,7 +15600,7 @@ PFNGLBLENDFUNCIOESPROC gl::gl_BlendFunciOES INIT_POINTER;
 void gl::BlendFunciOES  (GLuint buf, GLenum src, GLenum dst, const char* file, int line)
 {
 	TRACE_FUNCTION("glBlendFunciOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BlendFunciOES(
+	TRACE_CALL(gl_BlendFunciOES)(
 		buf,
 		src,
 		dst);
@@ -9516,7 +15610,7 @@ PFNGLCOLORMASKIOESPROC gl::gl_ColorMaskiOES INIT_POINTER;
 void gl::ColorMaskiOES  (GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a, const char* file, int line)
 {
 	TRACE_FUNCTION("glColorMaskiOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ColorMaskiOES(
+	TRACE_CALL(gl_ColorMaskiOES)(
 		index,
 		r,
 		g,
@@ -9528,7 +15622,7 @@ PFNGLDISABLEIOESPROC gl::gl_DisableiOES INIT_POINTER;
 void gl::DisableiOES  (GLenum target, GLuint index, const char* file, int line)
 {
 	TRACE_FUNCTION("glDisableiOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DisableiOES(
+	TRACE_CALL(gl_DisableiOES)(
 		target,
 		index);
 }
@@ -9537,7 +15631,7 @@ PFNGLENABLEIOESPROC gl::gl_EnableiOES INIT_POINTER;
 void gl::EnableiOES  (GLenum target, GLuint index, const char* file, int line)
 {
 	TRACE_FUNCTION("glEnableiOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_EnableiOES(
+	TRACE_CALL(gl_EnableiOES)(
 		target,
 		index);
 }
@@ -9546,7 +15640,7 @@ PFNGLISENABLEDIOESPROC gl::gl_IsEnablediOES INIT_POINTER;
 GLboolean gl::IsEnablediOES  (GLenum target, GLuint index, const char* file, int line)
 {
 	TRACE_FUNCTION("glIsEnablediOES(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_IsEnablediOES(
+	return TRACE_CALL(gl_IsEnablediOES)(
 		target,
 		index);
 }
@@ -9556,7 +15650,7 @@ PFNGLDRAWELEMENTSBASEVERTEXOESPROC gl::gl_DrawElementsBaseVertexOES INIT_POINTER
 void gl::DrawElementsBaseVertexOES  (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex, const char* file, int line)
 {
 	TRACE_FUNCTION("glDrawElementsBaseVertexOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DrawElementsBaseVertexOES(
+	TRACE_CALL(gl_DrawElementsBaseVertexOES)(
 		mode,
 		count,
 		type,
@@ -9568,7 +15662,7 @@ PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXOESPROC gl::gl_DrawElementsInstancedBaseVert
 void gl::DrawElementsInstancedBaseVertexOES  (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, const char* file, int line)
 {
 	TRACE_FUNCTION("glDrawElementsInstancedBaseVertexOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DrawElementsInstancedBaseVertexOES(
+	TRACE_CALL(gl_DrawElementsInstancedBaseVertexOES)(
 		mode,
 		count,
 		type,
@@ -9581,7 +15675,7 @@ PFNGLDRAWRANGEELEMENTSBASEVERTEXOESPROC gl::gl_DrawRangeElementsBaseVertexOES IN
 void gl::DrawRangeElementsBaseVertexOES  (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex, const char* file, int line)
 {
 	TRACE_FUNCTION("glDrawRangeElementsBaseVertexOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DrawRangeElementsBaseVertexOES(
+	TRACE_CALL(gl_DrawRangeElementsBaseVertexOES)(
 		mode,
 		start,
 		end,
@@ -9595,7 +15689,7 @@ PFNGLMULTIDRAWELEMENTSBASEVERTEXOESPROC gl::gl_MultiDrawElementsBaseVertexOES IN
 void gl::MultiDrawElementsBaseVertexOES  (GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei primcount, const GLint *basevertex, const char* file, int line)
 {
 	TRACE_FUNCTION("glMultiDrawElementsBaseVertexOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MultiDrawElementsBaseVertexOES(
+	TRACE_CALL(gl_MultiDrawElementsBaseVertexOES)(
 		mode,
 		count,
 		type,
@@ -9609,7 +15703,7 @@ PFNGLFRAMEBUFFERTEXTUREOESPROC gl::gl_FramebufferTextureOES INIT_POINTER;
 void gl::FramebufferTextureOES  (GLenum target, GLenum attachment, GLuint texture, GLint level, const char* file, int line)
 {
 	TRACE_FUNCTION("glFramebufferTextureOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_FramebufferTextureOES(
+	TRACE_CALL(gl_FramebufferTextureOES)(
 		target,
 		attachment,
 		texture,
@@ -9621,7 +15715,7 @@ PFNGLGETPROGRAMBINARYOESPROC gl::gl_GetProgramBinaryOES INIT_POINTER;
 void gl::GetProgramBinaryOES  (GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetProgramBinaryOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetProgramBinaryOES(
+	TRACE_CALL(gl_GetProgramBinaryOES)(
 		program,
 		bufSize,
 		length,
@@ -9633,7 +15727,7 @@ PFNGLPROGRAMBINARYOESPROC gl::gl_ProgramBinaryOES INIT_POINTER;
 void gl::ProgramBinaryOES  (GLuint program, GLenum binaryFormat, const void *binary, GLint length, const char* file, int line)
 {
 	TRACE_FUNCTION("glProgramBinaryOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ProgramBinaryOES(
+	TRACE_CALL(gl_ProgramBinaryOES)(
 		program,
 		binaryFormat,
 		binary,
@@ -9645,27 +15739,66 @@ PFNGLGETBUFFERPOINTERVOESPROC gl::gl_GetBufferPointervOES INIT_POINTER;
 void gl::GetBufferPointervOES  (GLenum target, GLenum pname, void **params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetBufferPointervOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetBufferPointervOES(
+	TRACE_CALL(gl_GetBufferPointervOES)(
 		target,
 		pname,
 		params);
 }
 
 PFNGLMAPBUFFEROESPROC gl::gl_MapBufferOES INIT_POINTER;
-void gl::MapBufferOES  (GLenum target, GLenum access, const char* file, int line)
+void* gl::MapBufferOES  (GLenum target, GLenum access, const char* file, int line)
 {
 	TRACE_FUNCTION("glMapBufferOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MapBufferOES(
+
+	const uint64_t start = Core::now();
+	void* pointer = TRACE_CALL(gl_MapBufferOES)(
 		target,
 		access);
+	const uint64_t time = Core::now() - start;
+
+	// the content is written outside of the debugger
+	if (target == GL_ARRAY_BUFFER || target == GL_ELEMENT_ARRAY_BUFFER)
+	{
+		const uint id = getBoundBufferId(target == GL_ARRAY_BUFFER ?
+			ARRAY_BUFFER : ELEMENT_ARRAY_BUFFER);
+
+		_shadow.release(getShadowKey(SHADOW_BUFFER, id));
+		invalidateIndexRanges(id);
+		invalidateUploadHashes(SHADOW_BUFFER, id);
+	}
+
+	const char* result = get_last_error();
+
+	// GL_WRITE_ONLY_OES : the whole buffer, synchronized
+	if (!result && pointer &&
+		(target == GL_ARRAY_BUFFER || target == GL_ELEMENT_ARRAY_BUFFER))
+	{
+		const uint ltarget = target == GL_ARRAY_BUFFER ? ARRAY_BUFFER :
+			ELEMENT_ARRAY_BUFFER;
+		const Buffer_t* buffer = _bound_buffer[ltarget];
+
+		beginMapping(ltarget, 0, buffer ? buffer->size : 0,
+			GL_MAP_WRITE_BIT_EXT, pointer, time, file, line);
+	}
+
+	breakOnError(!result, result);
+	return pointer;
 }
 
 PFNGLUNMAPBUFFEROESPROC gl::gl_UnmapBufferOES INIT_POINTER;
 GLboolean gl::UnmapBufferOES  (GLenum target, const char* file, int line)
 {
 	TRACE_FUNCTION("glUnmapBufferOES(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_UnmapBufferOES(
+	const GLboolean result = TRACE_CALL(gl_UnmapBufferOES)(
 		target);
+
+	if (target == GL_ARRAY_BUFFER || target == GL_ELEMENT_ARRAY_BUFFER)
+	{
+		endMapping(target == GL_ARRAY_BUFFER ? ARRAY_BUFFER :
+			ELEMENT_ARRAY_BUFFER, result);
+	}
+
+	return result;
 }
 
 // GL_OES_primitive_bounding_box
@@ -9673,7 +15806,7 @@ PFNGLPRIMITIVEBOUNDINGBOXOESPROC gl::gl_PrimitiveBoundingBoxOES INIT_POINTER;
 void gl::PrimitiveBoundingBoxOES  (GLfloat minX, GLfloat minY, GLfloat minZ, GLfloat minW, GLfloat maxX, GLfloat maxY, GLfloat maxZ, GLfloat maxW, const char* file, int line)
 {
 	TRACE_FUNCTION("glPrimitiveBoundingBoxOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PrimitiveBoundingBoxOES(
+	TRACE_CALL(gl_PrimitiveBoundingBoxOES)(
 		minX,
 		minY,
 		minZ,
@@ -9689,7 +15822,7 @@ PFNGLMINSAMPLESHADINGOESPROC gl::gl_MinSampleShadingOES INIT_POINTER;
 void gl::MinSampleShadingOES  (GLfloat value, const char* file, int line)
 {
 	TRACE_FUNCTION("glMinSampleShadingOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_MinSampleShadingOES(
+	TRACE_CALL(gl_MinSampleShadingOES)(
 		value);
 }
 
@@ -9698,7 +15831,7 @@ PFNGLPATCHPARAMETERIOESPROC gl::gl_PatchParameteriOES INIT_POINTER;
 void gl::PatchParameteriOES  (GLenum pname, GLint value, const char* file, int line)
 {
 	TRACE_FUNCTION("glPatchParameteriOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_PatchParameteriOES(
+	TRACE_CALL(gl_PatchParameteriOES)(
 		pname,
 		value);
 }
@@ -9708,7 +15841,7 @@ PFNGLCOMPRESSEDTEXIMAGE3DOESPROC gl::gl_CompressedTexImage3DOES INIT_POINTER;
 void gl::CompressedTexImage3DOES  (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data, const char* file, int line)
 {
 	TRACE_FUNCTION("glCompressedTexImage3DOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CompressedTexImage3DOES(
+	TRACE_CALL(gl_CompressedTexImage3DOES)(
 		target,
 		level,
 		internalformat,
@@ -9718,13 +15851,27 @@ void gl::CompressedTexImage3DOES  (GLenum target, GLint level, GLenum internalfo
 		border,
 		imageSize,
 		data);
+
+	const char* result = get_last_error();
+
+	if (!result)
+	{
+		if (data)
+			addUpload(UPLOAD_COMPRESSED_TEX_IMAGE_3D, imageSize, file, line);
+
+		setTextureLevel(target, level, internalformat, GL_NONE, width,
+			height, depth, imageSize > 0 ? imageSize :
+			getCompressedSize(internalformat, width, height, depth));
+	}
+
+	breakOnError(!result, result);
 }
 
 PFNGLCOMPRESSEDTEXSUBIMAGE3DOESPROC gl::gl_CompressedTexSubImage3DOES INIT_POINTER;
 void gl::CompressedTexSubImage3DOES  (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data, const char* file, int line)
 {
 	TRACE_FUNCTION("glCompressedTexSubImage3DOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CompressedTexSubImage3DOES(
+	TRACE_CALL(gl_CompressedTexSubImage3DOES)(
 		target,
 		level,
 		xoffset,
@@ -9736,13 +15883,20 @@ void gl::CompressedTexSubImage3DOES  (GLenum target, GLint level, GLint xoffset,
 		format,
 		imageSize,
 		data);
+
+	const char* result = get_last_error();
+
+	if (!result && data)
+		addUpload(UPLOAD_COMPRESSED_TEX_SUB_IMAGE_3D, imageSize, file, line);
+
+	breakOnError(!result, result);
 }
 
 PFNGLCOPYTEXSUBIMAGE3DOESPROC gl::gl_CopyTexSubImage3DOES INIT_POINTER;
 void gl::CopyTexSubImage3DOES  (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height, const char* file, int line)
 {
 	TRACE_FUNCTION("glCopyTexSubImage3DOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_CopyTexSubImage3DOES(
+	TRACE_CALL(gl_CopyTexSubImage3DOES)(
 		target,
 		level,
 		xoffset,
@@ -9758,7 +15912,7 @@ PFNGLFRAMEBUFFERTEXTURE3DOESPROC gl::gl_FramebufferTexture3DOES INIT_POINTER;
 void gl::FramebufferTexture3DOES  (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset, const char* file, int line)
 {
 	TRACE_FUNCTION("glFramebufferTexture3DOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_FramebufferTexture3DOES(
+	TRACE_CALL(gl_FramebufferTexture3DOES)(
 		target,
 		attachment,
 		textarget,
@@ -9771,7 +15925,7 @@ PFNGLTEXIMAGE3DOESPROC gl::gl_TexImage3DOES INIT_POINTER;
 void gl::TexImage3DOES  (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels, const char* file, int line)
 {
 	TRACE_FUNCTION("glTexImage3DOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TexImage3DOES(
+	TRACE_CALL(gl_TexImage3DOES)(
 		target,
 		level,
 		internalformat,
@@ -9782,13 +15936,27 @@ void gl::TexImage3DOES  (GLenum target, GLint level, GLenum internalformat, GLsi
 		format,
 		type,
 		pixels);
+
+	const char* result = get_last_error();
+
+	if (!result)
+	{
+		if (pixels)
+			addUpload(UPLOAD_TEX_IMAGE_3D,
+				getImageSize(width, height, depth, format, type), file, line);
+
+		setTextureLevel(target, level, internalformat, type, width, height,
+			depth, getLevelSize(internalformat, type, width, height, depth));
+	}
+
+	breakOnError(!result, result);
 }
 
 PFNGLTEXSUBIMAGE3DOESPROC gl::gl_TexSubImage3DOES INIT_POINTER;
 void gl::TexSubImage3DOES  (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels, const char* file, int line)
 {
 	TRACE_FUNCTION("glTexSubImage3DOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TexSubImage3DOES(
+	TRACE_CALL(gl_TexSubImage3DOES)(
 		target,
 		level,
 		xoffset,
@@ -9800,6 +15968,14 @@ void gl::TexSubImage3DOES  (GLenum target, GLint level, GLint xoffset, GLint yof
 		format,
 		type,
 		pixels);
+
+	const char* result = get_last_error();
+
+	if (!result && pixels)
+		addUpload(UPLOAD_TEX_SUB_IMAGE_3D,
+			getImageSize(width, height, depth, format, type), file, line);
+
+	breakOnError(!result, result);
 }
 
 // GL_OES_texture_border_clamp
@@ -9807,7 +15983,7 @@ PFNGLGETSAMPLERPARAMETERIIVOESPROC gl::gl_GetSamplerParameterIivOES INIT_POINTER
 void gl::GetSamplerParameterIivOES  (GLuint sampler, GLenum pname, GLint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetSamplerParameterIivOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetSamplerParameterIivOES(
+	TRACE_CALL(gl_GetSamplerParameterIivOES)(
 		sampler,
 		pname,
 		params);
@@ -9817,7 +15993,7 @@ PFNGLGETSAMPLERPARAMETERIUIVOESPROC gl::gl_GetSamplerParameterIuivOES INIT_POINT
 void gl::GetSamplerParameterIuivOES  (GLuint sampler, GLenum pname, GLuint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetSamplerParameterIuivOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetSamplerParameterIuivOES(
+	TRACE_CALL(gl_GetSamplerParameterIuivOES)(
 		sampler,
 		pname,
 		params);
@@ -9827,7 +16003,7 @@ PFNGLGETTEXPARAMETERIIVOESPROC gl::gl_GetTexParameterIivOES INIT_POINTER;
 void gl::GetTexParameterIivOES  (GLenum target, GLenum pname, GLint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetTexParameterIivOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetTexParameterIivOES(
+	TRACE_CALL(gl_GetTexParameterIivOES)(
 		target,
 		pname,
 		params);
@@ -9837,7 +16013,7 @@ PFNGLGETTEXPARAMETERIUIVOESPROC gl::gl_GetTexParameterIuivOES INIT_POINTER;
 void gl::GetTexParameterIuivOES  (GLenum target, GLenum pname, GLuint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetTexParameterIuivOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetTexParameterIuivOES(
+	TRACE_CALL(gl_GetTexParameterIuivOES)(
 		target,
 		pname,
 		params);
@@ -9847,7 +16023,7 @@ PFNGLSAMPLERPARAMETERIIVOESPROC gl::gl_SamplerParameterIivOES INIT_POINTER;
 void gl::SamplerParameterIivOES  (GLuint sampler, GLenum pname, const GLint *param, const char* file, int line)
 {
 	TRACE_FUNCTION("glSamplerParameterIivOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_SamplerParameterIivOES(
+	TRACE_CALL(gl_SamplerParameterIivOES)(
 		sampler,
 		pname,
 		param);
@@ -9857,7 +16033,7 @@ PFNGLSAMPLERPARAMETERIUIVOESPROC gl::gl_SamplerParameterIuivOES INIT_POINTER;
 void gl::SamplerParameterIuivOES  (GLuint sampler, GLenum pname, const GLuint *param, const char* file, int line)
 {
 	TRACE_FUNCTION("glSamplerParameterIuivOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_SamplerParameterIuivOES(
+	TRACE_CALL(gl_SamplerParameterIuivOES)(
 		sampler,
 		pname,
 		param);
@@ -9867,7 +16043,7 @@ PFNGLTEXPARAMETERIIVOESPROC gl::gl_TexParameterIivOES INIT_POINTER;
 void gl::TexParameterIivOES  (GLenum target, GLenum pname, const GLint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glTexParameterIivOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TexParameterIivOES(
+	TRACE_CALL(gl_TexParameterIivOES)(
 		target,
 		pname,
 		params);
@@ -9877,7 +16053,7 @@ PFNGLTEXPARAMETERIUIVOESPROC gl::gl_TexParameterIuivOES INIT_POINTER;
 void gl::TexParameterIuivOES  (GLenum target, GLenum pname, const GLuint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glTexParameterIuivOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TexParameterIuivOES(
+	TRACE_CALL(gl_TexParameterIuivOES)(
 		target,
 		pname,
 		params);
@@ -9888,7 +16064,7 @@ PFNGLTEXBUFFEROESPROC gl::gl_TexBufferOES INIT_POINTER;
 void gl::TexBufferOES  (GLenum target, GLenum internalformat, GLuint buffer, const char* file, int line)
 {
 	TRACE_FUNCTION("glTexBufferOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TexBufferOES(
+	TRACE_CALL(gl_TexBufferOES)(
 		target,
 		internalformat,
 		buffer);
@@ -9898,7 +16074,7 @@ PFNGLTEXBUFFERRANGEOESPROC gl::gl_TexBufferRangeOES INIT_POINTER;
 void gl::TexBufferRangeOES  (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size, const char* file, int line)
 {
 	TRACE_FUNCTION("glTexBufferRangeOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TexBufferRangeOES(
+	TRACE_CALL(gl_TexBufferRangeOES)(
 		target,
 		internalformat,
 		buffer,
@@ -9911,7 +16087,7 @@ PFNGLTEXSTORAGE3DMULTISAMPLEOESPROC gl::gl_TexStorage3DMultisampleOES INIT_POINT
 void gl::TexStorage3DMultisampleOES  (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations, const char* file, int line)
 {
 	TRACE_FUNCTION("glTexStorage3DMultisampleOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TexStorage3DMultisampleOES(
+	TRACE_CALL(gl_TexStorage3DMultisampleOES)(
 		target,
 		samples,
 		internalformat,
@@ -9926,7 +16102,7 @@ PFNGLTEXTUREVIEWOESPROC gl::gl_TextureViewOES INIT_POINTER;
 void gl::TextureViewOES  (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers, const char* file, int line)
 {
 	TRACE_FUNCTION("glTextureViewOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_TextureViewOES(
+	TRACE_CALL(gl_TextureViewOES)(
 		texture,
 		target,
 		origtexture,
@@ -9942,33 +16118,61 @@ PFNGLBINDVERTEXARRAYOESPROC gl::gl_BindVertexArrayOES INIT_POINTER;
 void gl::BindVertexArrayOES  (GLuint array, const char* file, int line)
 {
 	TRACE_FUNCTION("glBindVertexArrayOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_BindVertexArrayOES(
+	TRACE_CALL(gl_BindVertexArrayOES)(
 		array);
+
+	const char* result = get_last_error();
+
+	if (!result)
+		bindVertexArray(array);
+
+	breakOnError(!result, result);
 }
 
 PFNGLDELETEVERTEXARRAYSOESPROC gl::gl_DeleteVertexArraysOES INIT_POINTER;
 void gl::DeleteVertexArraysOES  (GLsizei n, const GLuint *arrays, const char* file, int line)
 {
 	TRACE_FUNCTION("glDeleteVertexArraysOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DeleteVertexArraysOES(
+	TRACE_CALL(gl_DeleteVertexArraysOES)(
 		n,
 		arrays);
+
+	const char* result = get_last_error();
+
+	for (GLsizei x = 0; !result && x < n; ++x)
+	{
+		// deleting the bound array binds the default one
+		if (arrays[x] && arrays[x] == _bound_vertex_array)
+			bindVertexArray(0);
+
+		if (arrays[x])
+			_vertex_arrays.erase(arrays[x]);
+	}
+
+	breakOnError(!result, result);
 }
 
 PFNGLGENVERTEXARRAYSOESPROC gl::gl_GenVertexArraysOES INIT_POINTER;
 void gl::GenVertexArraysOES  (GLsizei n, GLuint *arrays, const char* file, int line)
 {
 	TRACE_FUNCTION("glGenVertexArraysOES(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GenVertexArraysOES(
+	TRACE_CALL(gl_GenVertexArraysOES)(
 		n,
 		arrays);
+
+	const char* result = get_last_error();
+
+	for (GLsizei x = 0; !result && x < n; ++x)
+		_vertex_arrays[arrays[x]] = VertexArray_t();
+
+	breakOnError(!result, result);
 }
 
 PFNGLISVERTEXARRAYOESPROC gl::gl_IsVertexArrayOES INIT_POINTER;
 GLboolean gl::IsVertexArrayOES  (GLuint array, const char* file, int line)
 {
 	TRACE_FUNCTION("glIsVertexArrayOES(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_IsVertexArrayOES(
+	return TRACE_CALL(gl_IsVertexArrayOES)(
 		array);
 }
 
@@ -9977,7 +16181,7 @@ PFNGLFRAMEBUFFERTEXTUREMULTIVIEWOVRPROC gl::gl_FramebufferTextureMultiviewOVR IN
 void gl::FramebufferTextureMultiviewOVR  (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint baseViewIndex, GLsizei numViews, const char* file, int line)
 {
 	TRACE_FUNCTION("glFramebufferTextureMultiviewOVR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_FramebufferTextureMultiviewOVR(
+	TRACE_CALL(gl_FramebufferTextureMultiviewOVR)(
 		target,
 		attachment,
 		texture,
@@ -9991,7 +16195,7 @@ PFNGLFRAMEBUFFERTEXTUREMULTISAMPLEMULTIVIEWOVRPROC gl::gl_FramebufferTextureMult
 void gl::FramebufferTextureMultisampleMultiviewOVR  (GLenum target, GLenum attachment, GLuint texture, GLint level, GLsizei samples, GLint baseViewIndex, GLsizei numViews, const char* file, int line)
 {
 	TRACE_FUNCTION("glFramebufferTextureMultisampleMultiviewOVR(...) called from " << get_path(file) << '(' << line << ')');
-	gl_FramebufferTextureMultisampleMultiviewOVR(
+	TRACE_CALL(gl_FramebufferTextureMultisampleMultiviewOVR)(
 		target,
 		attachment,
 		texture,
@@ -10006,7 +16210,7 @@ PFNGLALPHAFUNCQCOMPROC gl::gl_AlphaFuncQCOM INIT_POINTER;
 void gl::AlphaFuncQCOM  (GLenum func, GLclampf ref, const char* file, int line)
 {
 	TRACE_FUNCTION("glAlphaFuncQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_AlphaFuncQCOM(
+	TRACE_CALL(gl_AlphaFuncQCOM)(
 		func,
 		ref);
 }
@@ -10016,7 +16220,7 @@ PFNGLDISABLEDRIVERCONTROLQCOMPROC gl::gl_DisableDriverControlQCOM INIT_POINTER;
 void gl::DisableDriverControlQCOM  (GLuint driverControl, const char* file, int line)
 {
 	TRACE_FUNCTION("glDisableDriverControlQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_DisableDriverControlQCOM(
+	TRACE_CALL(gl_DisableDriverControlQCOM)(
 		driverControl);
 }
 
@@ -10024,7 +16228,7 @@ PFNGLENABLEDRIVERCONTROLQCOMPROC gl::gl_EnableDriverControlQCOM INIT_POINTER;
 void gl::EnableDriverControlQCOM  (GLuint driverControl, const char* file, int line)
 {
 	TRACE_FUNCTION("glEnableDriverControlQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_EnableDriverControlQCOM(
+	TRACE_CALL(gl_EnableDriverControlQCOM)(
 		driverControl);
 }
 
@@ -10032,7 +16236,7 @@ PFNGLGETDRIVERCONTROLSTRINGQCOMPROC gl::gl_GetDriverControlStringQCOM INIT_POINT
 void gl::GetDriverControlStringQCOM  (GLuint driverControl, GLsizei bufSize, GLsizei *length, GLchar *driverControlString, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetDriverControlStringQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetDriverControlStringQCOM(
+	TRACE_CALL(gl_GetDriverControlStringQCOM)(
 		driverControl,
 		bufSize,
 		length,
@@ -10043,7 +16247,7 @@ PFNGLGETDRIVERCONTROLSQCOMPROC gl::gl_GetDriverControlsQCOM INIT_POINTER;
 void gl::GetDriverControlsQCOM  (GLint *num, GLsizei size, GLuint *driverControls, const char* file, int line)
 {
 	TRACE_FUNCTION("glGetDriverControlsQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_GetDriverControlsQCOM(
+	TRACE_CALL(gl_GetDriverControlsQCOM)(
 		num,
 		size,
 		driverControls);
@@ -10054,7 +16258,7 @@ PFNGLEXTGETBUFFERPOINTERVQCOMPROC gl::gl_ExtGetBufferPointervQCOM INIT_POINTER;
 void gl::ExtGetBufferPointervQCOM  (GLenum target, void **params, const char* file, int line)
 {
 	TRACE_FUNCTION("glExtGetBufferPointervQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ExtGetBufferPointervQCOM(
+	TRACE_CALL(gl_ExtGetBufferPointervQCOM)(
 		target,
 		params);
 }
@@ -10063,7 +16267,7 @@ PFNGLEXTGETBUFFERSQCOMPROC gl::gl_ExtGetBuffersQCOM INIT_POINTER;
 void gl::ExtGetBuffersQCOM  (GLuint *buffers, GLint maxBuffers, GLint *numBuffers, const char* file, int line)
 {
 	TRACE_FUNCTION("glExtGetBuffersQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ExtGetBuffersQCOM(
+	TRACE_CALL(gl_ExtGetBuffersQCOM)(
 		buffers,
 		maxBuffers,
 		numBuffers);
@@ -10073,7 +16277,7 @@ PFNGLEXTGETFRAMEBUFFERSQCOMPROC gl::gl_ExtGetFramebuffersQCOM INIT_POINTER;
 void gl::ExtGetFramebuffersQCOM  (GLuint *framebuffers, GLint maxFramebuffers, GLint *numFramebuffers, const char* file, int line)
 {
 	TRACE_FUNCTION("glExtGetFramebuffersQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ExtGetFramebuffersQCOM(
+	TRACE_CALL(gl_ExtGetFramebuffersQCOM)(
 		framebuffers,
 		maxFramebuffers,
 		numFramebuffers);
@@ -10083,7 +16287,7 @@ PFNGLEXTGETRENDERBUFFERSQCOMPROC gl::gl_ExtGetRenderbuffersQCOM INIT_POINTER;
 void gl::ExtGetRenderbuffersQCOM  (GLuint *renderbuffers, GLint maxRenderbuffers, GLint *numRenderbuffers, const char* file, int line)
 {
 	TRACE_FUNCTION("glExtGetRenderbuffersQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ExtGetRenderbuffersQCOM(
+	TRACE_CALL(gl_ExtGetRenderbuffersQCOM)(
 		renderbuffers,
 		maxRenderbuffers,
 		numRenderbuffers);
@@ -10093,7 +16297,7 @@ PFNGLEXTGETTEXLEVELPARAMETERIVQCOMPROC gl::gl_ExtGetTexLevelParameterivQCOM INIT
 void gl::ExtGetTexLevelParameterivQCOM  (GLuint texture, GLenum face, GLint level, GLenum pname, GLint *params, const char* file, int line)
 {
 	TRACE_FUNCTION("glExtGetTexLevelParameterivQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ExtGetTexLevelParameterivQCOM(
+	TRACE_CALL(gl_ExtGetTexLevelParameterivQCOM)(
 		texture,
 		face,
 		level,
@@ -10105,7 +16309,7 @@ PFNGLEXTGETTEXSUBIMAGEQCOMPROC gl::gl_ExtGetTexSubImageQCOM INIT_POINTER;
 void gl::ExtGetTexSubImageQCOM  (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, void *texels, const char* file, int line)
 {
 	TRACE_FUNCTION("glExtGetTexSubImageQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ExtGetTexSubImageQCOM(
+	TRACE_CALL(gl_ExtGetTexSubImageQCOM)(
 		target,
 		level,
 		xoffset,
@@ -10123,7 +16327,7 @@ PFNGLEXTGETTEXTURESQCOMPROC gl::gl_ExtGetTexturesQCOM INIT_POINTER;
 void gl::ExtGetTexturesQCOM  (GLuint *textures, GLint maxTextures, GLint *numTextures, const char* file, int line)
 {
 	TRACE_FUNCTION("glExtGetTexturesQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ExtGetTexturesQCOM(
+	TRACE_CALL(gl_ExtGetTexturesQCOM)(
 		textures,
 		maxTextures,
 		numTextures);
@@ -10133,7 +16337,7 @@ PFNGLEXTTEXOBJECTSTATEOVERRIDEIQCOMPROC gl::gl_ExtTexObjectStateOverrideiQCOM IN
 void gl::ExtTexObjectStateOverrideiQCOM  (GLenum target, GLenum pname, GLint param, const char* file, int line)
 {
 	TRACE_FUNCTION("glExtTexObjectStateOverrideiQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ExtTexObjectStateOverrideiQCOM(
+	TRACE_CALL(gl_ExtTexObjectStateOverrideiQCOM)(
 		target,
 		pname,
 		param);
@@ -10144,7 +16348,7 @@ PFNGLEXTGETPROGRAMBINARYSOURCEQCOMPROC gl::gl_ExtGetProgramBinarySourceQCOM INIT
 void gl::ExtGetProgramBinarySourceQCOM  (GLuint program, GLenum shadertype, GLchar *source, GLint *length, const char* file, int line)
 {
 	TRACE_FUNCTION("glExtGetProgramBinarySourceQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ExtGetProgramBinarySourceQCOM(
+	TRACE_CALL(gl_ExtGetProgramBinarySourceQCOM)(
 		program,
 		shadertype,
 		source,
@@ -10155,7 +16359,7 @@ PFNGLEXTGETPROGRAMSQCOMPROC gl::gl_ExtGetProgramsQCOM INIT_POINTER;
 void gl::ExtGetProgramsQCOM  (GLuint *programs, GLint maxPrograms, GLint *numPrograms, const char* file, int line)
 {
 	TRACE_FUNCTION("glExtGetProgramsQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ExtGetProgramsQCOM(
+	TRACE_CALL(gl_ExtGetProgramsQCOM)(
 		programs,
 		maxPrograms,
 		numPrograms);
@@ -10165,7 +16369,7 @@ PFNGLEXTGETSHADERSQCOMPROC gl::gl_ExtGetShadersQCOM INIT_POINTER;
 void gl::ExtGetShadersQCOM  (GLuint *shaders, GLint maxShaders, GLint *numShaders, const char* file, int line)
 {
 	TRACE_FUNCTION("glExtGetShadersQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_ExtGetShadersQCOM(
+	TRACE_CALL(gl_ExtGetShadersQCOM)(
 		shaders,
 		maxShaders,
 		numShaders);
@@ -10175,7 +16379,7 @@ PFNGLEXTISPROGRAMBINARYQCOMPROC gl::gl_ExtIsProgramBinaryQCOM INIT_POINTER;
 GLboolean gl::ExtIsProgramBinaryQCOM  (GLuint program, const char* file, int line)
 {
 	TRACE_FUNCTION("glExtIsProgramBinaryQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	return gl_ExtIsProgramBinaryQCOM(
+	return TRACE_CALL(gl_ExtIsProgramBinaryQCOM)(
 		program);
 }
 
@@ -10184,20 +16388,22 @@ PFNGLENDTILINGQCOMPROC gl::gl_EndTilingQCOM INIT_POINTER;
 void gl::EndTilingQCOM  (GLbitfield preserveMask, const char* file, int line)
 {
 	TRACE_FUNCTION("glEndTilingQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_EndTilingQCOM(
+	TRACE_CALL(gl_EndTilingQCOM)(
 		preserveMask);
+	endPassTiling(preserveMask);
 }
 
 PFNGLSTARTTILINGQCOMPROC gl::gl_StartTilingQCOM INIT_POINTER;
 void gl::StartTilingQCOM  (GLuint x, GLuint y, GLuint width, GLuint height, GLbitfield preserveMask, const char* file, int line)
 {
 	TRACE_FUNCTION("glStartTilingQCOM(...) called from " << get_path(file) << '(' << line << ')');
-	gl_StartTilingQCOM(
+	TRACE_CALL(gl_StartTilingQCOM)(
 		x,
 		y,
 		width,
 		height,
 		preserveMask);
+	startPassTiling(preserveMask);
 }
 
 // ---------------------------------------------------------------------
@@ -10209,7 +16415,7 @@ PFNEGLSETBLOBCACHEFUNCSANDROIDPROC gl::egl::egl_SetBlobCacheFuncsANDROID INIT_PO
 void gl::egl::SetBlobCacheFuncsANDROID  (EGLDisplay dpy, EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get, const char* file, int line)
 {
 	TRACE_FUNCTION("eglSetBlobCacheFuncsANDROID(...) called from " << get_path(file) << '(' << line << ')');
-	egl_SetBlobCacheFuncsANDROID(
+	TRACE_CALL(egl_SetBlobCacheFuncsANDROID)(
 		dpy,
 		set,
 		get);
@@ -10220,7 +16426,7 @@ PFNEGLCREATENATIVECLIENTBUFFERANDROIDPROC gl::egl::egl_CreateNativeClientBufferA
 EGLClientBuffer gl::egl::CreateNativeClientBufferANDROID  (const EGLint *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglCreateNativeClientBufferANDROID(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_CreateNativeClientBufferANDROID(
+	return TRACE_CALL(egl_CreateNativeClientBufferANDROID)(
 		attrib_list);
 }
 
@@ -10229,7 +16435,7 @@ PFNEGLDUPNATIVEFENCEFDANDROIDPROC gl::egl::egl_DupNativeFenceFDANDROID INIT_POIN
 EGLint gl::egl::DupNativeFenceFDANDROID  (EGLDisplay dpy, EGLSyncKHR sync, const char* file, int line)
 {
 	TRACE_FUNCTION("eglDupNativeFenceFDANDROID(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_DupNativeFenceFDANDROID(
+	return TRACE_CALL(egl_DupNativeFenceFDANDROID)(
 		dpy,
 		sync);
 }
@@ -10239,7 +16445,7 @@ PFNEGLPRESENTATIONTIMEANDROIDPROC gl::egl::egl_PresentationTimeANDROID INIT_POIN
 EGLBoolean gl::egl::PresentationTimeANDROID  (EGLDisplay dpy, EGLSurface surface, EGLnsecsANDROID time, const char* file, int line)
 {
 	TRACE_FUNCTION("eglPresentationTimeANDROID(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_PresentationTimeANDROID(
+	return TRACE_CALL(egl_PresentationTimeANDROID)(
 		dpy,
 		surface,
 		time);
@@ -10250,7 +16456,7 @@ PFNEGLQUERYSURFACEPOINTERANGLEPROC gl::egl::egl_QuerySurfacePointerANGLE INIT_PO
 EGLBoolean gl::egl::QuerySurfacePointerANGLE  (EGLDisplay dpy, EGLSurface surface, EGLint attribute, void **value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQuerySurfacePointerANGLE(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QuerySurfacePointerANGLE(
+	return TRACE_CALL(egl_QuerySurfacePointerANGLE)(
 		dpy,
 		surface,
 		attribute,
@@ -10262,7 +16468,7 @@ PFNEGLQUERYDEVICEATTRIBEXTPROC gl::egl::egl_QueryDeviceAttribEXT INIT_POINTER;
 EGLBoolean gl::egl::QueryDeviceAttribEXT  (EGLDeviceEXT device, EGLint attribute, EGLAttrib *value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryDeviceAttribEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryDeviceAttribEXT(
+	return TRACE_CALL(egl_QueryDeviceAttribEXT)(
 		device,
 		attribute,
 		value);
@@ -10272,7 +16478,7 @@ PFNEGLQUERYDEVICESTRINGEXTPROC gl::egl::egl_QueryDeviceStringEXT INIT_POINTER;
 const char* gl::egl::QueryDeviceStringEXT (EGLDeviceEXT device, EGLint name, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryDeviceStringEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryDeviceStringEXT(
+	return TRACE_CALL(egl_QueryDeviceStringEXT)(
 		device,
 		name);
 }
@@ -10281,7 +16487,7 @@ PFNEGLQUERYDEVICESEXTPROC gl::egl::egl_QueryDevicesEXT INIT_POINTER;
 EGLBoolean gl::egl::QueryDevicesEXT  (EGLint max_devices, EGLDeviceEXT *devices, EGLint *num_devices, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryDevicesEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryDevicesEXT(
+	return TRACE_CALL(egl_QueryDevicesEXT)(
 		max_devices,
 		devices,
 		num_devices);
@@ -10291,7 +16497,7 @@ PFNEGLQUERYDISPLAYATTRIBEXTPROC gl::egl::egl_QueryDisplayAttribEXT INIT_POINTER;
 EGLBoolean gl::egl::QueryDisplayAttribEXT  (EGLDisplay dpy, EGLint attribute, EGLAttrib *value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryDisplayAttribEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryDisplayAttribEXT(
+	return TRACE_CALL(egl_QueryDisplayAttribEXT)(
 		dpy,
 		attribute,
 		value);
@@ -10302,7 +16508,7 @@ PFNEGLGETOUTPUTLAYERSEXTPROC gl::egl::egl_GetOutputLayersEXT INIT_POINTER;
 EGLBoolean gl::egl::GetOutputLayersEXT  (EGLDisplay dpy, const EGLAttrib *attrib_list, EGLOutputLayerEXT *layers, EGLint max_layers, EGLint *num_layers, const char* file, int line)
 {
 	TRACE_FUNCTION("eglGetOutputLayersEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_GetOutputLayersEXT(
+	return TRACE_CALL(egl_GetOutputLayersEXT)(
 		dpy,
 		attrib_list,
 		layers,
@@ -10314,7 +16520,7 @@ PFNEGLGETOUTPUTPORTSEXTPROC gl::egl::egl_GetOutputPortsEXT INIT_POINTER;
 EGLBoolean gl::egl::GetOutputPortsEXT  (EGLDisplay dpy, const EGLAttrib *attrib_list, EGLOutputPortEXT *ports, EGLint max_ports, EGLint *num_ports, const char* file, int line)
 {
 	TRACE_FUNCTION("eglGetOutputPortsEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_GetOutputPortsEXT(
+	return TRACE_CALL(egl_GetOutputPortsEXT)(
 		dpy,
 		attrib_list,
 		ports,
@@ -10326,7 +16532,7 @@ PFNEGLOUTPUTLAYERATTRIBEXTPROC gl::egl::egl_OutputLayerAttribEXT INIT_POINTER;
 EGLBoolean gl::egl::OutputLayerAttribEXT  (EGLDisplay dpy, EGLOutputLayerEXT layer, EGLint attribute, EGLAttrib value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglOutputLayerAttribEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_OutputLayerAttribEXT(
+	return TRACE_CALL(egl_OutputLayerAttribEXT)(
 		dpy,
 		layer,
 		attribute,
@@ -10337,7 +16543,7 @@ PFNEGLOUTPUTPORTATTRIBEXTPROC gl::egl::egl_OutputPortAttribEXT INIT_POINTER;
 EGLBoolean gl::egl::OutputPortAttribEXT  (EGLDisplay dpy, EGLOutputPortEXT port, EGLint attribute, EGLAttrib value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglOutputPortAttribEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_OutputPortAttribEXT(
+	return TRACE_CALL(egl_OutputPortAttribEXT)(
 		dpy,
 		port,
 		attribute,
@@ -10348,7 +16554,7 @@ PFNEGLQUERYOUTPUTLAYERATTRIBEXTPROC gl::egl::egl_QueryOutputLayerAttribEXT INIT_
 EGLBoolean gl::egl::QueryOutputLayerAttribEXT  (EGLDisplay dpy, EGLOutputLayerEXT layer, EGLint attribute, EGLAttrib *value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryOutputLayerAttribEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryOutputLayerAttribEXT(
+	return TRACE_CALL(egl_QueryOutputLayerAttribEXT)(
 		dpy,
 		layer,
 		attribute,
@@ -10359,7 +16565,7 @@ PFNEGLQUERYOUTPUTLAYERSTRINGEXTPROC gl::egl::egl_QueryOutputLayerStringEXT INIT_
 const char* gl::egl::QueryOutputLayerStringEXT(EGLDisplay dpy, EGLOutputLayerEXT layer, EGLint name, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryOutputLayerStringEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryOutputLayerStringEXT(
+	return TRACE_CALL(egl_QueryOutputLayerStringEXT)(
 		dpy,
 		layer,
 		name);
@@ -10369,7 +16575,7 @@ PFNEGLQUERYOUTPUTPORTATTRIBEXTPROC gl::egl::egl_QueryOutputPortAttribEXT INIT_PO
 EGLBoolean gl::egl::QueryOutputPortAttribEXT  (EGLDisplay dpy, EGLOutputPortEXT port, EGLint attribute, EGLAttrib *value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryOutputPortAttribEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryOutputPortAttribEXT(
+	return TRACE_CALL(egl_QueryOutputPortAttribEXT)(
 		dpy,
 		port,
 		attribute,
@@ -10380,7 +16586,7 @@ PFNEGLQUERYOUTPUTPORTSTRINGEXTPROC gl::egl::egl_QueryOutputPortStringEXT INIT_PO
 const char* gl::egl::QueryOutputPortStringEXT (EGLDisplay dpy, EGLOutputPortEXT port, EGLint name, const char* file, int line)
 {
 	TRACE_FUNCTION("egl*EGLAPIENTRY(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryOutputPortStringEXT(
+	return TRACE_CALL(egl_QueryOutputPortStringEXT)(
 		dpy,
 		port,
 		name);
@@ -10391,7 +16597,7 @@ PFNEGLCREATEPLATFORMPIXMAPSURFACEEXTPROC gl::egl::egl_CreatePlatformPixmapSurfac
 EGLSurface gl::egl::CreatePlatformPixmapSurfaceEXT  (EGLDisplay dpy, EGLConfig config, void *native_pixmap, const EGLint *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglCreatePlatformPixmapSurfaceEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_CreatePlatformPixmapSurfaceEXT(
+	return TRACE_CALL(egl_CreatePlatformPixmapSurfaceEXT)(
 		dpy,
 		config,
 		native_pixmap,
@@ -10402,7 +16608,7 @@ PFNEGLCREATEPLATFORMWINDOWSURFACEEXTPROC gl::egl::egl_CreatePlatformWindowSurfac
 EGLSurface gl::egl::CreatePlatformWindowSurfaceEXT  (EGLDisplay dpy, EGLConfig config, void *native_window, const EGLint *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglCreatePlatformWindowSurfaceEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_CreatePlatformWindowSurfaceEXT(
+	return TRACE_CALL(egl_CreatePlatformWindowSurfaceEXT)(
 		dpy,
 		config,
 		native_window,
@@ -10413,7 +16619,7 @@ PFNEGLGETPLATFORMDISPLAYEXTPROC gl::egl::egl_GetPlatformDisplayEXT INIT_POINTER;
 EGLDisplay gl::egl::GetPlatformDisplayEXT  (EGLenum platform, void *native_display, const EGLint *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglGetPlatformDisplayEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_GetPlatformDisplayEXT(
+	return TRACE_CALL(egl_GetPlatformDisplayEXT)(
 		platform,
 		native_display,
 		attrib_list);
@@ -10424,7 +16630,7 @@ PFNEGLSTREAMCONSUMEROUTPUTEXTPROC gl::egl::egl_StreamConsumerOutputEXT INIT_POIN
 EGLBoolean gl::egl::StreamConsumerOutputEXT  (EGLDisplay dpy, EGLStreamKHR stream, EGLOutputLayerEXT layer, const char* file, int line)
 {
 	TRACE_FUNCTION("eglStreamConsumerOutputEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_StreamConsumerOutputEXT(
+	return TRACE_CALL(egl_StreamConsumerOutputEXT)(
 		dpy,
 		stream,
 		layer);
@@ -10435,7 +16641,9 @@ PFNEGLSWAPBUFFERSWITHDAMAGEEXTPROC gl::egl::egl_SwapBuffersWithDamageEXT INIT_PO
 EGLBoolean gl::egl::SwapBuffersWithDamageEXT  (EGLDisplay dpy, EGLSurface surface, EGLint *rects, EGLint n_rects, const char* file, int line)
 {
 	TRACE_FUNCTION("eglSwapBuffersWithDamageEXT(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_SwapBuffersWithDamageEXT(
+	addDamage(dpy, surface, rects, n_rects);
+
+	return TRACE_CALL(egl_SwapBuffersWithDamageEXT)(
 		dpy,
 		surface,
 		rects,
@@ -10447,7 +16655,7 @@ PFNEGLCREATEPIXMAPSURFACEHIPROC gl::egl::egl_CreatePixmapSurfaceHI INIT_POINTER;
 EGLSurface gl::egl::CreatePixmapSurfaceHI  (EGLDisplay dpy, EGLConfig config, struct EGLClientPixmapHI *pixmap, const char* file, int line)
 {
 	TRACE_FUNCTION("eglCreatePixmapSurfaceHI(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_CreatePixmapSurfaceHI(
+	return TRACE_CALL(egl_CreatePixmapSurfaceHI)(
 		dpy,
 		config,
 		pixmap);
@@ -10458,7 +16666,7 @@ PFNEGLCREATESYNC64KHRPROC gl::egl::egl_CreateSync64KHR INIT_POINTER;
 EGLSyncKHR gl::egl::CreateSync64KHR  (EGLDisplay dpy, EGLenum type, const EGLAttribKHR *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglCreateSync64KHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_CreateSync64KHR(
+	return TRACE_CALL(egl_CreateSync64KHR)(
 		dpy,
 		type,
 		attrib_list);
@@ -10469,7 +16677,7 @@ PFNEGLLABELOBJECTKHRPROC gl::egl::egl_LabelObjectKHR INIT_POINTER;
 EGLint gl::egl::LabelObjectKHR  (EGLDisplay display, EGLenum objectType, EGLObjectKHR object, EGLLabelKHR label, const char* file, int line)
 {
 	TRACE_FUNCTION("eglLabelObjectKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_LabelObjectKHR(
+	return TRACE_CALL(egl_LabelObjectKHR)(
 		display,
 		objectType,
 		object,
@@ -10480,7 +16688,7 @@ PFNEGLQUERYDEBUGKHRPROC gl::egl::egl_QueryDebugKHR INIT_POINTER;
 EGLBoolean gl::egl::QueryDebugKHR  (EGLint attribute, EGLAttrib *value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryDebugKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryDebugKHR(
+	return TRACE_CALL(egl_QueryDebugKHR)(
 		attribute,
 		value);
 }
@@ -10490,7 +16698,7 @@ PFNEGLCLIENTWAITSYNCKHRPROC gl::egl::egl_ClientWaitSyncKHR INIT_POINTER;
 EGLint gl::egl::ClientWaitSyncKHR  (EGLDisplay dpy, EGLSyncKHR sync, EGLint flags, EGLTimeKHR timeout, const char* file, int line)
 {
 	TRACE_FUNCTION("eglClientWaitSyncKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_ClientWaitSyncKHR(
+	return TRACE_CALL(egl_ClientWaitSyncKHR)(
 		dpy,
 		sync,
 		flags,
@@ -10501,7 +16709,7 @@ PFNEGLCREATESYNCKHRPROC gl::egl::egl_CreateSyncKHR INIT_POINTER;
 EGLSyncKHR gl::egl::CreateSyncKHR  (EGLDisplay dpy, EGLenum type, const EGLint *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglCreateSyncKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_CreateSyncKHR(
+	return TRACE_CALL(egl_CreateSyncKHR)(
 		dpy,
 		type,
 		attrib_list);
@@ -10511,7 +16719,7 @@ PFNEGLDESTROYSYNCKHRPROC gl::egl::egl_DestroySyncKHR INIT_POINTER;
 EGLBoolean gl::egl::DestroySyncKHR  (EGLDisplay dpy, EGLSyncKHR sync, const char* file, int line)
 {
 	TRACE_FUNCTION("eglDestroySyncKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_DestroySyncKHR(
+	return TRACE_CALL(egl_DestroySyncKHR)(
 		dpy,
 		sync);
 }
@@ -10520,7 +16728,7 @@ PFNEGLGETSYNCATTRIBKHRPROC gl::egl::egl_GetSyncAttribKHR INIT_POINTER;
 EGLBoolean gl::egl::GetSyncAttribKHR  (EGLDisplay dpy, EGLSyncKHR sync, EGLint attribute, EGLint *value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglGetSyncAttribKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_GetSyncAttribKHR(
+	return TRACE_CALL(egl_GetSyncAttribKHR)(
 		dpy,
 		sync,
 		attribute,
@@ -10532,7 +16740,7 @@ PFNEGLCREATEIMAGEKHRPROC gl::egl::egl_CreateImageKHR INIT_POINTER;
 EGLImageKHR gl::egl::CreateImageKHR  (EGLDisplay dpy, EGLContext ctx, EGLenum target, EGLClientBuffer buffer, const EGLint *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglCreateImageKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_CreateImageKHR(
+	return TRACE_CALL(egl_CreateImageKHR)(
 		dpy,
 		ctx,
 		target,
@@ -10544,7 +16752,7 @@ PFNEGLDESTROYIMAGEKHRPROC gl::egl::egl_DestroyImageKHR INIT_POINTER;
 EGLBoolean gl::egl::DestroyImageKHR  (EGLDisplay dpy, EGLImageKHR image, const char* file, int line)
 {
 	TRACE_FUNCTION("eglDestroyImageKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_DestroyImageKHR(
+	return TRACE_CALL(egl_DestroyImageKHR)(
 		dpy,
 		image);
 }
@@ -10554,7 +16762,7 @@ PFNEGLLOCKSURFACEKHRPROC gl::egl::egl_LockSurfaceKHR INIT_POINTER;
 EGLBoolean gl::egl::LockSurfaceKHR  (EGLDisplay dpy, EGLSurface surface, const EGLint *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglLockSurfaceKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_LockSurfaceKHR(
+	return TRACE_CALL(egl_LockSurfaceKHR)(
 		dpy,
 		surface,
 		attrib_list);
@@ -10564,7 +16772,7 @@ PFNEGLUNLOCKSURFACEKHRPROC gl::egl::egl_UnlockSurfaceKHR INIT_POINTER;
 EGLBoolean gl::egl::UnlockSurfaceKHR  (EGLDisplay dpy, EGLSurface surface, const char* file, int line)
 {
 	TRACE_FUNCTION("eglUnlockSurfaceKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_UnlockSurfaceKHR(
+	return TRACE_CALL(egl_UnlockSurfaceKHR)(
 		dpy,
 		surface);
 }
@@ -10574,7 +16782,7 @@ PFNEGLQUERYSURFACE64KHRPROC gl::egl::egl_QuerySurface64KHR INIT_POINTER;
 EGLBoolean gl::egl::QuerySurface64KHR  (EGLDisplay dpy, EGLSurface surface, EGLint attribute, EGLAttribKHR *value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQuerySurface64KHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QuerySurface64KHR(
+	return TRACE_CALL(egl_QuerySurface64KHR)(
 		dpy,
 		surface,
 		attribute,
@@ -10586,11 +16794,16 @@ PFNEGLSETDAMAGEREGIONKHRPROC gl::egl::egl_SetDamageRegionKHR INIT_POINTER;
 EGLBoolean gl::egl::SetDamageRegionKHR  (EGLDisplay dpy, EGLSurface surface, EGLint *rects, EGLint n_rects, const char* file, int line)
 {
 	TRACE_FUNCTION("eglSetDamageRegionKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_SetDamageRegionKHR(
+	const EGLBoolean result = TRACE_CALL(egl_SetDamageRegionKHR)(
 		dpy,
 		surface,
 		rects,
 		n_rects);
+
+	if (result)
+		setDamageRegion(rects, n_rects);
+
+	return result;
 }
 
 // EGL_KHR_reusable_sync
@@ -10598,7 +16811,7 @@ PFNEGLSIGNALSYNCKHRPROC gl::egl::egl_SignalSyncKHR INIT_POINTER;
 EGLBoolean gl::egl::SignalSyncKHR  (EGLDisplay dpy, EGLSyncKHR sync, EGLenum mode, const char* file, int line)
 {
 	TRACE_FUNCTION("eglSignalSyncKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_SignalSyncKHR(
+	return TRACE_CALL(egl_SignalSyncKHR)(
 		dpy,
 		sync,
 		mode);
@@ -10609,7 +16822,7 @@ PFNEGLCREATESTREAMKHRPROC gl::egl::egl_CreateStreamKHR INIT_POINTER;
 EGLStreamKHR gl::egl::CreateStreamKHR  (EGLDisplay dpy, const EGLint *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglCreateStreamKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_CreateStreamKHR(
+	return TRACE_CALL(egl_CreateStreamKHR)(
 		dpy,
 		attrib_list);
 }
@@ -10618,7 +16831,7 @@ PFNEGLDESTROYSTREAMKHRPROC gl::egl::egl_DestroyStreamKHR INIT_POINTER;
 EGLBoolean gl::egl::DestroyStreamKHR  (EGLDisplay dpy, EGLStreamKHR stream, const char* file, int line)
 {
 	TRACE_FUNCTION("eglDestroyStreamKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_DestroyStreamKHR(
+	return TRACE_CALL(egl_DestroyStreamKHR)(
 		dpy,
 		stream);
 }
@@ -10627,7 +16840,7 @@ PFNEGLQUERYSTREAMKHRPROC gl::egl::egl_QueryStreamKHR INIT_POINTER;
 EGLBoolean gl::egl::QueryStreamKHR  (EGLDisplay dpy, EGLStreamKHR stream, EGLenum attribute, EGLint *value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryStreamKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryStreamKHR(
+	return TRACE_CALL(egl_QueryStreamKHR)(
 		dpy,
 		stream,
 		attribute,
@@ -10638,7 +16851,7 @@ PFNEGLQUERYSTREAMU64KHRPROC gl::egl::egl_QueryStreamu64KHR INIT_POINTER;
 EGLBoolean gl::egl::QueryStreamu64KHR  (EGLDisplay dpy, EGLStreamKHR stream, EGLenum attribute, EGLuint64KHR *value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryStreamu64KHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryStreamu64KHR(
+	return TRACE_CALL(egl_QueryStreamu64KHR)(
 		dpy,
 		stream,
 		attribute,
@@ -10649,7 +16862,7 @@ PFNEGLSTREAMATTRIBKHRPROC gl::egl::egl_StreamAttribKHR INIT_POINTER;
 EGLBoolean gl::egl::StreamAttribKHR  (EGLDisplay dpy, EGLStreamKHR stream, EGLenum attribute, EGLint value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglStreamAttribKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_StreamAttribKHR(
+	return TRACE_CALL(egl_StreamAttribKHR)(
 		dpy,
 		stream,
 		attribute,
@@ -10661,7 +16874,7 @@ PFNEGLCREATESTREAMATTRIBKHRPROC gl::egl::egl_CreateStreamAttribKHR INIT_POINTER;
 EGLStreamKHR gl::egl::CreateStreamAttribKHR  (EGLDisplay dpy, const EGLAttrib *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglCreateStreamAttribKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_CreateStreamAttribKHR(
+	return TRACE_CALL(egl_CreateStreamAttribKHR)(
 		dpy,
 		attrib_list);
 }
@@ -10670,7 +16883,7 @@ PFNEGLQUERYSTREAMATTRIBKHRPROC gl::egl::egl_QueryStreamAttribKHR INIT_POINTER;
 EGLBoolean gl::egl::QueryStreamAttribKHR  (EGLDisplay dpy, EGLStreamKHR stream, EGLenum attribute, EGLAttrib *value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryStreamAttribKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryStreamAttribKHR(
+	return TRACE_CALL(egl_QueryStreamAttribKHR)(
 		dpy,
 		stream,
 		attribute,
@@ -10681,7 +16894,7 @@ PFNEGLSETSTREAMATTRIBKHRPROC gl::egl::egl_SetStreamAttribKHR INIT_POINTER;
 EGLBoolean gl::egl::SetStreamAttribKHR  (EGLDisplay dpy, EGLStreamKHR stream, EGLenum attribute, EGLAttrib value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglSetStreamAttribKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_SetStreamAttribKHR(
+	return TRACE_CALL(egl_SetStreamAttribKHR)(
 		dpy,
 		stream,
 		attribute,
@@ -10692,7 +16905,7 @@ PFNEGLSTREAMCONSUMERACQUIREATTRIBKHRPROC gl::egl::egl_StreamConsumerAcquireAttri
 EGLBoolean gl::egl::StreamConsumerAcquireAttribKHR  (EGLDisplay dpy, EGLStreamKHR stream, const EGLAttrib *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglStreamConsumerAcquireAttribKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_StreamConsumerAcquireAttribKHR(
+	return TRACE_CALL(egl_StreamConsumerAcquireAttribKHR)(
 		dpy,
 		stream,
 		attrib_list);
@@ -10702,7 +16915,7 @@ PFNEGLSTREAMCONSUMERRELEASEATTRIBKHRPROC gl::egl::egl_StreamConsumerReleaseAttri
 EGLBoolean gl::egl::StreamConsumerReleaseAttribKHR  (EGLDisplay dpy, EGLStreamKHR stream, const EGLAttrib *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglStreamConsumerReleaseAttribKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_StreamConsumerReleaseAttribKHR(
+	return TRACE_CALL(egl_StreamConsumerReleaseAttribKHR)(
 		dpy,
 		stream,
 		attrib_list);
@@ -10713,7 +16926,7 @@ PFNEGLSTREAMCONSUMERACQUIREKHRPROC gl::egl::egl_StreamConsumerAcquireKHR INIT_PO
 EGLBoolean gl::egl::StreamConsumerAcquireKHR  (EGLDisplay dpy, EGLStreamKHR stream, const char* file, int line)
 {
 	TRACE_FUNCTION("eglStreamConsumerAcquireKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_StreamConsumerAcquireKHR(
+	return TRACE_CALL(egl_StreamConsumerAcquireKHR)(
 		dpy,
 		stream);
 }
@@ -10722,7 +16935,7 @@ PFNEGLSTREAMCONSUMERGLTEXTUREEXTERNALKHRPROC gl::egl::egl_StreamConsumerGLTextur
 EGLBoolean gl::egl::StreamConsumerGLTextureExternalKHR  (EGLDisplay dpy, EGLStreamKHR stream, const char* file, int line)
 {
 	TRACE_FUNCTION("eglStreamConsumerGLTextureExternalKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_StreamConsumerGLTextureExternalKHR(
+	return TRACE_CALL(egl_StreamConsumerGLTextureExternalKHR)(
 		dpy,
 		stream);
 }
@@ -10731,7 +16944,7 @@ PFNEGLSTREAMCONSUMERRELEASEKHRPROC gl::egl::egl_StreamConsumerReleaseKHR INIT_PO
 EGLBoolean gl::egl::StreamConsumerReleaseKHR  (EGLDisplay dpy, EGLStreamKHR stream, const char* file, int line)
 {
 	TRACE_FUNCTION("eglStreamConsumerReleaseKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_StreamConsumerReleaseKHR(
+	return TRACE_CALL(egl_StreamConsumerReleaseKHR)(
 		dpy,
 		stream);
 }
@@ -10741,7 +16954,7 @@ PFNEGLCREATESTREAMFROMFILEDESCRIPTORKHRPROC gl::egl::egl_CreateStreamFromFileDes
 EGLStreamKHR gl::egl::CreateStreamFromFileDescriptorKHR  (EGLDisplay dpy, EGLNativeFileDescriptorKHR file_descriptor, const char* file, int line)
 {
 	TRACE_FUNCTION("eglCreateStreamFromFileDescriptorKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_CreateStreamFromFileDescriptorKHR(
+	return TRACE_CALL(egl_CreateStreamFromFileDescriptorKHR)(
 		dpy,
 		file_descriptor);
 }
@@ -10750,7 +16963,7 @@ PFNEGLGETSTREAMFILEDESCRIPTORKHRPROC gl::egl::egl_GetStreamFileDescriptorKHR INI
 EGLNativeFileDescriptorKHR gl::egl::GetStreamFileDescriptorKHR  (EGLDisplay dpy, EGLStreamKHR stream, const char* file, int line)
 {
 	TRACE_FUNCTION("eglGetStreamFileDescriptorKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_GetStreamFileDescriptorKHR(
+	return TRACE_CALL(egl_GetStreamFileDescriptorKHR)(
 		dpy,
 		stream);
 }
@@ -10760,7 +16973,7 @@ PFNEGLQUERYSTREAMTIMEKHRPROC gl::egl::egl_QueryStreamTimeKHR INIT_POINTER;
 EGLBoolean gl::egl::QueryStreamTimeKHR  (EGLDisplay dpy, EGLStreamKHR stream, EGLenum attribute, EGLTimeKHR *value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryStreamTimeKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryStreamTimeKHR(
+	return TRACE_CALL(egl_QueryStreamTimeKHR)(
 		dpy,
 		stream,
 		attribute,
@@ -10772,7 +16985,7 @@ PFNEGLCREATESTREAMPRODUCERSURFACEKHRPROC gl::egl::egl_CreateStreamProducerSurfac
 EGLSurface gl::egl::CreateStreamProducerSurfaceKHR  (EGLDisplay dpy, EGLConfig config, EGLStreamKHR stream, const EGLint *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglCreateStreamProducerSurfaceKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_CreateStreamProducerSurfaceKHR(
+	return TRACE_CALL(egl_CreateStreamProducerSurfaceKHR)(
 		dpy,
 		config,
 		stream,
@@ -10784,7 +16997,9 @@ PFNEGLSWAPBUFFERSWITHDAMAGEKHRPROC gl::egl::egl_SwapBuffersWithDamageKHR INIT_PO
 EGLBoolean gl::egl::SwapBuffersWithDamageKHR  (EGLDisplay dpy, EGLSurface surface, EGLint *rects, EGLint n_rects, const char* file, int line)
 {
 	TRACE_FUNCTION("eglSwapBuffersWithDamageKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_SwapBuffersWithDamageKHR(
+	addDamage(dpy, surface, rects, n_rects);
+
+	return TRACE_CALL(egl_SwapBuffersWithDamageKHR)(
 		dpy,
 		surface,
 		rects,
@@ -10796,7 +17011,7 @@ PFNEGLWAITSYNCKHRPROC gl::egl::egl_WaitSyncKHR INIT_POINTER;
 EGLint gl::egl::WaitSyncKHR  (EGLDisplay dpy, EGLSyncKHR sync, EGLint flags, const char* file, int line)
 {
 	TRACE_FUNCTION("eglWaitSyncKHR(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_WaitSyncKHR(
+	return TRACE_CALL(egl_WaitSyncKHR)(
 		dpy,
 		sync,
 		flags);
@@ -10807,7 +17022,7 @@ PFNEGLCREATEDRMIMAGEMESAPROC gl::egl::egl_CreateDRMImageMESA INIT_POINTER;
 EGLImageKHR gl::egl::CreateDRMImageMESA  (EGLDisplay dpy, const EGLint *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglCreateDRMImageMESA(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_CreateDRMImageMESA(
+	return TRACE_CALL(egl_CreateDRMImageMESA)(
 		dpy,
 		attrib_list);
 }
@@ -10816,7 +17031,7 @@ PFNEGLEXPORTDRMIMAGEMESAPROC gl::egl::egl_ExportDRMImageMESA INIT_POINTER;
 EGLBoolean gl::egl::ExportDRMImageMESA  (EGLDisplay dpy, EGLImageKHR image, EGLint *name, EGLint *handle, EGLint *stride, const char* file, int line)
 {
 	TRACE_FUNCTION("eglExportDRMImageMESA(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_ExportDRMImageMESA(
+	return TRACE_CALL(egl_ExportDRMImageMESA)(
 		dpy,
 		image,
 		name,
@@ -10829,7 +17044,7 @@ PFNEGLEXPORTDMABUFIMAGEMESAPROC gl::egl::egl_ExportDMABUFImageMESA INIT_POINTER;
 EGLBoolean gl::egl::ExportDMABUFImageMESA  (EGLDisplay dpy, EGLImageKHR image, int *fds, EGLint *strides, EGLint *offsets, const char* file, int line)
 {
 	TRACE_FUNCTION("eglExportDMABUFImageMESA(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_ExportDMABUFImageMESA(
+	return TRACE_CALL(egl_ExportDMABUFImageMESA)(
 		dpy,
 		image,
 		fds,
@@ -10841,7 +17056,7 @@ PFNEGLEXPORTDMABUFIMAGEQUERYMESAPROC gl::egl::egl_ExportDMABUFImageQueryMESA INI
 EGLBoolean gl::egl::ExportDMABUFImageQueryMESA  (EGLDisplay dpy, EGLImageKHR image, int *fourcc, int *num_planes, EGLuint64KHR *modifiers, const char* file, int line)
 {
 	TRACE_FUNCTION("eglExportDMABUFImageQueryMESA(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_ExportDMABUFImageQueryMESA(
+	return TRACE_CALL(egl_ExportDMABUFImageQueryMESA)(
 		dpy,
 		image,
 		fourcc,
@@ -10854,7 +17069,9 @@ PFNEGLSWAPBUFFERSREGIONNOKPROC gl::egl::egl_SwapBuffersRegionNOK INIT_POINTER;
 EGLBoolean gl::egl::SwapBuffersRegionNOK  (EGLDisplay dpy, EGLSurface surface, EGLint numRects, const EGLint *rects, const char* file, int line)
 {
 	TRACE_FUNCTION("eglSwapBuffersRegionNOK(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_SwapBuffersRegionNOK(
+	addDamage(dpy, surface, rects, numRects);
+
+	return TRACE_CALL(egl_SwapBuffersRegionNOK)(
 		dpy,
 		surface,
 		numRects,
@@ -10866,7 +17083,9 @@ PFNEGLSWAPBUFFERSREGION2NOKPROC gl::egl::egl_SwapBuffersRegion2NOK INIT_POINTER;
 EGLBoolean gl::egl::SwapBuffersRegion2NOK  (EGLDisplay dpy, EGLSurface surface, EGLint numRects, const EGLint *rects, const char* file, int line)
 {
 	TRACE_FUNCTION("eglSwapBuffersRegion2NOK(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_SwapBuffersRegion2NOK(
+	addDamage(dpy, surface, rects, numRects);
+
+	return TRACE_CALL(egl_SwapBuffersRegion2NOK)(
 		dpy,
 		surface,
 		numRects,
@@ -10878,7 +17097,7 @@ PFNEGLQUERYNATIVEDISPLAYNVPROC gl::egl::egl_QueryNativeDisplayNV INIT_POINTER;
 EGLBoolean gl::egl::QueryNativeDisplayNV  (EGLDisplay dpy, EGLNativeDisplayType *display_id, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryNativeDisplayNV(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryNativeDisplayNV(
+	return TRACE_CALL(egl_QueryNativeDisplayNV)(
 		dpy,
 		display_id);
 }
@@ -10887,7 +17106,7 @@ PFNEGLQUERYNATIVEPIXMAPNVPROC gl::egl::egl_QueryNativePixmapNV INIT_POINTER;
 EGLBoolean gl::egl::QueryNativePixmapNV  (EGLDisplay dpy, EGLSurface surf, EGLNativePixmapType *pixmap, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryNativePixmapNV(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryNativePixmapNV(
+	return TRACE_CALL(egl_QueryNativePixmapNV)(
 		dpy,
 		surf,
 		pixmap);
@@ -10897,7 +17116,7 @@ PFNEGLQUERYNATIVEWINDOWNVPROC gl::egl::egl_QueryNativeWindowNV INIT_POINTER;
 EGLBoolean gl::egl::QueryNativeWindowNV  (EGLDisplay dpy, EGLSurface surf, EGLNativeWindowType *window, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryNativeWindowNV(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryNativeWindowNV(
+	return TRACE_CALL(egl_QueryNativeWindowNV)(
 		dpy,
 		surf,
 		window);
@@ -10908,7 +17127,7 @@ PFNEGLPOSTSUBBUFFERNVPROC gl::egl::egl_PostSubBufferNV INIT_POINTER;
 EGLBoolean gl::egl::PostSubBufferNV  (EGLDisplay dpy, EGLSurface surface, EGLint x, EGLint y, EGLint width, EGLint height, const char* file, int line)
 {
 	TRACE_FUNCTION("eglPostSubBufferNV(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_PostSubBufferNV(
+	return TRACE_CALL(egl_PostSubBufferNV)(
 		dpy,
 		surface,
 		x,
@@ -10922,7 +17141,7 @@ PFNEGLSTREAMCONSUMERGLTEXTUREEXTERNALATTRIBSNVPROC gl::egl::egl_StreamConsumerGL
 EGLBoolean gl::egl::StreamConsumerGLTextureExternalAttribsNV  (EGLDisplay dpy, EGLStreamKHR stream, EGLAttrib *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglStreamConsumerGLTextureExternalAttribsNV(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_StreamConsumerGLTextureExternalAttribsNV(
+	return TRACE_CALL(egl_StreamConsumerGLTextureExternalAttribsNV)(
 		dpy,
 		stream,
 		attrib_list);
@@ -10933,7 +17152,7 @@ PFNEGLQUERYDISPLAYATTRIBNVPROC gl::egl::egl_QueryDisplayAttribNV INIT_POINTER;
 EGLBoolean gl::egl::QueryDisplayAttribNV  (EGLDisplay dpy, EGLint attribute, EGLAttrib *value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryDisplayAttribNV(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryDisplayAttribNV(
+	return TRACE_CALL(egl_QueryDisplayAttribNV)(
 		dpy,
 		attribute,
 		value);
@@ -10943,7 +17162,7 @@ PFNEGLQUERYSTREAMMETADATANVPROC gl::egl::egl_QueryStreamMetadataNV INIT_POINTER;
 EGLBoolean gl::egl::QueryStreamMetadataNV  (EGLDisplay dpy, EGLStreamKHR stream, EGLenum name, EGLint n, EGLint offset, EGLint size, void *data, const char* file, int line)
 {
 	TRACE_FUNCTION("eglQueryStreamMetadataNV(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_QueryStreamMetadataNV(
+	return TRACE_CALL(egl_QueryStreamMetadataNV)(
 		dpy,
 		stream,
 		name,
@@ -10957,7 +17176,7 @@ PFNEGLSETSTREAMMETADATANVPROC gl::egl::egl_SetStreamMetadataNV INIT_POINTER;
 EGLBoolean gl::egl::SetStreamMetadataNV  (EGLDisplay dpy, EGLStreamKHR stream, EGLint n, EGLint offset, EGLint size, const void *data, const char* file, int line)
 {
 	TRACE_FUNCTION("eglSetStreamMetadataNV(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_SetStreamMetadataNV(
+	return TRACE_CALL(egl_SetStreamMetadataNV)(
 		dpy,
 		stream,
 		n,
@@ -10971,7 +17190,7 @@ PFNEGLCREATESTREAMSYNCNVPROC gl::egl::egl_CreateStreamSyncNV INIT_POINTER;
 EGLSyncKHR gl::egl::CreateStreamSyncNV  (EGLDisplay dpy, EGLStreamKHR stream, EGLenum type, const EGLint *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglCreateStreamSyncNV(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_CreateStreamSyncNV(
+	return TRACE_CALL(egl_CreateStreamSyncNV)(
 		dpy,
 		stream,
 		type,
@@ -10983,7 +17202,7 @@ PFNEGLCLIENTWAITSYNCNVPROC gl::egl::egl_ClientWaitSyncNV INIT_POINTER;
 EGLint gl::egl::ClientWaitSyncNV  (EGLSyncNV sync, EGLint flags, EGLTimeNV timeout, const char* file, int line)
 {
 	TRACE_FUNCTION("eglClientWaitSyncNV(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_ClientWaitSyncNV(
+	return TRACE_CALL(egl_ClientWaitSyncNV)(
 		sync,
 		flags,
 		timeout);
@@ -10993,7 +17212,7 @@ PFNEGLCREATEFENCESYNCNVPROC gl::egl::egl_CreateFenceSyncNV INIT_POINTER;
 EGLSyncNV gl::egl::CreateFenceSyncNV  (EGLDisplay dpy, EGLenum condition, const EGLint *attrib_list, const char* file, int line)
 {
 	TRACE_FUNCTION("eglCreateFenceSyncNV(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_CreateFenceSyncNV(
+	return TRACE_CALL(egl_CreateFenceSyncNV)(
 		dpy,
 		condition,
 		attrib_list);
@@ -11003,7 +17222,7 @@ PFNEGLDESTROYSYNCNVPROC gl::egl::egl_DestroySyncNV INIT_POINTER;
 EGLBoolean gl::egl::DestroySyncNV  (EGLSyncNV sync, const char* file, int line)
 {
 	TRACE_FUNCTION("eglDestroySyncNV(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_DestroySyncNV(
+	return TRACE_CALL(egl_DestroySyncNV)(
 		sync);
 }
 
@@ -11011,7 +17230,7 @@ PFNEGLFENCENVPROC gl::egl::egl_FenceNV INIT_POINTER;
 EGLBoolean gl::egl::FenceNV  (EGLSyncNV sync, const char* file, int line)
 {
 	TRACE_FUNCTION("eglFenceNV(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_FenceNV(
+	return TRACE_CALL(egl_FenceNV)(
 		sync);
 }
 
@@ -11019,7 +17238,7 @@ PFNEGLGETSYNCATTRIBNVPROC gl::egl::egl_GetSyncAttribNV INIT_POINTER;
 EGLBoolean gl::egl::GetSyncAttribNV  (EGLSyncNV sync, EGLint attribute, EGLint *value, const char* file, int line)
 {
 	TRACE_FUNCTION("eglGetSyncAttribNV(...) called from " << get_path(file) << '(' << line << ')');
-	return egl_GetSyncAttribNV(
+	return TRACE_CALL(egl_GetSyncAttribNV)(
 		sync,
 		attribute,
 		value);
@@ -11030,7 +17249,7 @@ EGLBoolean gl::egl::SignalSyncNV  (EGLSyncNV sync, EGLenum mode, const char* fil
 {
 	TRACE_FUNCTION("eglSignalSyncNV(...) called from " << 
 		get_path(file) << '(' << line << ')');
-	return egl_SignalSyncNV(
+	return TRACE_CALL(egl_SignalSyncNV)(
 		sync,
 		mode);
 }
@@ -11041,7 +17260,7 @@ EGLuint64NV gl::egl::GetSystemTimeFrequencyNV  (const char* file, int line)
 {
 	TRACE_FUNCTION("eglGetSystemTimeFrequencyNV(...) called from " << 
 		get_path(file) << '(' << line << ')');
-	return egl_GetSystemTimeFrequencyNV();
+	return TRACE_CALL(egl_GetSystemTimeFrequencyNV)();
 }
 
 PFNEGLGETSYSTEMTIMENVPROC gl::egl::egl_GetSystemTimeNV INIT_POINTER;
@@ -11049,7 +17268,7 @@ EGLuint64NV gl::egl::GetSystemTimeNV (const char* file, int line)
 {
 	TRACE_FUNCTION("eglGetSystemTimeNV(...) called from " << 
 		get_path(file) << '(' << line << ')');
-	return egl_GetSystemTimeNV();
+	return TRACE_CALL(egl_GetSystemTimeNV)();
 }
 
 // ---------------------------------------------------------------------
@@ -58,6 +58,72 @@ int APIENTRY wWinMain(
 	// ok, first pass
 	glEnable(GL_CULL_FACE); // no warning
 	glEnable(GL_CULL_FACE); // must break on warning : already enabled
+
+	// program binary cache ---------------------------------------
+	if (Extensions::has("GL_OES_get_program_binary"))
+	{
+		gl::setProgramBinaryCache(".");
+
+		const GLchar* vertex = "attribute vec4 position;\n"
+			"void main() { gl_Position = position; }\n";
+		const GLchar* fragment = "precision mediump float;\n"
+			"void main() { gl_FragColor = vec4(1.0); }\n";
+
+		uint hits = 0;
+
+		// same sources and bindings : the second link loads the binary
+		// stored by the first one (or by an earlier run)
+		for (uint i = 0; i < 2; ++i)
+		{
+			hits = gl::getProgramBinaryHits();
+
+			GLuint vs = glCreateShader(GL_VERTEX_SHADER);
+			glShaderSource(vs, 1, &vertex, nullptr);
+			glCompileShader(vs);
+
+			GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
+			glShaderSource(fs, 1, &fragment, nullptr);
+			glCompileShader(fs);
+
+			GLuint program = glCreateProgram();
+			glAttachShader(program, vs);
+			glAttachShader(program, fs);
+			glBindAttribLocation(program, 0, "position");
+			glLinkProgram(program);
+
+			glDeleteProgram(program);
+			glDeleteShader(vs);
+			glDeleteShader(fs);
+		}
+
+		ne_assert(gl::getProgramBinaryHits() == hits + 1); // cache hit
+
+		gl::setProgramBinaryCache("");
+	}
+
+	// gpu profiling ----------------------------------------------
+	if (Extensions::has("GL_EXT_disjoint_timer_query"))
+	{
+		gl::setGpuProfiling(gl::GPU_PROFILING_FRAME);
+
+		const uint stalls = gl::getStallCount();
+
+		// the timings are read a few frames later, when available
+		for (uint i = 0; i < 8; ++i)
+		{
+			gl::reset();
+			glClear(GL_COLOR_BUFFER_BIT);
+			Window::swap();
+		}
+
+		const String report = gl::getGpuReport();
+
+		ne_assert(gl::getGpuTimeLastFrame() > 0); // frames read back
+		ne_assert(report.find("last frame") != String::npos);
+		ne_assert(gl::getStallCount() == stalls); // without waiting
+
+		gl::setGpuProfiling(gl::GPU_PROFILING_OFF);
+	}
 #else
 	/** clear color : ~gray */
 	glClearColor(0.533333f, 0.545098f, 0.552941f, 1.0f);